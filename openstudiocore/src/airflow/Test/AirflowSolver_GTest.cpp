@@ -0,0 +1,154 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/AirflowSolver.hpp"
+#include "../contam/ForwardTranslator.hpp"
+#include "../contam/PrjModel.hpp"
+#include "../contam/PrjAirflowElements.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../osversion/VersionTranslator.hpp"
+
+#include "DemoModel.hpp"
+
+#include <resources.hxx>
+
+#include <chrono>
+#include <map>
+
+TEST_F(AirflowFixture, AirflowSolver_Wind)
+{
+  // One zone with identical leaks on the windward and leeward walls
+  openstudio::contam::IndexModel model;
+  openstudio::contam::Level level(3.0, "Level 1");
+  model.addLevel(level);
+  openstudio::contam::Zone zone(openstudio::contam::VAR_P, 30.0, 293.15, "Zone");
+  zone.setPl(1);
+  model.addZone(zone);
+  openstudio::contam::PlrTest1 afe(OPNG, "leak", "Exterior leakage", 6.13696e-008, 0.000499082, 0.65, 75, 0.00906345);
+  model.addAirflowElement(afe);
+  std::vector<openstudio::contam::PressureCoefficientPoint> coeffs;
+  coeffs.push_back(openstudio::contam::PressureCoefficientPoint(0.0, 0.6));
+  coeffs.push_back(openstudio::contam::PressureCoefficientPoint(90.0, -0.3));
+  coeffs.push_back(openstudio::contam::PressureCoefficientPoint(180.0, -0.3));
+  coeffs.push_back(openstudio::contam::PressureCoefficientPoint(270.0, -0.3));
+  std::vector<openstudio::contam::WindPressureProfile> profiles;
+  profiles.push_back(openstudio::contam::WindPressureProfile(1, 1, "Wall", "Wall profile", coeffs));
+  model.setWindPressureProfiles(profiles);
+  for(double azimuth : {0.0, 180.0}) {
+    openstudio::contam::AirflowPath path(0, 1, -1, 1, 1, 1.0, 10.0, 0);
+    path.setWindPressure(true);
+    path.setPw(1);
+    path.setWazm(azimuth);
+    path.setWPmod(1.0);
+    model.addAirflowPath(path);
+  }
+
+  openstudio::contam::AirflowSolver solver(model);
+  openstudio::contam::WeatherData weather(293.15, 101325.0, 5.0, 0.0, 0.0, 0, 0, 0, 0, 0);
+  ASSERT_TRUE(solver.solve(weather));
+
+  // With matching flow elements and densities the zone sits halfway between the two wind pressures
+  double q = 0.5*101325.0/(287.055*293.15)*5.0*5.0;
+  ASSERT_TRUE(solver.nodePressure(1));
+  EXPECT_NEAR(0.5*(0.6 - 0.3)*q, solver.nodePressure(1).get(), 1.0e-3);
+  ASSERT_TRUE(solver.pathFlow(1));
+  ASSERT_TRUE(solver.pathFlow(2));
+  EXPECT_GT(0.0, solver.pathFlow(1).get());
+  EXPECT_NEAR(-solver.pathFlow(1).get(), solver.pathFlow(2).get(), 1.0e-6);
+  EXPECT_FALSE(solver.pathFlow(3));
+}
+
+TEST_F(AirflowFixture, AirflowSolver_Stack)
+{
+  // A warm zone with leaks near the floor and ceiling
+  openstudio::contam::IndexModel model;
+  openstudio::contam::Level level(10.0, "Level 1");
+  model.addLevel(level);
+  openstudio::contam::Zone zone(openstudio::contam::VAR_P, 100.0, 303.15, "Zone");
+  zone.setPl(1);
+  model.addZone(zone);
+  openstudio::contam::PlrTest1 afe(OPNG, "leak", "Exterior leakage", 6.13696e-008, 0.000499082, 0.65, 75, 0.00906345);
+  model.addAirflowElement(afe);
+  model.addAirflowPath(openstudio::contam::AirflowPath(0, 1, -1, 1, 1, 0.0, 10.0, 0));
+  model.addAirflowPath(openstudio::contam::AirflowPath(0, 1, -1, 1, 1, 10.0, 10.0, 0));
+
+  openstudio::contam::AirflowSolver solver(model);
+  openstudio::contam::WeatherData weather(273.15, 101325.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0);
+  ASSERT_TRUE(solver.solve(weather));
+
+  // Air enters at the bottom and leaves at the top
+  EXPECT_GT(0.0, solver.pathFlow(1).get());
+  EXPECT_LT(0.0, solver.pathFlow(2).get());
+  EXPECT_NEAR(-solver.pathFlow(1).get(), solver.pathFlow(2).get(), 1.0e-6);
+  EXPECT_GT(0.0, solver.nodePressure(1).get());
+}
+
+TEST_F(AirflowFixture, AirflowSolver_DemoModel_2012)
+{
+  openstudio::path modelPath = (resourcesPath() / openstudio::toPath("contam") / openstudio::toPath("CONTAMTemplate.osm"));
+  openstudio::osversion::VersionTranslator vt;
+  boost::optional<openstudio::model::Model> optionalModel = vt.loadModel(modelPath);
+  ASSERT_TRUE(optionalModel);
+  boost::optional<openstudio::model::Model> demoModel = buildDemoModel2012(optionalModel.get());
+  ASSERT_TRUE(demoModel);
+
+  openstudio::contam::ForwardTranslator translator;
+  boost::optional<openstudio::contam::IndexModel> prjModel = translator.translateModel(demoModel.get());
+  ASSERT_TRUE(prjModel);
+
+  openstudio::contam::AirflowSolver solver(prjModel.get());
+  int nRuns = 1000;
+  auto start = std::chrono::steady_clock::now();
+  for(int i = 0; i < nRuns; ++i) {
+    openstudio::contam::WeatherData weather(263.15 + 0.03*i, 101325.0, 0.01*i, 0.36*i, 0.0, 0, 0, 0, 0, 0);
+    ASSERT_TRUE(solver.solve(weather));
+  }
+  auto end = std::chrono::steady_clock::now();
+  LOG(Info, "Solved " << nRuns << " weather conditions in "
+    << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms");
+
+  // Every variable pressure zone should be in balance
+  std::vector<openstudio::contam::AirflowPath> paths = prjModel->airflowPaths();
+  std::vector<double> flows = solver.F0();
+  ASSERT_EQ(paths.size(), flows.size());
+  std::map<int, double> balance;
+  for(unsigned i = 0; i < paths.size(); ++i) {
+    balance[paths[i].pzn()] -= flows[i];
+    balance[paths[i].pzm()] += flows[i];
+  }
+  for(const openstudio::contam::Zone& zone : prjModel->zones()) {
+    if(zone.variablePressure()) {
+      EXPECT_NEAR(0.0, balance[zone.nr()], 1.0e-4);
+    }
+  }
+}
@@ -32,6 +32,11 @@
 
 #include "../contam/PrjModel.hpp"
 #include "../contam/PrjAirflowElements.hpp"
+#include "../contam/ForwardTranslator.hpp"
+
+#include "../../model/Model.hpp"
+
+#include <fstream>
 
 // Test adding airflow elements
 TEST_F(AirflowFixture, ContamModel_AirflowElements) {
@@ -140,3 +145,24 @@ TEST_F(AirflowFixture, ContamModel_Zones) {
   EXPECT_EQ(zone1, model.zones()[1]);
   EXPECT_EQ(zone2, model.zones()[2]);
 }
+
+// Verify that a written model reads back identically
+TEST_F(AirflowFixture, ContamModel_ReadWrite) {
+  openstudio::model::Model model = openstudio::model::exampleModel();
+  openstudio::contam::ForwardTranslator translator;
+  boost::optional<openstudio::contam::IndexModel> prjModel = translator.translateModel(model);
+  ASSERT_TRUE(prjModel);
+  std::string written = prjModel->toString();
+
+  openstudio::path p = openstudio::toPath("ContamModel_ReadWrite.prj");
+  {
+    std::ofstream file(openstudio::toString(p).c_str());
+    file << written;
+  }
+  openstudio::contam::IndexModel reread;
+  ASSERT_TRUE(reread.read(p));
+  EXPECT_EQ(prjModel->zones().size(), reread.zones().size());
+  EXPECT_EQ(prjModel->airflowPaths().size(), reread.airflowPaths().size());
+  EXPECT_EQ(prjModel->airflowElements().size(), reread.airflowElements().size());
+  EXPECT_EQ(written, reread.toString());
+}
@@ -0,0 +1,113 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/SimFile.hpp"
+
+#include <fstream>
+
+TEST_F(AirflowFixture, SimFile_Results)
+{
+  openstudio::path simPath = openstudio::toPath("SimFileTest.sim");
+  {
+    // The second time lists the paths out of order
+    std::ofstream lfr(openstudio::toString(openstudio::toPath("SimFileTest.lfr")).c_str());
+    lfr << "day\ttime\tpath\tdP\tF0\tF1\n";
+    lfr << "01/01\t00:00:00\t1\t1.0\t0.1\t0.0\n";
+    lfr << "01/01\t00:00:00\t2\t-1.0\t-0.2\t0.0\n";
+    lfr << "01/01\t01:00:00\t2\t-2.0\t-0.4\t0.1\n";
+    lfr << "01/01\t01:00:00\t1\t3.0\t0.3\t0.0\n";
+    std::ofstream nfr(openstudio::toString(openstudio::toPath("SimFileTest.nfr")).c_str());
+    nfr << "day\ttime\tnode\tT\tP\tD\n";
+    nfr << "01/01\t00:00:00\t0\t273.15\t0.0\t-\n";
+    nfr << "01/01\t00:00:00\t1\t293.15\t1.5\t1.2\n";
+    nfr << "01/01\t01:00:00\t0\t274.15\t0.0\t-\n";
+    nfr << "01/01\t01:00:00\t1\t294.15\t2.5\t1.19\n";
+  }
+
+  openstudio::contam::SimFile sim(simPath);
+  ASSERT_EQ(2u, sim.fileDateTimes().size());
+  std::vector<int> pathNrs = sim.pathNrs();
+  ASSERT_EQ(2u, pathNrs.size());
+  EXPECT_EQ(1, pathNrs[0]);
+  EXPECT_EQ(2, pathNrs[1]);
+
+  // Column and row views
+  boost::optional<openstudio::contam::ResultView> dP = sim.pathDeltaPView(2);
+  ASSERT_TRUE(dP);
+  ASSERT_EQ(2u, dP->size());
+  EXPECT_DOUBLE_EQ(-1.0, (*dP)[0]);
+  EXPECT_DOUBLE_EQ(-2.0, (*dP)[1]);
+  boost::optional<openstudio::contam::ResultView> F0 = sim.pathFlow0At(1);
+  ASSERT_TRUE(F0);
+  ASSERT_EQ(2u, F0->size());
+  EXPECT_DOUBLE_EQ(0.3, (*F0)[0]);
+  EXPECT_DOUBLE_EQ(-0.4, (*F0)[1]);
+  EXPECT_DOUBLE_EQ(-0.1, F0->sum());
+  EXPECT_DOUBLE_EQ(0.3, F0->max());
+  EXPECT_DOUBLE_EQ(-0.4, F0->min());
+  EXPECT_FALSE(sim.pathFlow0At(2));
+  EXPECT_FALSE(sim.pathDeltaPView(3));
+
+  // The old accessors still give one vector per path
+  std::vector<std::vector<double> > F1 = sim.F1();
+  ASSERT_EQ(2u, F1.size());
+  ASSERT_EQ(2u, F1[1].size());
+  EXPECT_DOUBLE_EQ(0.1, F1[1][1]);
+
+  // Reductions
+  std::vector<double> totals = sim.pathTotalFlows();
+  ASSERT_EQ(2u, totals.size());
+  EXPECT_NEAR(720.0, totals[0], 1.0e-9);
+  EXPECT_NEAR(-900.0, totals[1], 1.0e-9);
+  ASSERT_TRUE(sim.pathTotalFlow(2));
+  EXPECT_NEAR(-900.0, sim.pathTotalFlow(2).get(), 1.0e-9);
+  std::vector<double> peaks = sim.pathPeakFlows();
+  ASSERT_EQ(2u, peaks.size());
+  EXPECT_DOUBLE_EQ(0.3, peaks[0]);
+  EXPECT_DOUBLE_EQ(0.3, peaks[1]);
+  ASSERT_TRUE(sim.pathPeakFlow(1));
+  EXPECT_DOUBLE_EQ(0.3, sim.pathPeakFlow(1).get());
+
+  // Interval results
+  boost::optional<openstudio::TimeSeries> flow = sim.pathFlow(1);
+  ASSERT_TRUE(flow);
+  ASSERT_EQ(1u, flow->values().size());
+  EXPECT_DOUBLE_EQ(0.2, flow->values()[0]);
+
+  // Node results, the ambient node has no density
+  boost::optional<openstudio::contam::ResultView> D = sim.nodeDensityView(0);
+  ASSERT_TRUE(D);
+  EXPECT_DOUBLE_EQ(0.0, D->max());
+  boost::optional<openstudio::TimeSeries> P = sim.nodePressure(1);
+  ASSERT_TRUE(P);
+  EXPECT_DOUBLE_EQ(2.0, P->values()[0]);
+}
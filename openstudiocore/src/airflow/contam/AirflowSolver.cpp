@@ -0,0 +1,655 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "AirflowSolver.hpp"
+
+#include <algorithm>
+#include <map>
+#include <math.h>
+
+namespace openstudio {
+namespace contam {
+
+// Physical constants used throughout the solution
+static const double GRAVITY = 9.80665;
+static const double GAS_CONSTANT = 287.055;
+static const double VISCOSITY = 1.81625e-5;
+// Flow laws without a laminar regime are linearized below this pressure difference to keep the Jacobian finite
+static const double LINEAR_DP = 1.0e-4;
+
+static double powerLaw(double C, double x, double adP, double &dFdP)
+{
+  if(adP < LINEAR_DP) {
+    dFdP = C*pow(LINEAR_DP,x)/LINEAR_DP;
+    return dFdP*adP;
+  }
+  double F = C*pow(adP,x);
+  dFdP = x*F/adP;
+  return F;
+}
+
+static double quadraticLaw(double a, double b, double adP, double &dFdP)
+{
+  // Invert dP = a*F + b*F^2 for the flow
+  if(b <= 0.0) {
+    if(a <= 0.0) {
+      dFdP = 0.0;
+      return 0.0;
+    }
+    dFdP = 1.0/a;
+    return adP/a;
+  }
+  double dP = std::max(adP, LINEAR_DP);
+  double F = (-a + sqrt(a*a + 4.0*b*dP))/(2.0*b);
+  dFdP = 1.0/(a + 2.0*b*F);
+  if(adP < LINEAR_DP) {
+    dFdP = F/LINEAR_DP;
+    return dFdP*adP;
+  }
+  return F;
+}
+
+AirflowSolver::AirflowSolver(const IndexModel &model)
+  : m_converged(false), m_iterations(0)
+{
+  compile(model);
+}
+
+void AirflowSolver::compile(const IndexModel &model)
+{
+  RunControl rc = model.rc();
+  m_maxIterations = rc.afmaxi() > 0 ? rc.afmaxi() : 100;
+  m_relativeTolerance = rc.afrcnvg() > 0.0 ? rc.afrcnvg() : 1.0e-4;
+  m_absoluteTolerance = rc.afacnvg() > 0.0 ? rc.afacnvg() : 1.0e-5;
+  m_relax = rc.afrelax() > 0.0 ? rc.afrelax() : 0.75;
+  m_maxLinearIterations = rc.aflmaxi();
+  m_linearTolerance = rc.aflcnvg() > 0.0 ? rc.aflcnvg() : 1.0e-6;
+  m_weather = model.ssWeather();
+
+  std::map<int,double> levelHeight;
+  for(const Level &level : model.levels()) {
+    levelHeight[level.nr()] = level.refht();
+  }
+
+  // Zones
+  std::vector<Zone> zones = model.zones();
+  std::map<int,int> zoneIndex;
+  int nUnknown = 0;
+  for(const Zone &zone : zones) {
+    zoneIndex[zone.nr()] = m_zoneNr.size();
+    m_zoneNr.push_back(zone.nr());
+    m_zoneT.push_back(zone.T0() > 0.0 ? zone.T0() : 293.15);
+    m_zoneP0.push_back(zone.P0());
+    m_zoneZ.push_back(levelHeight[zone.pl()] + zone.relHt());
+    m_unknown.push_back(zone.variablePressure() ? nUnknown++ : -1);
+  }
+
+  // Airflow elements
+  std::map<int,int> elementIndex;
+  for(const std::shared_ptr<AirflowElement> &afe : model.airflowElements()) {
+    AirflowElement *el = afe.get();
+    if(!el) {
+      continue;
+    }
+    FlowElement element = {NoFlow, 0.0, 0.0, 0.5, 0.0, 0.0, 0.0, 0.5};
+    if(PlrQcn *qcn = dynamic_cast<PlrQcn*>(el)) {
+      element.law = PowerLawVolume;
+      element.lam = qcn->lam();
+      element.turb = qcn->turb();
+      element.expt = qcn->expt();
+    } else if(PlrFcn *fcn = dynamic_cast<PlrFcn*>(el)) {
+      element.law = PowerLawMass;
+      element.lam = fcn->lam();
+      element.turb = fcn->turb();
+      element.expt = fcn->expt();
+    } else if(PlrOrf *orf = dynamic_cast<PlrOrf*>(el)) {
+      element.law = PowerLaw;
+      element.lam = orf->lam();
+      element.turb = orf->turb();
+      element.expt = orf->expt();
+    } else if(PlrLeak *leak = dynamic_cast<PlrLeak*>(el)) {
+      element.law = PowerLaw;
+      element.lam = leak->lam();
+      element.turb = leak->turb();
+      element.expt = leak->expt();
+    } else if(PlrConn *conn = dynamic_cast<PlrConn*>(el)) {
+      element.law = PowerLaw;
+      element.lam = conn->lam();
+      element.turb = conn->turb();
+      element.expt = conn->expt();
+    } else if(PlrTest1 *test1 = dynamic_cast<PlrTest1*>(el)) {
+      element.law = PowerLaw;
+      element.lam = test1->lam();
+      element.turb = test1->turb();
+      element.expt = test1->expt();
+    } else if(PlrTest2 *test2 = dynamic_cast<PlrTest2*>(el)) {
+      element.law = PowerLaw;
+      element.lam = test2->lam();
+      element.turb = test2->turb();
+      element.expt = test2->expt();
+    } else if(PlrCrack *crack = dynamic_cast<PlrCrack*>(el)) {
+      element.law = PowerLaw;
+      element.lam = crack->lam();
+      element.turb = crack->turb();
+      element.expt = crack->expt();
+    } else if(PlrStair *stair = dynamic_cast<PlrStair*>(el)) {
+      element.law = PowerLaw;
+      element.lam = stair->lam();
+      element.turb = stair->turb();
+      element.expt = stair->expt();
+    } else if(PlrShaft *shaft = dynamic_cast<PlrShaft*>(el)) {
+      element.law = PowerLaw;
+      element.lam = shaft->lam();
+      element.turb = shaft->turb();
+      element.expt = shaft->expt();
+    } else if(AfeDor *door = dynamic_cast<AfeDor*>(el)) {
+      // Two-way flow is not modeled, so doors are treated as single openings
+      element.law = PowerLaw;
+      element.lam = door->lam();
+      element.turb = door->turb();
+      element.expt = door->expt();
+    } else if(DrPl2 *pl2 = dynamic_cast<DrPl2*>(el)) {
+      element.law = PowerLaw;
+      element.lam = pl2->lam();
+      element.turb = pl2->turb();
+      element.expt = pl2->expt();
+    } else if(AfeFan *fan = dynamic_cast<AfeFan*>(el)) {
+      // Fan curves are not modeled, so fans behave as they do when off
+      element.law = PowerLaw;
+      element.lam = fan->lam();
+      element.turb = fan->turb();
+      element.expt = fan->expt();
+    } else if(PlrBackDamper *damper = dynamic_cast<PlrBackDamper*>(el)) {
+      element.law = dynamic_cast<PlrBdf*>(el) ? BackDamperMass : BackDamper;
+      element.turb = damper->Cp();
+      element.expt = damper->xp();
+      element.Cn = damper->Cn();
+      element.xn = damper->xn();
+    } else if(QfrGeneral *qfr = dynamic_cast<QfrGeneral*>(el)) {
+      element.law = dynamic_cast<QfrFab*>(el) ? QuadraticMass : Quadratic;
+      element.a = qfr->a();
+      element.b = qfr->b();
+    } else if(QfrCrack *qfrCrack = dynamic_cast<QfrCrack*>(el)) {
+      element.law = Quadratic;
+      element.a = qfrCrack->a();
+      element.b = qfrCrack->b();
+    } else if(QfrTest2 *qfrTest2 = dynamic_cast<QfrTest2*>(el)) {
+      element.law = Quadratic;
+      element.a = qfrTest2->a();
+      element.b = qfrTest2->b();
+    } else if(AfeFlow *constant = dynamic_cast<AfeFlow*>(el)) {
+      element.law = dynamic_cast<AfeCvf*>(el) ? ConstantVolume : ConstantMass;
+      element.turb = constant->Flow();
+    } else {
+      LOG(Warn, "Airflow element " << el->nr() << " of type '" << el->dataType() << "' is not supported, no flow will be computed");
+    }
+    elementIndex[el->nr()] = m_elements.size();
+    m_elements.push_back(element);
+  }
+
+  // Wind pressure profiles
+  std::map<int,int> profileIndex;
+  for(WindPressureProfile profile : model.windPressureProfiles()) {
+    std::vector<std::pair<double,double> > points;
+    for(const PressureCoefficientPoint &point : profile.coeffs()) {
+      points.push_back(std::make_pair(point.azm(), point.coef()));
+    }
+    std::sort(points.begin(), points.end());
+    profileIndex[profile.nr()] = m_profiles.size();
+    m_profiles.push_back(points);
+  }
+
+  // Simple air handling systems: the supply and return flows are set on the system paths, and the system is assumed
+  // to recirculate as much air as it can. Outdoor air schedules are not evaluated.
+  std::vector<AirflowPath> paths = model.airflowPaths();
+  std::map<int,double> supplyFlow;
+  std::map<int,double> returnFlow;
+  for(AirflowPath path : paths) {
+    if(path.system()) {
+      supplyFlow[path.pzn()] += path.Fahs();
+      returnFlow[path.pzm()] += path.Fahs();
+    }
+  }
+  std::map<int,double> recirculationFlow;
+  for(const Ahs &ahs : model.ahs()) {
+    recirculationFlow[ahs.zone_r()] = std::min(supplyFlow[ahs.zone_s()], returnFlow[ahs.zone_r()]);
+  }
+
+  // Paths
+  std::vector<std::vector<int> > columns(nUnknown);
+  for(int i=0;i<nUnknown;i++) {
+    columns[i].push_back(i);
+  }
+  for(AirflowPath path : paths) {
+    FlowPath flowPath = {-1, -1, -1, path.mult(), levelHeight[path.pld()] + path.relHt(), path.windPressure(),
+      path.wPmod(), path.wPset(), path.wazm(), -1, 0.0, -1, -1, -1, -1};
+    if(path.pzn() > 0) {
+      flowPath.n = zoneIndex[path.pzn()];
+    }
+    if(path.pzm() > 0) {
+      flowPath.m = zoneIndex[path.pzm()];
+    }
+    if(path.system()) {
+      flowPath.fixedFlow = path.Fahs();
+    } else if(path.recirculation()) {
+      flowPath.fixedFlow = recirculationFlow[path.pzn()];
+    } else if(path.outsideAir()) {
+      int zone_s = path.pzm();
+      double recirc = 0.0;
+      for(const Ahs &ahs : model.ahs()) {
+        if(ahs.zone_s() == zone_s) {
+          recirc = recirculationFlow[ahs.zone_r()];
+        }
+      }
+      flowPath.fixedFlow = supplyFlow[zone_s] - recirc;
+    } else if(path.exhaust()) {
+      flowPath.fixedFlow = returnFlow[path.pzn()] - recirculationFlow[path.pzn()];
+    } else {
+      std::map<int,int>::iterator iter = elementIndex.find(path.pe());
+      if(iter == elementIndex.end()) {
+        LOG(Warn, "Airflow path " << path.nr() << " has no airflow element, no flow will be computed");
+      } else {
+        flowPath.element = iter->second;
+      }
+    }
+    if(flowPath.wind) {
+      std::map<int,int>::iterator iter = profileIndex.find(path.pw());
+      if(iter != profileIndex.end()) {
+        flowPath.profile = iter->second;
+      }
+    }
+    int un = flowPath.n >= 0 ? m_unknown[flowPath.n] : -1;
+    int um = flowPath.m >= 0 ? m_unknown[flowPath.m] : -1;
+    if(un >= 0 && um >= 0 && un != um) {
+      columns[un].push_back(um);
+      columns[um].push_back(un);
+    }
+    m_pathNr.push_back(path.nr());
+    m_paths.push_back(flowPath);
+  }
+
+  // Build the sparse Jacobian structure and locate each path's entries in it
+  m_rowStart.push_back(0);
+  for(int i=0;i<nUnknown;i++) {
+    std::sort(columns[i].begin(), columns[i].end());
+    columns[i].erase(std::unique(columns[i].begin(), columns[i].end()), columns[i].end());
+    for(int j : columns[i]) {
+      if(j == i) {
+        m_diagonal.push_back(m_column.size());
+      }
+      m_column.push_back(j);
+    }
+    m_rowStart.push_back(m_column.size());
+  }
+  m_jacobian.resize(m_column.size());
+  auto position = [this](int i, int j) -> int {
+    std::vector<int>::const_iterator begin = m_column.begin() + m_rowStart[i];
+    std::vector<int>::const_iterator end = m_column.begin() + m_rowStart[i+1];
+    return (int)(std::lower_bound(begin, end, j) - m_column.begin());
+  };
+  for(FlowPath &path : m_paths) {
+    int un = path.n >= 0 ? m_unknown[path.n] : -1;
+    int um = path.m >= 0 ? m_unknown[path.m] : -1;
+    if(un >= 0) {
+      path.jnn = m_diagonal[un];
+    }
+    if(um >= 0) {
+      path.jmm = m_diagonal[um];
+    }
+    if(un >= 0 && um >= 0 && un != um) {
+      path.jnm = position(un, um);
+      path.jmn = position(um, un);
+    }
+  }
+}
+
+double AirflowSolver::flow(const FlowElement &element, double dP, double rho, double &dFdP) const
+{
+  double sign = dP < 0.0 ? -1.0 : 1.0;
+  double adP = fabs(dP);
+  double F = 0.0;
+  dFdP = 0.0;
+  switch(element.law) {
+  case PowerLaw:
+  case PowerLawVolume:
+  case PowerLawMass:
+    {
+      // Laminar and turbulent coefficients, the smaller of the two flows is used
+      double laminar = element.lam;
+      double turbulent = element.turb;
+      if(element.law == PowerLaw) {
+        laminar *= rho/VISCOSITY;
+        turbulent *= sqrt(rho);
+      } else if(element.law == PowerLawVolume) {
+        laminar *= rho;
+        turbulent *= rho;
+      }
+      F = powerLaw(turbulent, element.expt, adP, dFdP);
+      if(laminar > 0.0 && laminar*adP <= F) {
+        F = laminar*adP;
+        dFdP = laminar;
+      }
+    }
+    break;
+  case Quadratic:
+    F = rho*quadraticLaw(element.a, element.b, adP, dFdP);
+    dFdP *= rho;
+    break;
+  case QuadraticMass:
+    F = quadraticLaw(element.a, element.b, adP, dFdP);
+    break;
+  case BackDamper:
+  case BackDamperMass:
+    {
+      double C = dP < 0.0 ? element.Cn : element.turb;
+      double x = dP < 0.0 ? element.xn : element.expt;
+      if(element.law == BackDamper) {
+        C *= rho;
+      }
+      F = powerLaw(C, x, adP, dFdP);
+    }
+    break;
+  case ConstantMass:
+    return element.turb;
+  case ConstantVolume:
+    return rho*element.turb;
+  case NoFlow:
+  default:
+    return 0.0;
+  }
+  return sign*F;
+}
+
+double AirflowSolver::windPressure(const FlowPath &path, double rhoAmbient, double windspd, double winddir) const
+{
+  if(!path.wind) {
+    return 0.0;
+  }
+  if(path.profile < 0) {
+    return path.wPset;
+  }
+  const std::vector<std::pair<double,double> > &points = m_profiles[path.profile];
+  if(points.empty()) {
+    return 0.0;
+  }
+  // Linear interpolation around the circle of the relative wind angle
+  double angle = fmod(winddir - path.wazm, 360.0);
+  if(angle < 0.0) {
+    angle += 360.0;
+  }
+  double Cp = points.back().second;
+  std::pair<double,double> lower(points.back().first - 360.0, points.back().second);
+  for(const std::pair<double,double> &upper : points) {
+    if(angle <= upper.first) {
+      double span = upper.first - lower.first;
+      Cp = span > 0.0 ? lower.second + (angle - lower.first)*(upper.second - lower.second)/span : upper.second;
+      break;
+    }
+    lower = upper;
+  }
+  if(angle > points.back().first) {
+    std::pair<double,double> upper(points.front().first + 360.0, points.front().second);
+    double span = upper.first - lower.first;
+    Cp = span > 0.0 ? lower.second + (angle - lower.first)*(upper.second - lower.second)/span : upper.second;
+  }
+  return path.wPmod*Cp*0.5*rhoAmbient*windspd*windspd;
+}
+
+bool AirflowSolver::solveLinearSystem(std::vector<double> &x)
+{
+  // Jacobi-preconditioned conjugate gradient, the right hand side is passed in x
+  int n = x.size();
+  std::vector<double> r(x);
+  std::vector<double> z(n), p(n), q(n);
+  std::fill(x.begin(), x.end(), 0.0);
+  double bnorm = 0.0;
+  for(int i=0;i<n;i++) {
+    bnorm += r[i]*r[i];
+  }
+  bnorm = sqrt(bnorm);
+  if(bnorm == 0.0) {
+    return true;
+  }
+  double rz = 0.0;
+  for(int i=0;i<n;i++) {
+    z[i] = r[i]/m_jacobian[m_diagonal[i]];
+    p[i] = z[i];
+    rz += r[i]*z[i];
+  }
+  int maxIterations = m_maxLinearIterations > 0 ? m_maxLinearIterations : std::max(1000, n);
+  for(int k=0;k<maxIterations;k++) {
+    double pq = 0.0;
+    for(int i=0;i<n;i++) {
+      double sum = 0.0;
+      for(int j=m_rowStart[i];j<m_rowStart[i+1];j++) {
+        sum += m_jacobian[j]*p[m_column[j]];
+      }
+      q[i] = sum;
+      pq += p[i]*sum;
+    }
+    if(pq <= 0.0) {
+      return false;
+    }
+    double alpha = rz/pq;
+    double rnorm = 0.0;
+    for(int i=0;i<n;i++) {
+      x[i] += alpha*p[i];
+      r[i] -= alpha*q[i];
+      rnorm += r[i]*r[i];
+    }
+    if(sqrt(rnorm) <= m_linearTolerance*bnorm) {
+      return true;
+    }
+    double rzNew = 0.0;
+    for(int i=0;i<n;i++) {
+      z[i] = r[i]/m_jacobian[m_diagonal[i]];
+      rzNew += r[i]*z[i];
+    }
+    double beta = rzNew/rz;
+    rz = rzNew;
+    for(int i=0;i<n;i++) {
+      p[i] = z[i] + beta*p[i];
+    }
+  }
+  return false;
+}
+
+bool AirflowSolver::solve()
+{
+  return solve(m_weather);
+}
+
+bool AirflowSolver::solve(const WeatherData &weather)
+{
+  double Pb = weather.barpres() > 0.0 ? weather.barpres() : 101325.0;
+  double Ta = weather.Tambt() > 0.0 ? weather.Tambt() : 293.15;
+  double rhoAmbient = Pb/(GAS_CONSTANT*Ta);
+
+  int nZones = m_zoneNr.size();
+  int nPaths = m_paths.size();
+  int nUnknown = m_diagonal.size();
+
+  std::vector<double> rho(nZones);
+  for(int i=0;i<nZones;i++) {
+    rho[i] = Pb/(GAS_CONSTANT*m_zoneT[i]);
+  }
+  std::vector<double> Pw(nPaths);
+  for(int k=0;k<nPaths;k++) {
+    Pw[k] = windPressure(m_paths[k], rhoAmbient, weather.windspd(), weather.winddir());
+  }
+
+  std::vector<double> P(m_zoneP0);
+  std::vector<double> residual(nUnknown);
+  std::vector<double> sumFlow(nUnknown);
+  std::vector<double> correction(nUnknown);
+  std::vector<double> lastCorrection(nUnknown, 0.0);
+  m_dP.assign(nPaths, 0.0);
+  m_F0.assign(nPaths, 0.0);
+  m_F1.assign(nPaths, 0.0);
+
+  m_converged = false;
+  for(m_iterations=0;;m_iterations++) {
+    std::fill(residual.begin(), residual.end(), 0.0);
+    std::fill(sumFlow.begin(), sumFlow.end(), 0.0);
+    std::fill(m_jacobian.begin(), m_jacobian.end(), 0.0);
+    for(int k=0;k<nPaths;k++) {
+      const FlowPath &path = m_paths[k];
+      // Pressures on either side of the path at the path height, positive flow is from n to m
+      double Pn = path.n >= 0 ? P[path.n] - rho[path.n]*GRAVITY*(path.z - m_zoneZ[path.n]) : Pw[k] - rhoAmbient*GRAVITY*path.z;
+      double Pm = path.m >= 0 ? P[path.m] - rho[path.m]*GRAVITY*(path.z - m_zoneZ[path.m]) : Pw[k] - rhoAmbient*GRAVITY*path.z;
+      double dP = Pn - Pm;
+      double rhoN = path.n >= 0 ? rho[path.n] : rhoAmbient;
+      double rhoM = path.m >= 0 ? rho[path.m] : rhoAmbient;
+      double F = path.fixedFlow;
+      double dFdP = 0.0;
+      if(path.element >= 0) {
+        const FlowElement &element = m_elements[path.element];
+        double upwind = (dP >= 0.0 || element.law == ConstantVolume) ? rhoN : rhoM;
+        F = path.mult*flow(element, dP, upwind, dFdP);
+        dFdP *= path.mult;
+      }
+      m_dP[k] = dP;
+      m_F0[k] = F;
+      int un = path.n >= 0 ? m_unknown[path.n] : -1;
+      int um = path.m >= 0 ? m_unknown[path.m] : -1;
+      if(un >= 0) {
+        residual[un] += F;
+        sumFlow[un] += fabs(F);
+        m_jacobian[path.jnn] += dFdP;
+      }
+      if(um >= 0) {
+        residual[um] -= F;
+        sumFlow[um] += fabs(F);
+        m_jacobian[path.jmm] += dFdP;
+      }
+      if(path.jnm >= 0) {
+        m_jacobian[path.jnm] -= dFdP;
+        m_jacobian[path.jmn] -= dFdP;
+      }
+    }
+
+    // Check the mass balance of each variable pressure zone
+    bool converged = true;
+    for(int i=0;i<nUnknown;i++) {
+      double imbalance = fabs(residual[i]);
+      if(imbalance > m_absoluteTolerance && imbalance > m_relativeTolerance*sumFlow[i]) {
+        converged = false;
+        break;
+      }
+    }
+    if(converged) {
+      m_converged = true;
+      break;
+    }
+    if(m_iterations >= m_maxIterations) {
+      LOG(Warn, "Airflow solution failed to converge in " << m_maxIterations << " iterations");
+      break;
+    }
+
+    // Zones that are isolated from the rest of the network keep their pressure
+    for(int i=0;i<nUnknown;i++) {
+      if(m_jacobian[m_diagonal[i]] <= 0.0) {
+        m_jacobian[m_diagonal[i]] = 1.0;
+        residual[i] = 0.0;
+      }
+    }
+    correction = residual;
+    if(!solveLinearSystem(correction)) {
+      LOG(Debug, "Linear solution failed to converge in Newton iteration " << m_iterations);
+    }
+    // Under-relax corrections that change direction to damp oscillations
+    for(int i=0;i<nZones;i++) {
+      int u = m_unknown[i];
+      if(u >= 0) {
+        if(correction[u]*lastCorrection[u] < 0.0) {
+          correction[u] *= m_relax;
+        }
+        lastCorrection[u] = correction[u];
+        P[i] -= correction[u];
+      }
+    }
+  }
+
+  m_T = m_zoneT;
+  m_P = P;
+  m_D = rho;
+  return m_converged;
+}
+
+static boost::optional<double> lookup(const std::vector<int> &nrs, const std::vector<double> &values, int nr)
+{
+  std::vector<int>::const_iterator iter = std::find(nrs.begin(), nrs.end(), nr);
+  if(iter == nrs.end() || values.empty()) {
+    return boost::optional<double>();
+  }
+  return boost::optional<double>(values[iter - nrs.begin()]);
+}
+
+boost::optional<double> AirflowSolver::pathDeltaP(int nr) const
+{
+  return lookup(m_pathNr, m_dP, nr);
+}
+
+boost::optional<double> AirflowSolver::pathFlow0(int nr) const
+{
+  return lookup(m_pathNr, m_F0, nr);
+}
+
+boost::optional<double> AirflowSolver::pathFlow1(int nr) const
+{
+  return lookup(m_pathNr, m_F1, nr);
+}
+
+boost::optional<double> AirflowSolver::pathFlow(int nr) const
+{
+  boost::optional<double> F0 = pathFlow0(nr);
+  boost::optional<double> F1 = pathFlow1(nr);
+  if(!F0 || !F1) {
+    return boost::optional<double>();
+  }
+  return boost::optional<double>(F0.get() + F1.get());
+}
+
+boost::optional<double> AirflowSolver::nodeTemperature(int nr) const
+{
+  return lookup(m_zoneNr, m_T, nr);
+}
+
+boost::optional<double> AirflowSolver::nodePressure(int nr) const
+{
+  return lookup(m_zoneNr, m_P, nr);
+}
+
+boost::optional<double> AirflowSolver::nodeDensity(int nr) const
+{
+  return lookup(m_zoneNr, m_D, nr);
+}
+
+} // contam
+} // openstudio
@@ -0,0 +1,195 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef AIRFLOW_CONTAM_AIRFLOWSOLVER_HPP
+#define AIRFLOW_CONTAM_AIRFLOWSOLVER_HPP
+
+#include "PrjModel.hpp"
+
+#include "../utilities/core/Logger.hpp"
+
+#include <boost/optional.hpp>
+
+#include <vector>
+
+#include "../AirflowAPI.hpp"
+
+namespace openstudio {
+namespace contam {
+
+/** AirflowSolver computes the steady-state airflows and pressures of an IndexModel without running ContamX.
+ *  The flow network is compiled once on construction, so repeated calls to solve (e.g. for a series of weather
+ *  conditions) only pay for the Newton iteration. Zone pressures are found with a Newton method that uses a
+ *  sparse, Jacobi-preconditioned conjugate gradient solver for the linear system, and the path pressure
+ *  differences include stack effect and wind pressure. Results are laid out like SimFile's, with one entry per
+ *  path or node in CONTAM number order. */
+class AIRFLOW_API AirflowSolver {
+public:
+  /** Compile the flow network of the input model. */
+  explicit AirflowSolver(const IndexModel &model);
+
+  /** Solve the network using the model's steady-state weather. Returns true if the solution converged. */
+  bool solve();
+  /** Solve the network using the input weather. Returns true if the solution converged. */
+  bool solve(const WeatherData &weather);
+
+  /** Returns true if the last solution converged. */
+  bool converged() const
+  {
+    return m_converged;
+  }
+  /** Returns the number of Newton iterations taken by the last solution. */
+  int iterations() const
+  {
+    return m_iterations;
+  }
+
+  // These mirror SimFile, with a single value per path or node
+  std::vector<double> dP() const
+  {
+    return m_dP;
+  }
+  std::vector<double> F0() const
+  {
+    return m_F0;
+  }
+  std::vector<double> F1() const
+  {
+    return m_F1;
+  }
+  std::vector<double> T() const
+  {
+    return m_T;
+  }
+  std::vector<double> P() const
+  {
+    return m_P;
+  }
+  std::vector<double> D() const
+  {
+    return m_D;
+  }
+
+  /** Returns the pressure difference across path nr in Pa. */
+  boost::optional<double> pathDeltaP(int nr) const;
+  /** Returns the flow in the positive direction of path nr in kg/s. */
+  boost::optional<double> pathFlow0(int nr) const;
+  /** Returns the flow in the negative direction of path nr in kg/s. This is always zero for one-way elements. */
+  boost::optional<double> pathFlow1(int nr) const;
+  /** Returns the total flow through path nr in kg/s. */
+  boost::optional<double> pathFlow(int nr) const;
+  /** Returns the temperature of node nr in K. */
+  boost::optional<double> nodeTemperature(int nr) const;
+  /** Returns the gauge pressure of node nr in Pa. */
+  boost::optional<double> nodePressure(int nr) const;
+  /** Returns the density of node nr in kg/m^3. */
+  boost::optional<double> nodeDensity(int nr) const;
+
+private:
+  // The flow laws that the airflow elements reduce to
+  enum FlowLaw {NoFlow, PowerLaw, PowerLawVolume, PowerLawMass, Quadratic, QuadraticMass, BackDamper,
+    BackDamperMass, ConstantMass, ConstantVolume};
+
+  struct FlowElement
+  {
+    FlowLaw law;
+    double lam;
+    double turb;
+    double expt;
+    double a;
+    double b;
+    double Cn;
+    double xn;
+  };
+
+  struct FlowPath
+  {
+    int n;  // zone index or -1 for ambient
+    int m;  // zone index or -1 for ambient
+    int element;  // element index or -1 for a fixed flow
+    double mult;
+    double z;
+    bool wind;
+    double wPmod;
+    double wPset;
+    double wazm;
+    int profile;  // profile index or -1 to use wPset
+    double fixedFlow;
+    // Positions of the (n,n), (n,m), (m,n), and (m,m) Jacobian entries
+    int jnn;
+    int jnm;
+    int jmn;
+    int jmm;
+  };
+
+  void compile(const IndexModel &model);
+  double flow(const FlowElement &element, double dP, double rho, double &dFdP) const;
+  double windPressure(const FlowPath &path, double rhoAmbient, double windspd, double winddir) const;
+  bool solveLinearSystem(std::vector<double> &x);
+
+  std::vector<int> m_zoneNr;
+  std::vector<double> m_zoneT;
+  std::vector<double> m_zoneP0;
+  std::vector<double> m_zoneZ;
+  std::vector<int> m_unknown;  // the unknown index of each zone or -1 for a fixed pressure zone
+  std::vector<int> m_pathNr;
+  std::vector<FlowPath> m_paths;
+  std::vector<FlowElement> m_elements;
+  std::vector<std::vector<std::pair<double,double> > > m_profiles;
+
+  // Compressed sparse row storage for the Jacobian
+  std::vector<int> m_rowStart;
+  std::vector<int> m_column;
+  std::vector<double> m_jacobian;
+  std::vector<int> m_diagonal;
+
+  WeatherData m_weather;
+  int m_maxIterations;
+  double m_relativeTolerance;
+  double m_absoluteTolerance;
+  double m_relax;
+  int m_maxLinearIterations;
+  double m_linearTolerance;
+
+  bool m_converged;
+  int m_iterations;
+  std::vector<double> m_dP;
+  std::vector<double> m_F0;
+  std::vector<double> m_F1;
+  std::vector<double> m_T;
+  std::vector<double> m_P;
+  std::vector<double> m_D;
+
+  REGISTER_LOGGER("openstudio.contam.AirflowSolver");
+};
+
+} // contam
+} // openstudio
+
+#endif // AIRFLOW_CONTAM_AIRFLOWSOLVER_HPP
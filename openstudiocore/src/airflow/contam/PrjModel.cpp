@@ -766,6 +766,11 @@ void IndexModel::setWindPressureProfiles(const std::vector<WindPressureProfile>
   m_impl->setWindPressureProfiles(windPressureProfiles);
 }
 
+std::vector<std::shared_ptr<AirflowElement> > IndexModel::airflowElements() const
+{
+  return m_impl->airflowElements();
+}
+
 std::vector<PlrTest1> IndexModel::getPlrTest1() const
 {
   return m_impl->getAirflowElements<PlrTest1>();
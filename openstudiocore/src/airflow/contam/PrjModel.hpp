@@ -370,6 +370,8 @@ public:
   /** Sets the model wind pressure profiles vector. */
   void setWindPressureProfiles(const std::vector<WindPressureProfile> &windPressureProfiles);
 
+  /** Returns a vector of all airflow elements in the model, in element number order. */
+  std::vector<std::shared_ptr<AirflowElement> > airflowElements() const;
   /** Returns a vector of all PlrTest1 airflow elements in the model. */
   std::vector<PlrTest1> getPlrTest1() const;
   /** Returns a vector of all PlrTest2 airflow elements in the model. */
@@ -315,6 +315,11 @@ public:
   std::vector <WindPressureProfile> windPressureProfiles() const;
   void setWindPressureProfiles(const std::vector<WindPressureProfile> &windPressureProfiles);
 
+  std::vector<std::shared_ptr<AirflowElement> > airflowElements() const
+  {
+    return m_airflowElements;
+  }
+
   template <class T> std::vector<T> getAirflowElements()
   {
     std::vector<T> afe;
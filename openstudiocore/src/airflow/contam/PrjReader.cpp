@@ -30,6 +30,11 @@
 #include "PrjReader.hpp"
 #include <iostream>
 #include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
 
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
@@ -37,28 +42,170 @@
 namespace openstudio {
 namespace contam {
 
+// The numeric conversions below work directly on the input buffer with the C library. Anything that the C library
+// does not consume completely (including input that a non-C locale would misread) is handed to Qt, so the results
+// and the accepted inputs match those of the QString conversions.
+
+static bool isPlainNumber(const char *begin, const char *end)
+{
+  if(begin == end) {
+    return false;
+  }
+  for(const char *ptr = begin; ptr != end; ++ptr) {
+    if(!((*ptr >= '0' && *ptr <= '9') || *ptr == '.' || *ptr == '-' || *ptr == '+' || *ptr == 'e' || *ptr == 'E')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool toDouble(const char *begin, const char *end, double &value)
+{
+  if(isPlainNumber(begin, end)) {
+    char *last;
+    value = strtod(begin, &last);
+    if(last == end) {
+      return true;
+    }
+  }
+  bool ok;
+  value = QString::fromUtf8(begin, end - begin).toDouble(&ok);
+  return ok;
+}
+
+static bool toFloat(const char *begin, const char *end, float &value)
+{
+  double dvalue;
+  if(isPlainNumber(begin, end)) {
+    char *last;
+    dvalue = strtod(begin, &last);
+    if(last == end && fabs(dvalue) <= FLT_MAX) {
+      value = (float)dvalue;
+      return true;
+    }
+  }
+  bool ok;
+  value = QString::fromUtf8(begin, end - begin).toFloat(&ok);
+  return ok;
+}
+
+static bool toInt(const char *begin, const char *end, int &value)
+{
+  if(begin != end && *begin != ' ' && *begin != '\t') {
+    char *last;
+    errno = 0;
+    long lvalue = strtol(begin, &last, 10);
+    if(last == end && errno == 0 && lvalue >= INT_MIN && lvalue <= INT_MAX) {
+      value = (int)lvalue;
+      return true;
+    }
+  }
+  bool ok;
+  value = QString::fromUtf8(begin, end - begin).toInt(&ok);
+  return ok;
+}
+
+static bool toUInt(const char *begin, const char *end, unsigned &value)
+{
+  if(begin != end && *begin >= '0' && *begin <= '9') {
+    char *last;
+    errno = 0;
+    unsigned long lvalue = strtoul(begin, &last, 10);
+    if(last == end && errno == 0 && lvalue <= UINT_MAX) {
+      value = (unsigned)lvalue;
+      return true;
+    }
+  }
+  bool ok;
+  value = QString::fromUtf8(begin, end - begin).toUInt(&ok);
+  return ok;
+}
+
+static bool startsWith(const char *begin, const char *end, const char *prefix)
+{
+  size_t n = strlen(prefix);
+  return (size_t)(end - begin) >= n && strncmp(begin, prefix, n) == 0;
+}
+
 Reader::Reader( openstudio::filesystem::ifstream &file )
-  : m_stream(openstudio::filesystem::read_as_QByteArray(file)), m_lineNumber(0)
+  : m_buffer(openstudio::filesystem::read_as_string(file)), m_position(0), m_entries(nullptr), m_entriesEnd(nullptr),
+  m_lineNumber(0)
 {
 }
 
-Reader::Reader(QString *string, int starting) : m_lineNumber(starting)
+Reader::Reader(QString *string, int starting)
+  : m_buffer(string->toStdString()), m_position(0), m_entries(nullptr), m_entriesEnd(nullptr), m_lineNumber(starting)
 {
-  m_stream.setString(string);
 }
 
 Reader::~Reader()
 {
 }
 
+bool Reader::nextLine(const char *&begin, const char *&end)
+{
+  if(m_position >= m_buffer.size()) {
+    return false;
+  }
+  const char *data = m_buffer.data();
+  begin = data + m_position;
+  const char *newline = (const char*)memchr(begin, '\n', m_buffer.size() - m_position);
+  if(newline) {
+    end = newline;
+    m_position = newline - data + 1;
+  } else {
+    end = data + m_buffer.size();
+    m_position = m_buffer.size();
+  }
+  if(end != begin && end[-1] == '\r') {
+    --end;
+  }
+  m_lineNumber++;
+  return true;
+}
+
+void Reader::readLineRange(const char *&begin, const char *&end)
+{
+  do {
+    if(!nextLine(begin, end)) {
+      QString mesg=QString("Failed to read input at line %1").arg(m_lineNumber);
+      LOG_AND_THROW(mesg.toStdString());
+    }
+  } while(begin != end && *begin == '!');
+}
+
+bool Reader::nextToken(const char *&begin, const char *&end)
+{
+  while(1) {
+    while(m_entries != m_entriesEnd && *m_entries == ' ') {
+      ++m_entries;
+    }
+    if(m_entries == m_entriesEnd) {
+      readLineRange(m_entries, m_entriesEnd);
+      continue;
+    }
+    begin = m_entries;
+    while(m_entries != m_entriesEnd && *m_entries != ' ') {
+      ++m_entries;
+    }
+    end = m_entries;
+    if(*begin == '!') {
+      // The rest of the line is a comment
+      m_entries = m_entriesEnd;
+    } else {
+      return true;
+    }
+  }
+}
+
 float Reader::readFloat()
 {
-  bool ok;
-  QString string = readQString();
-  float value = string.toFloat(&ok);
-  if(!ok) {
+  const char *begin, *end;
+  nextToken(begin, end);
+  float value;
+  if(!toFloat(begin, end, value)) {
     QString mesg=QString("Floating point (float) conversion error at line %1 for \"%2\"")
-      .arg(m_lineNumber).arg(string);
+      .arg(m_lineNumber).arg(QString::fromUtf8(begin, end - begin));
     LOG_AND_THROW(mesg.toStdString());
   }
   return value;
@@ -66,12 +213,12 @@ float Reader::readFloat()
 
 double Reader::readDouble()
 {
-  bool ok;
-  QString string = readQString();
-  double value = string.toDouble(&ok);
-  if(!ok) {
+  const char *begin, *end;
+  nextToken(begin, end);
+  double value;
+  if(!toDouble(begin, end, value)) {
     QString mesg=QString("Floating point (double) conversion error at line %1 for \"%2\"")
-      .arg(m_lineNumber).arg(string);
+      .arg(m_lineNumber).arg(QString::fromUtf8(begin, end - begin));
     LOG_AND_THROW(mesg.toStdString());
   }
   return value;
@@ -79,53 +226,31 @@ double Reader::readDouble()
 
 QString Reader::readQString()
 {
-  while(1) {
-    while(m_entries.size() == 0) {
-      QString input = m_stream.readLine();
-      LOG(Debug, "Line read: " << input.toStdString());
-      if(input.isNull()) {
-        QString mesg=QString("Failed to read input at line %1").arg(m_lineNumber);
-        LOG_AND_THROW(mesg.toStdString());
-      }
-      m_lineNumber++;
-      while(input[0]=='!') {
-        input = m_stream.readLine();
-        LOG(Debug, "Line read: " << input.toStdString());
-        if(input.isNull()) {
-          QString mesg=QString("Failed to read input at line %1").arg(m_lineNumber);
-          LOG_AND_THROW(mesg.toStdString());
-        }
-        m_lineNumber++;
-      }
-      m_entries = input.split(" ",QString::SkipEmptyParts);
-    }
-    QString out = m_entries.takeFirst();
-    if(out[0] == '!') {
-      m_entries.clear();
-    } else {
-      LOG(Debug, "String return: " << out.toStdString());
-      return out;
-    }
-  }
+  const char *begin, *end;
+  nextToken(begin, end);
+  return QString::fromUtf8(begin, end - begin);
 }
 
 std::string Reader::readStdString()
 {
-  return readQString().toStdString();
+  const char *begin, *end;
+  nextToken(begin, end);
+  return std::string(begin, end);
 }
 
 std::string Reader::readString()
 {
-  return readQString().toStdString();
+  return readStdString();
 }
 
 int Reader::readInt()
 {
-  bool ok;
-  QString string = readQString();
-  int value = string.toInt(&ok);
-  if(!ok) {
-    QString mesg=QString("Integer conversion error at line %1 for \"%2\"").arg(m_lineNumber).arg(string);
+  const char *begin, *end;
+  nextToken(begin, end);
+  int value;
+  if(!toInt(begin, end, value)) {
+    QString mesg=QString("Integer conversion error at line %1 for \"%2\"").arg(m_lineNumber)
+      .arg(QString::fromUtf8(begin, end - begin));
     LOG_AND_THROW(mesg.toStdString());
   }
   return value;
@@ -133,50 +258,32 @@ int Reader::readInt()
 
 unsigned int Reader::readUInt()
 {
-  bool ok;
-  QString string = readQString();
-  int value = string.toUInt(&ok);
-  if(!ok) {
-    QString mesg=QString("Unsigned integer conversion error at line %1 for \"%2\"").arg(m_lineNumber).arg(string);
+  const char *begin, *end;
+  nextToken(begin, end);
+  unsigned value;
+  if(!toUInt(begin, end, value)) {
+    QString mesg=QString("Unsigned integer conversion error at line %1 for \"%2\"").arg(m_lineNumber)
+      .arg(QString::fromUtf8(begin, end - begin));
     LOG_AND_THROW(mesg.toStdString());
   }
   return value;
 }
 
 std::string Reader::readLine()
-{
-  return readLineQString().toStdString();
-}
-
-QString Reader::readLineQString()
 {
   /* Dump any other input */
-  if(m_entries.size()) {
-    m_entries.clear();
-  }
-  QString input = m_stream.readLine();
-  LOG(Debug, "Line read: " << input.toStdString());
-  if(input.isNull()) {
-    QString mesg=QString("Failed to read input at line %1").arg(m_lineNumber);
-    LOG_AND_THROW(mesg.toStdString());
-  }
-  m_lineNumber++;
-  while(input[0]=='!') {
-    input = m_stream.readLine();
-    LOG(Debug, "Line read: " << input.toStdString());
-    if(input.isNull()) {
-      QString mesg=QString("Failed to read input at line %1").arg(m_lineNumber);
-      LOG_AND_THROW(mesg.toStdString());
-    }
-    m_lineNumber++;
-  }
-  return input;
+  m_entries = m_entriesEnd;
+  const char *begin, *end;
+  readLineRange(begin, end);
+  return std::string(begin, end);
 }
 
 void Reader::read999()
 {
-  QString input = readLineQString();
-  if(!input.startsWith(QString("-999"))) {
+  m_entries = m_entriesEnd;
+  const char *begin, *end;
+  readLineRange(begin, end);
+  if(!startsWith(begin, end, "-999")) {
     QString mesg=QString("Failed to read -999 at line %1").arg(m_lineNumber);
     LOG_AND_THROW(mesg.toStdString());
   }
@@ -184,8 +291,10 @@ void Reader::read999()
 
 void Reader::read999(std::string mesg)
 {
-  QString input = readLineQString();
-  if(!input.startsWith(QString("-999"))) {
+  m_entries = m_entriesEnd;
+  const char *begin, *end;
+  readLineRange(begin, end);
+  if(!startsWith(begin, end, "-999")) {
     QString errmesg = QString().fromStdString(mesg) + QString(" at line %1").arg(m_lineNumber);
     LOG_AND_THROW(errmesg.toStdString());
   }
@@ -193,8 +302,10 @@ void Reader::read999(std::string mesg)
 
 void Reader::readEnd()
 {
-  QString input = readLineQString();
-  if(!input.startsWith(QString("* end project file."))) {
+  m_entries = m_entriesEnd;
+  const char *begin, *end;
+  readLineRange(begin, end);
+  if(!startsWith(begin, end, "* end project file.")) {
     QString mesg = QString("Failed to read file end at line %1").arg(m_lineNumber);
     LOG_AND_THROW(mesg.toStdString());
   }
@@ -207,20 +318,20 @@ void Reader::skipSection()
 
 std::string Reader::readSection()
 {
-  QString section;
+  std::string section;
   while(1) {
-    QString input = m_stream.readLine();
-    if(input.isNull()) {
+    const char *begin, *end;
+    if(!nextLine(begin, end)) {
       QString mesg = QString("Failed to read input at line %1").arg(m_lineNumber);
       LOG_AND_THROW(mesg.toStdString());
     }
-    m_lineNumber++;
-    section += input + '\n';
-    if(input.startsWith(QString("-999"))) {
+    section.append(begin, end);
+    section += '\n';
+    if(startsWith(begin, end, "-999")) {
       break;
     }
   }
-  return section.toStdString();
+  return section;
 }
 
 std::vector<int> Reader::readIntVector(bool terminated)
@@ -278,26 +389,26 @@ template <> float Reader::readNumber<float>()
 
 template <> QString Reader::readNumber<QString>()
 {
-  bool ok;
-  QString string = readQString();
-  string.toDouble(&ok);
-  if(!ok) {
-    QString mesg = QString("Invalid number \"%2\" on line %1").arg(m_lineNumber).arg(string);
+  const char *begin, *end;
+  nextToken(begin, end);
+  double value;
+  if(!toDouble(begin, end, value)) {
+    QString mesg = QString("Invalid number \"%2\" on line %1").arg(m_lineNumber).arg(QString::fromUtf8(begin, end - begin));
     LOG_AND_THROW(mesg.toStdString());
   }
-  return string;
+  return QString::fromUtf8(begin, end - begin);
 }
 
 template <> std::string Reader::readNumber<std::string>()
 {
-  bool ok;
-  QString string = readQString();
-  string.toDouble(&ok);
-  if(!ok) {
-    QString mesg = QString("Invalid number \"%2\" on line %1").arg(m_lineNumber).arg(string);
+  const char *begin, *end;
+  nextToken(begin, end);
+  double value;
+  if(!toDouble(begin, end, value)) {
+    QString mesg = QString("Invalid number \"%2\" on line %1").arg(m_lineNumber).arg(QString::fromUtf8(begin, end - begin));
     LOG_AND_THROW(mesg.toStdString());
   }
-  return string.toStdString();
+  return std::string(begin, end);
 }
 
 } // contam
@@ -81,11 +81,17 @@ public:
 private:
   QString readQString();
   std::string readStdString();
-  QString readLineQString();
-
-  QTextStream m_stream;
+  // The input is scanned in place, tokens are ranges of the buffer
+  bool nextLine(const char *&begin, const char *&end);
+  bool nextToken(const char *&begin, const char *&end);
+  void readLineRange(const char *&begin, const char *&end);
+
+  std::string m_buffer;
+  size_t m_position;
+  // The unread part of the line that the last token came from
+  const char *m_entries;
+  const char *m_entriesEnd;
   int m_lineNumber;
-  QStringList m_entries;
 
   REGISTER_LOGGER("openstudio.contam.Reader");
 };
@@ -31,6 +31,11 @@
 
 #include <QStringList>
 
+#include <algorithm>
+#include <map>
+#include <math.h>
+#include <stdlib.h>
+
 namespace openstudio {
 namespace contam {
 
@@ -76,6 +81,7 @@ bool SimFile::computeDateTimes(QVector<QString> day, QVector<QString> time)
 
 void SimFile::clearLfr()
 {
+  m_pathNr.clear();
   m_dP.clear();
   m_F0.clear();
   m_F1.clear();
@@ -86,105 +92,11 @@ bool SimFile::readLfr(QString fileName)
   clearLfr();
   QVector<QString> day;
   QVector<QString> time;
-  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-  if(!file.is_open())
-  {
-    LOG(Error,"Failed to open LFR file '" << fileName.toStdString() << "'");
-    return false;
-  }
-  QMap<int,int> nrMap;
-  // Read the header
-  std::string headerstr;
-  std::getline(file, headerstr);
-  QString header = openstudio::toQString(headerstr);
-  if(header.isNull() || header.isEmpty())
+  if(!readResults(fileName,"LFR",false,m_dP,m_F0,m_F1,m_pathNr,day,time))
   {
-    LOG(Error,"No data in LFR file '" << fileName.toStdString() << "'");
-    return false;
-  }
-  QStringList row = header.split('\t');
-  int ncols = 6;
-  if(row.size() != ncols)
-  {
-    LOG(Error,"LFR file has " << row.size() << " columns, not the expected " << ncols);
+    clearLfr();
     return false;
   }
-  // Read the data
-  while(file.good())
-  {
-    std::string linestr;
-    std::getline(file, linestr);
-    QString line = openstudio::toQString(linestr);
-    QStringList row = line.split('\t');
-    if(row.size() != ncols)
-    {
-      clearLfr();
-      LOG(Error,"LFR data line has " << row.size() << " columns, not the expected " << ncols);
-      return false;
-    }
-    if(time.size())
-    {
-      if(time[time.size()-1] != row[1])
-      {
-        day << row[0];
-        time << row[1];
-      }
-    }
-    else
-    {
-      day << row[0];
-      time << row[1];
-    }
-    bool convOk;
-    int nr = row[2].toInt(&convOk);
-    if(!convOk)
-    {
-      clearLfr();
-      LOG(Error,"Invalid link number '" << row[2].toStdString() << "'");
-      return false;
-    }
-    if(!nrMap.contains(nr))
-    {
-      int sz = nrMap.size();
-      nrMap[nr] = sz;
-      m_dP.resize(sz+1);
-      m_F0.resize(sz+1);
-      m_F1.resize(sz+1);
-    }
-    double dP = row[3].toDouble(&convOk);
-    if(!convOk)
-    {
-      clearLfr();
-      LOG(Error,"Invalid pressure difference '" << row[3].toStdString() << "'");
-      return false;
-    }
-    double F0 = row[4].toDouble(&convOk);
-    if(!convOk)
-    {
-      clearLfr();
-      LOG(Error,"Invalid flow 0 '" << row[4].toStdString() << "'");
-      return false;
-    }
-    double F1 = row[5].toDouble(&convOk);
-    if(!convOk)
-    {
-      clearLfr();
-      LOG(Error,"Invalid flow 1 '" << row[5].toStdString() << "'");
-      return false;
-    }
-    m_dP[nrMap[nr]].push_back(dP);
-    m_F0[nrMap[nr]].push_back(F0);
-    m_F1[nrMap[nr]].push_back(F1);
-
-  }
-  // Unwind the zone number map;
-  QList<int> keys = nrMap.keys();
-  m_pathNr.resize(keys.size());
-  for(int i=0;i<keys.size();i++)
-  {
-    m_pathNr[nrMap[keys[i]]] = keys[i];
-  }
-  file.close();
   // Compute the required date/time objects - this needs to be moved elsewhere if the NCR and NFR are also read
   if(!computeDateTimes(day,time))
   {
@@ -198,6 +110,7 @@ bool SimFile::readLfr(QString fileName)
 
 void SimFile::clearNfr()
 {
+  m_nodeNr.clear();
   m_T.clear();
   m_P.clear();
   m_D.clear();
@@ -208,138 +121,417 @@ bool SimFile::readNfr(QString fileName)
   clearNfr();
   QVector<QString> day;
   QVector<QString> time;
-  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-  if(file.is_open())
+  if(!readResults(fileName,"NFR",true,m_T,m_P,m_D,m_nodeNr,day,time))
   {
-    LOG(Error,"Failed to open NFR file '" << fileName.toStdString() << "'");
+    clearNfr();
     return false;
   }
+  // Something should probably be done here to make sure that the times here match up with what we
+  // already have. For now, if nothing is known about the dates, then try to compute it
+  if(m_dateTimes.size() == 0)
+  {
+    if(!computeDateTimes(day,time))
+    {
+      clearNfr();
+      m_dateTimes.clear();
+      LOG(Error,"Failed to compute date and time objects from NFR input");
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool parseDouble(const char *field, double &value)
+{
+  char *end;
+  value = strtod(field,&end);
+  return end != field && *end == '\0';
+}
 
-  QMap<int,int> nrMap;
+bool SimFile::readResults(QString fileName, const char *type, bool nodes, std::vector<double> &v0,
+  std::vector<double> &v1, std::vector<double> &v2, QVector<int> &nrs, QVector<QString> &day, QVector<QString> &time)
+{
+  // Both the LFR and NFR files have six tab-separated columns (day, time, number, and three values), and the NFR
+  // file may have two more. Lines are grouped by time, so the results are appended one row at a time.
+  static const char *lfrNames[] = {"link number", "pressure difference", "flow 0", "flow 1"};
+  static const char *nfrNames[] = {"node number", "temperature", "pressure", "density"};
+  const char **names = nodes ? nfrNames : lfrNames;
+  const unsigned ncols = 6;
+  const unsigned maxcols = nodes ? ncols+2 : ncols;
+  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
+  if(!file.is_open())
+  {
+    LOG(Error,"Failed to open " << type << " file '" << fileName.toStdString() << "'");
+    return false;
+  }
   // Read the header
-  std::string headerstr;
-  std::getline(file, headerstr);
-  QString header = openstudio::toQString(headerstr);
-  if(header.isNull() || header.isEmpty())
+  std::string line;
+  std::getline(file, line);
+  if(line.empty())
   {
-    LOG(Error,"No data in LFR file '" << fileName.toStdString() << "'");
+    LOG(Error,"No data in " << type << " file '" << fileName.toStdString() << "'");
     return false;
   }
-  QStringList row = header.split('\t');
-  int ncols = 6;
-  if(row.size() != ncols && row.size() != ncols+2)
+  unsigned count = std::count(line.begin(), line.end(), '\t') + 1;
+  if(count != ncols && count != maxcols)
   {
-    LOG(Error,"NFR file has " << row.size() << " columns, not the expected " << ncols);
+    LOG(Error,type << " file has " << count << " columns, not the expected " << ncols);
     return false;
   }
   // Read the data
-  while(file.good())
+  std::map<int,unsigned> nrMap;
+  unsigned nelements = 0;
+  bool firstRow = true;
+  unsigned position = 0;
+  size_t rowStart = 0;
+  std::string currentTime;
+  const char *fields[ncols+2];
+  while(std::getline(file, line))
   {
-    std::string linestr;
-    std::getline(file, linestr);
-    QString line = openstudio::toQString(linestr);
-
-    QStringList row = line.split('\t');
-    if(row.size() != ncols && row.size() != ncols+2)
+    if(!line.empty() && line[line.size()-1] == '\r')
     {
-      clearNfr();
-      LOG(Error,"NFR data line has " << row.size() << " columns, not the expected " << ncols);
-      return false;
+      line.resize(line.size()-1);
     }
-    if(time.size())
+    if(line.empty())
     {
-      if(time[time.size()-1] != row[1])
-      {
-        day << row[0];
-        time << row[1];
-      }
+      continue;
     }
-    else
+    // Split the line in place
+    count = 0;
+    fields[count++] = &line[0];
+    for(size_t i=0;i<line.size() && count<=maxcols;i++)
     {
-      day << row[0];
-      time << row[1];
+      if(line[i] == '\t')
+      {
+        line[i] = '\0';
+        if(count < maxcols)
+        {
+          fields[count] = &line[i+1];
+        }
+        count++;
+      }
     }
-    bool convOk;
-    int nr = row[2].toInt(&convOk);
-    if(!convOk)
+    if(count != ncols && count != maxcols)
     {
-      clearNfr();
-      LOG(Error,"Invalid node number '" << row[2].toStdString() << "'");
+      LOG(Error,type << " data line has " << count << " columns, not the expected " << ncols);
       return false;
     }
-    if(!nrMap.contains(nr))
+    if(time.isEmpty() || currentTime != fields[1])
     {
-      int sz = nrMap.size();
-      nrMap[nr] = sz;
-      m_T.resize(sz+1);
-      m_P.resize(sz+1);
-      m_D.resize(sz+1);
+      if(!time.isEmpty())
+      {
+        if(firstRow)
+        {
+          nelements = nrs.size();
+          firstRow = false;
+        }
+        else if(position != nelements)
+        {
+          LOG(Error,type << " results for " << currentTime << " have " << position << " entries, not the expected " << nelements);
+          return false;
+        }
+        rowStart = v0.size();
+        v0.resize(rowStart+nelements);
+        v1.resize(rowStart+nelements);
+        v2.resize(rowStart+nelements);
+      }
+      currentTime = fields[1];
+      day << QString(fields[0]);
+      time << QString(fields[1]);
+      position = 0;
     }
-    double T = row[3].toDouble(&convOk);
-    if(!convOk)
+    char *end;
+    long nr = strtol(fields[2],&end,10);
+    if(end == fields[2] || *end != '\0')
     {
-      clearNfr();
-      LOG(Error,"Invalid temperature '" << row[3].toStdString() << "'");
+      LOG(Error,"Invalid " << names[0] << " '" << fields[2] << "'");
       return false;
     }
-    double P = row[4].toDouble(&convOk);
-    if(!convOk)
+    double values[3];
+    for(unsigned i=0;i<3;i++)
     {
-      clearNfr();
-      LOG(Error,"Invalid pressure '" << row[4].toStdString() << "'");
-      return false;
+      if(!parseDouble(fields[3+i],values[i]))
+      {
+        // The ambient node does not have a density
+        if(nodes && i==2 && nr==0)
+        {
+          values[i] = 0.0;
+        }
+        else
+        {
+          LOG(Error,"Invalid " << names[1+i] << " '" << fields[3+i] << "'");
+          return false;
+        }
+      }
     }
-    double D = row[5].toDouble(&convOk);
-    if(!convOk)
+    if(firstRow)
     {
-      if(nr==0)
+      if(nrMap.find(nr) != nrMap.end())
       {
-        D=0.0;
+        LOG(Error,"Duplicate " << names[0] << " '" << nr << "' at " << currentTime);
+        return false;
       }
-      else
+      nrMap[nr] = nrs.size();
+      nrs << nr;
+      v0.push_back(values[0]);
+      v1.push_back(values[1]);
+      v2.push_back(values[2]);
+    }
+    else
+    {
+      // Results normally come in the same order every time, so only look up the column when they do not
+      unsigned col = position;
+      if(col >= nelements || nrs[col] != nr)
       {
-        clearNfr();
-        LOG(Error,"Invalid density '" << row[5].toStdString() << "'");
-        return false;
+        std::map<int,unsigned>::const_iterator iter = nrMap.find(nr);
+        if(iter == nrMap.end())
+        {
+          LOG(Error,"Unexpected " << names[0] << " '" << nr << "' at " << currentTime);
+          return false;
+        }
+        col = iter->second;
       }
+      v0[rowStart+col] = values[0];
+      v1[rowStart+col] = values[1];
+      v2[rowStart+col] = values[2];
     }
-    m_T[nrMap[nr]].push_back(T);
-    m_P[nrMap[nr]].push_back(P);
-    m_D[nrMap[nr]].push_back(D);
-
+    position++;
   }
-  // Unwind the zone number map;
-  QList<int> keys = nrMap.keys();
-  m_nodeNr.resize(keys.size());
-  for(int i=0;i<keys.size();i++)
+  if(!firstRow && position != nelements)
   {
-    m_nodeNr[nrMap[keys[i]]] = keys[i];
+    LOG(Error,type << " results for " << currentTime << " have " << position << " entries, not the expected " << nelements);
+    return false;
   }
   file.close();
-  // Something should probably be done here to make sure that the times here match up with what we
-  // already have. For now, if nothing is known about the dates, then try to compute it
-  if(m_dateTimes.size() == 0)
+  return true;
+}
+
+double ResultView::sum() const
+{
+  double result = 0.0;
+  for(unsigned i=0;i<m_size;i++)
   {
-    if(!computeDateTimes(day,time))
+    result += m_data[i*m_stride];
+  }
+  return result;
+}
+
+double ResultView::max() const
+{
+  if(m_size == 0)
+  {
+    return 0.0;
+  }
+  double result = m_data[0];
+  for(unsigned i=1;i<m_size;i++)
+  {
+    result = std::max(result, m_data[i*m_stride]);
+  }
+  return result;
+}
+
+double ResultView::min() const
+{
+  if(m_size == 0)
+  {
+    return 0.0;
+  }
+  double result = m_data[0];
+  for(unsigned i=1;i<m_size;i++)
+  {
+    result = std::min(result, m_data[i*m_stride]);
+  }
+  return result;
+}
+
+std::vector<double> ResultView::toStdVector() const
+{
+  std::vector<double> result(m_size);
+  for(unsigned i=0;i<m_size;i++)
+  {
+    result[i] = m_data[i*m_stride];
+  }
+  return result;
+}
+
+std::vector<std::vector<double> > SimFile::columns(const std::vector<double> &data, unsigned ncols) const
+{
+  std::vector<std::vector<double> > result(ncols);
+  for(unsigned j=0;j<ncols;j++)
+  {
+    result[j] = ResultView(data.data()+j, data.size()/ncols, ncols).toStdVector();
+  }
+  return result;
+}
+
+boost::optional<ResultView> SimFile::column(const std::vector<double> &data, const QVector<int> &nrs, int nr) const
+{
+  int index = nrs.indexOf(nr);
+  if(index == -1)
+  {
+    return boost::optional<ResultView>();
+  }
+  return boost::optional<ResultView>(ResultView(data.data()+index, data.size()/nrs.size(), nrs.size()));
+}
+
+boost::optional<ResultView> SimFile::row(const std::vector<double> &data, unsigned ncols, unsigned i) const
+{
+  if(ncols == 0 || i >= data.size()/ncols)
+  {
+    return boost::optional<ResultView>();
+  }
+  return boost::optional<ResultView>(ResultView(data.data()+i*ncols, ncols, 1));
+}
+
+boost::optional<ResultView> SimFile::pathDeltaPView(int nr) const
+{
+  return column(m_dP,m_pathNr,nr);
+}
+
+boost::optional<ResultView> SimFile::pathFlow0View(int nr) const
+{
+  return column(m_F0,m_pathNr,nr);
+}
+
+boost::optional<ResultView> SimFile::pathFlow1View(int nr) const
+{
+  return column(m_F1,m_pathNr,nr);
+}
+
+boost::optional<ResultView> SimFile::nodeTemperatureView(int nr) const
+{
+  return column(m_T,m_nodeNr,nr);
+}
+
+boost::optional<ResultView> SimFile::nodePressureView(int nr) const
+{
+  return column(m_P,m_nodeNr,nr);
+}
+
+boost::optional<ResultView> SimFile::nodeDensityView(int nr) const
+{
+  return column(m_D,m_nodeNr,nr);
+}
+
+boost::optional<ResultView> SimFile::pathDeltaPAt(unsigned i) const
+{
+  return row(m_dP,m_pathNr.size(),i);
+}
+
+boost::optional<ResultView> SimFile::pathFlow0At(unsigned i) const
+{
+  return row(m_F0,m_pathNr.size(),i);
+}
+
+boost::optional<ResultView> SimFile::pathFlow1At(unsigned i) const
+{
+  return row(m_F1,m_pathNr.size(),i);
+}
+
+boost::optional<ResultView> SimFile::nodeTemperatureAt(unsigned i) const
+{
+  return row(m_T,m_nodeNr.size(),i);
+}
+
+boost::optional<ResultView> SimFile::nodePressureAt(unsigned i) const
+{
+  return row(m_P,m_nodeNr.size(),i);
+}
+
+boost::optional<ResultView> SimFile::nodeDensityAt(unsigned i) const
+{
+  return row(m_D,m_nodeNr.size(),i);
+}
+
+std::vector<double> SimFile::pathTotalFlows() const
+{
+  unsigned npaths = m_pathNr.size();
+  std::vector<double> totals(npaths,0.0);
+  if(npaths == 0)
+  {
+    return totals;
+  }
+  unsigned ntimes = std::min(m_F0.size()/npaths, m_dateTimes.size());
+  // Walk the rows in order so that the flows are read sequentially
+  for(unsigned i=1;i<ntimes;i++)
+  {
+    double dt = 0.5*(m_dateTimes[i] - m_dateTimes[i-1]).totalSeconds();
+    const double *F0 = m_F0.data()+i*npaths;
+    const double *F1 = m_F1.data()+i*npaths;
+    const double *lastF0 = F0-npaths;
+    const double *lastF1 = F1-npaths;
+    for(unsigned j=0;j<npaths;j++)
     {
-      clearLfr();
-      m_dateTimes.clear();
-      LOG(Error,"Failed to compute date and time objects from NFR input");
-      return false;
+      totals[j] += dt*(lastF0[j] + lastF1[j] + F0[j] + F1[j]);
     }
   }
-  return true;
+  return totals;
+}
+
+std::vector<double> SimFile::pathPeakFlows() const
+{
+  unsigned npaths = m_pathNr.size();
+  std::vector<double> peaks(npaths,0.0);
+  if(npaths == 0)
+  {
+    return peaks;
+  }
+  unsigned ntimes = m_F0.size()/npaths;
+  for(unsigned i=0;i<ntimes;i++)
+  {
+    const double *F0 = m_F0.data()+i*npaths;
+    const double *F1 = m_F1.data()+i*npaths;
+    for(unsigned j=0;j<npaths;j++)
+    {
+      peaks[j] = std::max(peaks[j], fabs(F0[j] + F1[j]));
+    }
+  }
+  return peaks;
+}
+
+boost::optional<double> SimFile::pathTotalFlow(int nr) const
+{
+  boost::optional<ResultView> F0 = pathFlow0View(nr);
+  boost::optional<ResultView> F1 = pathFlow1View(nr);
+  if(!F0 || !F1)
+  {
+    return boost::optional<double>();
+  }
+  double total = 0.0;
+  unsigned ntimes = std::min((size_t)F0->size(), m_dateTimes.size());
+  for(unsigned i=1;i<ntimes;i++)
+  {
+    double dt = (m_dateTimes[i] - m_dateTimes[i-1]).totalSeconds();
+    total += 0.5*dt*((*F0)[i-1] + (*F1)[i-1] + (*F0)[i] + (*F1)[i]);
+  }
+  return boost::optional<double>(total);
+}
+
+boost::optional<double> SimFile::pathPeakFlow(int nr) const
+{
+  boost::optional<ResultView> F0 = pathFlow0View(nr);
+  boost::optional<ResultView> F1 = pathFlow1View(nr);
+  if(!F0 || !F1)
+  {
+    return boost::optional<double>();
+  }
+  double peak = 0.0;
+  for(unsigned i=0;i<F0->size();i++)
+  {
+    peak = std::max(peak, fabs((*F0)[i] + (*F1)[i]));
+  }
+  return boost::optional<double>(peak);
 }
 
 static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inputDateTimes,
-                                          std::vector<double> inputValues, std::string units)
+                                          const ResultView &inputValues, std::string units)
 {
   // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data
   std::vector<openstudio::DateTime> dateTimes;
   std::vector<double> values;
   if(inputDateTimes.size()==1) // Account for steady simulation results
   {
-    return openstudio::TimeSeries(inputDateTimes,createVector(inputValues),units);
+    return openstudio::TimeSeries(inputDateTimes,createVector(inputValues.toStdVector()),units);
   }
   for(unsigned i=1;i<inputDateTimes.size();i++)
   {
@@ -349,87 +541,87 @@ static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inpu
   return openstudio::TimeSeries(dateTimes,createVector(values),units);
 }
 
-
 boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
-  if(index == -1)
+  boost::optional<ResultView> view = pathDeltaPView(nr);
+  if(!view)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_dP[index],"Pa");
+  openstudio::TimeSeries series = convertData(m_dateTimes,*view,"Pa");
   return boost::optional<openstudio::TimeSeries>(series);
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow0(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
-  if(index == -1)
+  boost::optional<ResultView> view = pathFlow0View(nr);
+  if(!view)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_F0[index],"kg/s");
+  openstudio::TimeSeries series = convertData(m_dateTimes,*view,"kg/s");
   return boost::optional<openstudio::TimeSeries>(series);
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow1(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
-  if(index == -1)
+  boost::optional<ResultView> view = pathFlow1View(nr);
+  if(!view)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_F1[index],"kg/s");
+  openstudio::TimeSeries series = convertData(m_dateTimes,*view,"kg/s");
   return boost::optional<openstudio::TimeSeries>(series);
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
-  if(index == -1)
+  boost::optional<ResultView> F0 = pathFlow0View(nr);
+  boost::optional<ResultView> F1 = pathFlow1View(nr);
+  if(!F0 || !F1)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  std::vector<double> flow(m_dateTimes.size());
-  for(unsigned i=0;i<m_dateTimes.size();i++)
+  std::vector<double> flow(F0->size());
+  for(unsigned i=0;i<flow.size();i++)
   {
-    flow[i] = m_F0[index][i] + m_F1[index][i];
+    flow[i] = (*F0)[i] + (*F1)[i];
   }
   // Need to confirm that the total flow is F0+F1, since it also could be F0-F1
-  openstudio::TimeSeries series = convertData(m_dateTimes,flow,"kg/s");
+  openstudio::TimeSeries series = convertData(m_dateTimes,ResultView(flow.data(),flow.size(),1),"kg/s");
   return boost::optional<openstudio::TimeSeries>(series);
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodeTemperature(int nr) const
 {
-  int index = m_nodeNr.indexOf(nr);
-  if(index == -1)
+  boost::optional<ResultView> view = nodeTemperatureView(nr);
+  if(!view)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_T[index],"K");
+  openstudio::TimeSeries series = convertData(m_dateTimes,*view,"K");
   return boost::optional<openstudio::TimeSeries>(series);
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodePressure(int nr) const
 {
-  int index = m_nodeNr.indexOf(nr);
-  if(index == -1)
+  boost::optional<ResultView> view = nodePressureView(nr);
+  if(!view)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_P[index],"Pa");
+  openstudio::TimeSeries series = convertData(m_dateTimes,*view,"Pa");
   return boost::optional<openstudio::TimeSeries>(series);
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodeDensity(int nr) const
 {
-  int index = m_nodeNr.indexOf(nr);
-  if(index == -1)
+  boost::optional<ResultView> view = nodeDensityView(nr);
+  if(!view)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_D[index],"kg/m^3");
+  openstudio::TimeSeries series = convertData(m_dateTimes,*view,"kg/m^3");
   return boost::optional<openstudio::TimeSeries>(series);
 }
 
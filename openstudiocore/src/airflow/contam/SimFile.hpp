@@ -42,36 +42,124 @@
 namespace openstudio {
 namespace contam {
 
+/** ResultView is a non-owning, strided view of SimFile results. A view of a single path or node over time steps
+ *  through a column of the time x element result matrix, and a view of all paths or nodes at a single time is a
+ *  row. Views are only valid as long as the SimFile they were taken from. */
+class AIRFLOW_API ResultView {
+public:
+  ResultView(const double *data, unsigned size, unsigned stride) : m_data(data), m_size(size), m_stride(stride)
+  {}
+
+  /** Returns the number of values in the view. */
+  unsigned size() const
+  {
+    return m_size;
+  }
+  /** Returns the ith value in the view. */
+  double operator[](unsigned i) const
+  {
+    return m_data[i*m_stride];
+  }
+
+  /** Returns the sum of the values in the view. */
+  double sum() const;
+  /** Returns the largest value in the view. */
+  double max() const;
+  /** Returns the smallest value in the view. */
+  double min() const;
+  /** Copies the values in the view into a vector. */
+  std::vector<double> toStdVector() const;
+
+private:
+  const double *m_data;
+  unsigned m_size;
+  unsigned m_stride;
+};
+
 class AIRFLOW_API SimFile {
 public:
   explicit SimFile(openstudio::path path);
 
-  // These are provided for advanced use
+  // These are provided for advanced use, and copy the results out one path or node at a time
   std::vector<std::vector<double> > dP() const
   {
-    return m_dP;
+    return columns(m_dP, m_pathNr.size());
   }
   std::vector<std::vector<double> > F0() const
   {
-    return m_F0;
+    return columns(m_F0, m_pathNr.size());
   }
   std::vector<std::vector<double> > F1() const
   {
-    return m_F1;
+    return columns(m_F1, m_pathNr.size());
   }
   std::vector<std::vector<double> > T() const
   {
-    return m_T;
+    return columns(m_T, m_nodeNr.size());
   }
   std::vector<std::vector<double> > P() const
   {
-    return m_P;
+    return columns(m_P, m_nodeNr.size());
   }
   std::vector<std::vector<double> > D() const
   {
-    return m_D;
+    return columns(m_D, m_nodeNr.size());
+  }
+
+  /** Returns the CONTAM path numbers in the order that they are stored in each result row. */
+  std::vector<int> pathNrs() const
+  {
+    return m_pathNr.toStdVector();
+  }
+  /** Returns the CONTAM node numbers in the order that they are stored in each result row. */
+  std::vector<int> nodeNrs() const
+  {
+    return m_nodeNr.toStdVector();
   }
 
+  /** @name Zero-copy Access */
+  //@{
+
+  /** Returns a view of the pressure difference across path nr at each time in the file. */
+  boost::optional<ResultView> pathDeltaPView(int nr) const;
+  /** Returns a view of flow 0 through path nr at each time in the file. */
+  boost::optional<ResultView> pathFlow0View(int nr) const;
+  /** Returns a view of flow 1 through path nr at each time in the file. */
+  boost::optional<ResultView> pathFlow1View(int nr) const;
+  /** Returns a view of the temperature of node nr at each time in the file. */
+  boost::optional<ResultView> nodeTemperatureView(int nr) const;
+  /** Returns a view of the pressure of node nr at each time in the file. */
+  boost::optional<ResultView> nodePressureView(int nr) const;
+  /** Returns a view of the density of node nr at each time in the file. */
+  boost::optional<ResultView> nodeDensityView(int nr) const;
+  /** Returns a view of the pressure difference across every path at time index i, in pathNrs order. */
+  boost::optional<ResultView> pathDeltaPAt(unsigned i) const;
+  /** Returns a view of flow 0 through every path at time index i, in pathNrs order. */
+  boost::optional<ResultView> pathFlow0At(unsigned i) const;
+  /** Returns a view of flow 1 through every path at time index i, in pathNrs order. */
+  boost::optional<ResultView> pathFlow1At(unsigned i) const;
+  /** Returns a view of the temperature of every node at time index i, in nodeNrs order. */
+  boost::optional<ResultView> nodeTemperatureAt(unsigned i) const;
+  /** Returns a view of the pressure of every node at time index i, in nodeNrs order. */
+  boost::optional<ResultView> nodePressureAt(unsigned i) const;
+  /** Returns a view of the density of every node at time index i, in nodeNrs order. */
+  boost::optional<ResultView> nodeDensityAt(unsigned i) const;
+
+  //@}
+  /** @name Reductions */
+  //@{
+
+  /** Returns the net mass in kg that passed through each path over the file, in pathNrs order. The flow
+   *  is integrated with the trapezoidal rule, which matches the interval averaging of the TimeSeries results. */
+  std::vector<double> pathTotalFlows() const;
+  /** Returns the largest absolute total flow in kg/s through each path, in pathNrs order. */
+  std::vector<double> pathPeakFlows() const;
+  /** Returns the net mass in kg that passed through path nr over the file. */
+  boost::optional<double> pathTotalFlow(int nr) const;
+  /** Returns the largest absolute total flow in kg/s through path nr. */
+  boost::optional<double> pathPeakFlow(int nr) const;
+
+  //@}
 
   // Most use should be confined to these
   boost::optional<openstudio::TimeSeries> pathDeltaP(int nr) const;
@@ -98,16 +186,22 @@ private:
   bool readLfr(QString fileName);
   void clearNfr();
   bool readNfr(QString fileName);
+  bool readResults(QString fileName, const char *type, bool nodes, std::vector<double> &v0, std::vector<double> &v1,
+    std::vector<double> &v2, QVector<int> &nrs, QVector<QString> &day, QVector<QString> &time);
   bool computeDateTimes(QVector<QString> day, QVector<QString> time);
+  std::vector<std::vector<double> > columns(const std::vector<double> &data, unsigned ncols) const;
+  boost::optional<ResultView> column(const std::vector<double> &data, const QVector<int> &nrs, int nr) const;
+  boost::optional<ResultView> row(const std::vector<double> &data, unsigned ncols, unsigned i) const;
 
+  // Results are stored row-major, one row per time and one column per path or node
   QVector<int> m_pathNr;  // the CONTAM path index
-  std::vector<std::vector<double> > m_dP;
-  std::vector<std::vector<double> > m_F0;
-  std::vector<std::vector<double> > m_F1;
+  std::vector<double> m_dP;
+  std::vector<double> m_F0;
+  std::vector<double> m_F1;
   QVector<int> m_nodeNr;  // the CONTAM node index
-  std::vector<std::vector<double> > m_T;
-  std::vector<std::vector<double> > m_P;
-  std::vector<std::vector<double> > m_D;
+  std::vector<double> m_T;
+  std::vector<double> m_P;
+  std::vector<double> m_D;
   std::vector<openstudio::DateTime> m_dateTimes;
 
   bool m_hasLfr;
@@ -29,6 +29,7 @@
 
 require 'json'
 require 'erb'
+require 'fileutils'
 require 'openstudio'
 
 class MeasureInfoBinding
@@ -79,12 +80,18 @@ class MeasureManager
 
   attr_reader :osms, :measures, :measure_info
 
-  def initialize(logger=nil)
+  def initialize(logger=nil, cache_dir=nil)
     @logger = logger
     @osms = {} # osm_path => {:checksum, :model, :workspace}
     @idfs = {} # idf_path => {:checksum, :workspace}
     @measures = {} # measure_dir => BCLMeasure
     @measure_info = {} # measure_dir => {osm_path => RubyUserScriptInfo}
+    @cache_dir = cache_dir # directory of persisted measure hashes with computed arguments, nil to disable
+
+    if @cache_dir
+      @cache_dir = File.expand_path(@cache_dir)
+      FileUtils.mkdir_p(@cache_dir)
+    end
 
     eval(OpenStudio::Ruleset::infoExtractorRubyFunction)
   end
@@ -391,6 +398,143 @@ class MeasureManager
     return result
   end
 
+  # returns the absolute path with symlinks resolved, the same file reached through different paths or
+  # from different working directories must give the same cache key
+  def canonical_path(path)
+    path = File.expand_path(path)
+    begin
+      path = File.realpath(path)
+    rescue
+    end
+    return path
+  end
+
+  # returns a string identifying the size, modification time and inode of every file in measure_dir, or nil if a
+  # file was modified too recently for its time stamp to be trusted, used instead of file checksums so that
+  # persisted results can be found without loading the measure
+  def measure_stamp(measure_dir)
+    now = Time.now
+    result = []
+    Dir.glob(File.join(measure_dir, '**', '*'), File::FNM_DOTMATCH).sort.each do |path|
+      next if !File.file?(path)
+      stat = File.stat(path)
+
+      # a file written again within the resolution of the file system time stamps would not change its stamp
+      return nil if (now - stat.mtime) < 2
+
+      mtime = stat.mtime.to_i * 1000000000 + stat.mtime.nsec
+      result << "#{path.sub(measure_dir, '')}=#{stat.size}:#{mtime}:#{stat.ino}"
+    end
+    return result.join("\n")
+  end
+
+  # returns the key identifying a persisted result of kind ('measure' or 'arguments') for measure_dir and model_path
+  def cache_key(kind, measure_dir, model_path)
+    measure_dir = canonical_path(measure_dir)
+    model_path = canonical_path(model_path) if !model_path.empty?
+
+    stamp = measure_stamp(measure_dir)
+    return nil if stamp.nil?
+
+    key = [OpenStudio::openStudioLongVersion, kind, measure_dir, stamp]
+
+    key << model_path
+    if !model_path.empty?
+      if !File.exist?(model_path)
+        return nil
+      end
+      key << OpenStudio::checksum(OpenStudio::toPath(model_path))
+    end
+
+    return key.join("\n")
+  end
+
+  def cache_path(key)
+    return File.join(@cache_dir, "#{OpenStudio::checksum(key)}.json")
+  end
+
+  # returns nil or the measure hash persisted under kind for measure_dir and model_path
+  def read_cache(kind, measure_dir, model_path)
+    return nil if @cache_dir.nil?
+
+    key = cache_key(kind, measure_dir, model_path)
+    return nil if key.nil?
+
+    path = cache_path(key)
+    return nil if !File.exist?(path)
+
+    begin
+      data = JSON.parse(File.read(path, :encoding => 'utf-8'), {:symbolize_names=>true})
+
+      # file name is only a short checksum, full key guards against collisions
+      if data[:key] == key
+        print_message("Using persisted #{kind} for '#{measure_dir}', '#{model_path}'")
+        result = force_encoding(data[:measure_hash], 'utf-8')
+
+        # the same measure may be reached through another path
+        result[:measure_dir] = measure_dir
+        return result
+      end
+    rescue => e
+      print_message("Failed to read persisted #{kind} '#{path}': #{e.message}")
+    end
+
+    return nil
+  end
+
+  # persist measure hash under kind for measure_dir and model_path, see read_cache
+  def write_cache(kind, measure_dir, model_path, hash)
+    return if @cache_dir.nil?
+
+    key = cache_key(kind, measure_dir, model_path)
+    return if key.nil?
+
+    path = cache_path(key)
+    begin
+      # write to temporary file and rename so concurrent readers never see a partial file
+      temp_path = "#{path}.#{Process.pid}.tmp"
+      File.open(temp_path, 'w') do |file|
+        file << JSON.generate({:key => key, :measure_hash => hash})
+      end
+      File.rename(temp_path, path)
+    rescue => e
+      print_message("Failed to persist #{kind} '#{path}': #{e.message}")
+    end
+  end
+
+  # returns nil or measure hash with computed arguments from the persistent cache
+  # model_path is an osm or idf path, or empty if arguments were computed without a model
+  def get_cached_measure_hash(measure_dir, model_path)
+    return read_cache('arguments', measure_dir, model_path)
+  end
+
+  # persist measure hash computed from measure_info, see get_cached_measure_hash
+  def set_cached_measure_hash(measure_dir, model_path, measure_info, hash)
+    # do not persist failures to load the ruby measure, these may be transient
+    return if measure_info.error.is_initialized
+
+    write_cache('arguments', measure_dir, model_path, hash)
+  end
+
+  # returns nil or measure hash for the measure in measure_dir, as from measure_hash(measure_dir, get_measure(measure_dir))
+  # the persistent cache is checked first so an unchanged measure is not loaded or updated on a cold start
+  def get_measure_hash(measure_dir, force_reload)
+    if !force_reload
+      result = read_cache('measure', measure_dir, "")
+      return result if result
+    end
+
+    measure = get_measure(measure_dir, force_reload)
+    return nil if measure.nil?
+
+    result = measure_hash(measure_dir, measure)
+
+    # get_measure has written any updates, the stamp is taken after them
+    write_cache('measure', measure_dir, "", result) if !measure.error.is_initialized
+
+    return result
+  end
+
   def get_arguments_from_measure(measure_dir, measure)
     result = []
 
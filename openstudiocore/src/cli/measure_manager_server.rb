@@ -36,11 +36,11 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
 
   @@instance = nil
 
-  def initialize(server)
+  def initialize(server, cache_dir = nil)
     super
     @mutex = Mutex.new
     #print_message("new @mutex = #{@mutex}")
-    @measure_manager = MeasureManager.new
+    @measure_manager = MeasureManager.new(nil, cache_dir)
   end
 
   def print_message(message)
@@ -190,11 +190,11 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
           measure_dir = File.expand_path(measure_dir)
           if File.directory?(measure_dir)
 
-            measure = @measure_manager.get_measure(measure_dir, force_reload)
-            if measure.nil?
+            hash = @measure_manager.get_measure_hash(measure_dir, force_reload)
+            if hash.nil?
               print_message("Directory #{measure_dir} is not a measure")
             else
-              result << @measure_manager.measure_hash(measure_dir, measure)
+              result << hash
             end
           end
         end
@@ -216,11 +216,11 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
           measure_dir = File.expand_path(measure_dir)
           if File.directory?(measure_dir)
 
-            measure = @measure_manager.get_measure(measure_dir, force_reload)
-            if measure.nil?
+            hash = @measure_manager.get_measure_hash(measure_dir, force_reload)
+            if hash.nil?
               print_message("Directory #{measure_dir} is not a measure")
             else
-              result << @measure_manager.measure_hash(measure_dir, measure)
+              result << hash
             end
           end
         end
@@ -235,29 +235,43 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
         force_reload = data[:force_reload] ? data[:force_reload] : false
 
         measure_dir = File.expand_path(measure_dir)
-        measure = @measure_manager.get_measure(measure_dir, force_reload)
-        if measure.nil?
-          raise "Cannot load measure at '#{measure_dir}'"
-        end
 
-        model = OpenStudio::Model::OptionalModel.new()
-        workspace = OpenStudio::OptionalWorkspace.new()
         if osm_path
           osm_path = File.expand_path(osm_path)
-          value = @measure_manager.get_model(osm_path, force_reload)
-          if value.nil?
-            raise "Cannot load model at '#{osm_path}'"
-          else
-            model = value[0].clone(true).to_Model
-            workspace = value[1].clone(true)
-          end
         else
           osm_path = ""
         end
 
-        info = @measure_manager.get_measure_info(measure_dir, measure, osm_path, model, workspace)
+        # persisted result avoids loading the measure and the model and running the measure
+        result = nil
+        if !force_reload
+          result = @measure_manager.get_cached_measure_hash(measure_dir, osm_path)
+        end
 
-        result = @measure_manager.measure_hash(measure_dir, measure, info)
+        if result.nil?
+          measure = @measure_manager.get_measure(measure_dir, force_reload)
+          if measure.nil?
+            raise "Cannot load measure at '#{measure_dir}'"
+          end
+
+          model = OpenStudio::Model::OptionalModel.new()
+          workspace = OpenStudio::OptionalWorkspace.new()
+          if !osm_path.empty?
+            value = @measure_manager.get_model(osm_path, force_reload)
+            if value.nil?
+              raise "Cannot load model at '#{osm_path}'"
+            else
+              model = value[0].clone(true).to_Model
+              workspace = value[1].clone(true)
+            end
+          end
+
+          info = @measure_manager.get_measure_info(measure_dir, measure, osm_path, model, workspace)
+
+          result = @measure_manager.measure_hash(measure_dir, measure, info)
+
+          @measure_manager.set_cached_measure_hash(measure_dir, osm_path, info, result)
+        end
 
         response.body = JSON.generate(result)
 
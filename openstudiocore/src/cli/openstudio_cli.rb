@@ -1182,6 +1182,9 @@ class Measure
         options[:start_server] = true
         options[:start_server_port] = port
       end
+      o.on('-c', '--cache_dir DIRECTORY', 'Persist measure information and computed arguments in directory, reused while measure and model are unchanged') do |cache_dir|
+        options[:cache_dir] = cache_dir
+      end
       # TODO: run unit tests
     end
     
@@ -1202,17 +1205,17 @@ class Measure
     $logger.debug("Directory to examine is #{directory}")
 
     if options[:update_all]
-      measure_manager = MeasureManager.new($logger)
+      measure_manager = MeasureManager.new($logger, options[:cache_dir])
 
       # loop over all directories
       result = []
       Dir.glob("#{directory}/*/").each do |measure_dir|
         if File.directory?(measure_dir) && File.exists?(File.join(measure_dir, "measure.xml"))
-          measure = measure_manager.get_measure(measure_dir, true)
-          if measure.nil?
+          hash = measure_manager.get_measure_hash(measure_dir, false)
+          if hash.nil?
             $logger.debug("Directory #{measure_dir} is not a measure")
           else
-            result << measure_manager.measure_hash(measure_dir, measure)
+            result << hash
           end
         end
       end
@@ -1220,26 +1223,33 @@ class Measure
       safe_puts JSON.generate(result)
 
     elsif options[:update]
-      measure_manager = MeasureManager.new($logger)
-      measure = measure_manager.get_measure(directory, true)
-      if measure.nil?
+      measure_manager = MeasureManager.new($logger, options[:cache_dir])
+      hash = measure_manager.get_measure_hash(directory, false)
+      if hash.nil?
         $logger.error("Cannot load measure from '#{directory}'")
         return 1
       end
 
-      hash = measure_manager.measure_hash(directory, measure)
       safe_puts JSON.generate(hash)
 
     elsif options[:compute_arguments]
-      measure_manager = MeasureManager.new($logger)
+      measure_manager = MeasureManager.new($logger, options[:cache_dir])
+
+      model_path = options[:compute_arguments_model]
+      model_path = File.expand_path(model_path) if model_path
+
+      hash = measure_manager.get_cached_measure_hash(directory, model_path ? model_path : "")
+      if hash
+        safe_puts JSON.generate(hash)
+        return 0
+      end
+
       measure = measure_manager.get_measure(directory, true)
       if measure.nil?
         $logger.error("Cannot load measure from '#{directory}'")
         return 1
       end
 
-      model_path = options[:compute_arguments_model]
-
       model = OpenStudio::Model::OptionalModel.new()
       workspace = OpenStudio::OptionalWorkspace.new()
       if model_path
@@ -1277,6 +1287,7 @@ class Measure
       measure_info = measure_manager.get_measure_info(directory, measure, model_path, model, workspace)
 
       hash = measure_manager.measure_hash(directory, measure, measure_info)
+      measure_manager.set_cached_measure_hash(directory, model_path, measure_info, hash)
       safe_puts JSON.generate(hash)
 
     elsif options[:run_tests]
@@ -1318,7 +1329,7 @@ class Measure
 
       server = WEBrick::HTTPServer.new(:Port => port)
 
-      server.mount "/", MeasureManagerServlet
+      server.mount "/", MeasureManagerServlet, options[:cache_dir]
 
       trap("INT") {
           server.shutdown
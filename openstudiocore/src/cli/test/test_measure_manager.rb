@@ -0,0 +1,126 @@
+require 'minitest/autorun'
+require 'openstudio'
+require 'logger'
+require 'tmpdir'
+
+require_relative '../measure_manager'
+
+# test that measure information and computed arguments persisted by one measure manager are used by the next
+class MeasureManager_Test < Minitest::Test
+
+  def setup
+    @dir = Dir.mktmpdir('measure_manager')
+    @cache_dir = File.join(@dir, 'cache')
+    @measure_dir = File.join(@dir, 'NewMeasure')
+    @osm_path = File.join(@dir, 'model.osm')
+
+    OpenStudio::BCLMeasure.new("NewMeasure", "NewMeasure", @measure_dir, "Envelope.Form", "ModelMeasure".to_MeasureType, "No description", "No modeler description")
+    OpenStudio::Model::exampleModel.save(@osm_path, true)
+  end
+
+  def teardown
+    FileUtils.rm_rf(@dir)
+  end
+
+  # files written less than two seconds ago are not trusted by the cache
+  def backdate(dir)
+    time = Time.now - 10
+    Dir.glob(File.join(dir, '**', '*'), File::FNM_DOTMATCH).each do |path|
+      File.utime(time, time, path) if File.file?(path)
+    end
+  end
+
+  # measure manager that fails the test if it loads the measure, the model or runs the measure
+  def cold_manager
+    manager = MeasureManager.new(Logger.new(nil), @cache_dir)
+    [:get_measure, :get_measure_info, :get_model, :get_idf].each do |method|
+      manager.define_singleton_method(method) do |*args|
+        raise "#{method} called for persisted result"
+      end
+    end
+    return manager
+  end
+
+  def compute_arguments(manager, osm_path)
+    measure = manager.get_measure(@measure_dir, false)
+    model = OpenStudio::Model::OptionalModel.new
+    workspace = OpenStudio::OptionalWorkspace.new
+    if !osm_path.empty?
+      value = manager.get_model(osm_path, false)
+      model = value[0].clone(true).to_Model
+      workspace = value[1].clone(true)
+    end
+    info = manager.get_measure_info(@measure_dir, measure, osm_path, model, workspace)
+    result = manager.measure_hash(@measure_dir, measure, info)
+    manager.set_cached_measure_hash(@measure_dir, osm_path, info, result)
+    return result
+  end
+
+  def test_restart
+    # first run updates the measure, updated files are too new to be persisted
+    manager = MeasureManager.new(Logger.new(nil), @cache_dir)
+    refute_nil(manager.get_measure_hash(@measure_dir, false))
+    backdate(@dir)
+
+    manager = MeasureManager.new(Logger.new(nil), @cache_dir)
+    measure_hash = manager.get_measure_hash(@measure_dir, false)
+    refute_nil(measure_hash)
+    arguments = compute_arguments(manager, "")
+    model_arguments = compute_arguments(manager, @osm_path)
+
+    # restarted manager computes nothing
+    manager = cold_manager
+    assert_equal(JSON.generate(measure_hash), JSON.generate(manager.get_measure_hash(@measure_dir, false)))
+    assert_equal(JSON.generate(arguments), JSON.generate(manager.get_cached_measure_hash(@measure_dir, "")))
+    assert_equal(JSON.generate(model_arguments), JSON.generate(manager.get_cached_measure_hash(@measure_dir, @osm_path)))
+
+    # relative paths find the same entries
+    Dir.chdir(@dir) do
+      refute_nil(manager.get_measure_hash('NewMeasure', false))
+      refute_nil(manager.get_cached_measure_hash('NewMeasure', 'model.osm'))
+    end
+
+    # force_reload bypasses the persisted result
+    assert_raises(RuntimeError) { manager.get_measure_hash(@measure_dir, true) }
+  end
+
+  def test_changes
+    manager = MeasureManager.new(Logger.new(nil), @cache_dir)
+    manager.get_measure_hash(@measure_dir, false)
+    backdate(@dir)
+    manager = MeasureManager.new(Logger.new(nil), @cache_dir)
+    manager.get_measure_hash(@measure_dir, false)
+    compute_arguments(manager, @osm_path)
+
+    manager = cold_manager
+    refute_nil(manager.get_measure_hash(@measure_dir, false))
+    refute_nil(manager.get_cached_measure_hash(@measure_dir, @osm_path))
+
+    # editing the measure or the model misses the cache
+    File.open(File.join(@measure_dir, 'measure.rb'), 'a') { |file| file << "\n# edited\n" }
+    backdate(@measure_dir)
+    assert_nil(manager.get_cached_measure_hash(@measure_dir, @osm_path))
+    assert_raises(RuntimeError) { manager.get_measure_hash(@measure_dir, false) }
+
+    # the next run picks up the edit and updates measure.xml
+    manager = MeasureManager.new(Logger.new(nil), @cache_dir)
+    manager.get_measure_hash(@measure_dir, false)
+    backdate(@dir)
+    manager = MeasureManager.new(Logger.new(nil), @cache_dir)
+    compute_arguments(manager, "")
+    compute_arguments(manager, @osm_path)
+    manager = cold_manager
+    refute_nil(manager.get_cached_measure_hash(@measure_dir, ""))
+    refute_nil(manager.get_cached_measure_hash(@measure_dir, @osm_path))
+
+    model = OpenStudio::Model::Model.load(OpenStudio::toPath(@osm_path)).get
+    OpenStudio::Model::Space.new(model)
+    model.save(@osm_path, true)
+    assert_nil(manager.get_cached_measure_hash(@measure_dir, @osm_path))
+
+    # a file that was just written is not trusted
+    File.open(File.join(@measure_dir, 'measure.rb'), 'a') { |file| file << "\n# edited again\n" }
+    assert_nil(manager.get_cached_measure_hash(@measure_dir, ""))
+  end
+
+end
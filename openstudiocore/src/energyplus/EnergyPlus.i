@@ -47,6 +47,12 @@
 %ignore openstudio::energyplus::detail::ForwardTranslatorInitializer;
 
 %include <energyplus/ErrorFile.hpp>
+
+// no default constructors
+%ignore std::vector<openstudio::energyplus::ErrorFileMessage>::vector(size_type);
+%ignore std::vector<openstudio::energyplus::ErrorFileMessage>::resize(size_type);
+
+%template(ErrorFileMessageVector) std::vector<openstudio::energyplus::ErrorFileMessage>;
 %include <energyplus/ForwardTranslator.hpp>
 %include <energyplus/ReverseTranslator.hpp>
 
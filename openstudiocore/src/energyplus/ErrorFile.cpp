@@ -29,12 +29,159 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <unordered_map>
+
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    // same characters as \s in the regular expressions this scanner replaced
+    bool isSpace(char c)
+    {
+      return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+    }
+
+    size_t skipSpace(const std::string& line, size_t i)
+    {
+      while ((i < line.size()) && isSpace(line[i])){
+        ++i;
+      }
+      return i;
+    }
+
+    size_t skipStars(const std::string& line, size_t i)
+    {
+      while ((i < line.size()) && (line[i] == '*')){
+        ++i;
+      }
+      return i;
+    }
+
+    bool hasStarStar(const std::string& line, size_t i)
+    {
+      return ((i + 1) < line.size()) && (line[i] == '*') && (line[i + 1] == '*');
+    }
+
+    // matches the tail of a message line starting at the "**" found at pos, "** <type> **<rest>"
+    // returns true and sets type and rest (offset into line) on success
+    bool scanMessageTail(const std::string& line, size_t pos, std::string& type, size_t& rest)
+    {
+      size_t i = skipSpace(line, pos + 2);
+      size_t typeBegin = i;
+      while ((i < line.size()) && !isSpace(line[i]) && (line[i] != '*')){
+        ++i;
+      }
+      if (i == typeBegin){
+        return false;
+      }
+      size_t typeEnd = i;
+      i = skipSpace(line, i);
+      if (!hasStarStar(line, i)){
+        return false;
+      }
+      type.assign(line, typeBegin, typeEnd - typeBegin);
+      rest = i + 2;
+      return true;
+    }
+
+    // scans "<ws><stars><ws>** <type> **<rest>", the two candidate positions of the leading "**" are tried
+    // in the order a backtracking regex would try them
+    bool scanMessage(const std::string& line, std::string& type, size_t& rest)
+    {
+      size_t i = skipSpace(line, 0);
+      size_t j = skipStars(line, i);
+      size_t k = skipSpace(line, j);
+      if ((k > j) && hasStarStar(line, k) && scanMessageTail(line, k, type, rest)){
+        return true;
+      }
+      if ((i > 0) && hasStarStar(line, i) && scanMessageTail(line, i, type, rest)){
+        return true;
+      }
+      return false;
+    }
+
+    // scans "<ws><stars> <text>..." where text must follow the stars directly
+    bool scanBanner(const std::string& line, const char* text)
+    {
+      size_t i = skipSpace(line, 0);
+      size_t j = skipStars(line, i);
+      if (j == i){
+        return false;
+      }
+      return line.compare(j, std::char_traits<char>::length(text), text) == 0;
+    }
+
+    bool scanGroundTempBanner(const std::string& line)
+    {
+      static const std::string prefix(" GroundTempCalc");
+      static const std::string suffix(" Completed Successfully");
+      size_t i = skipSpace(line, 0);
+      size_t j = skipStars(line, i);
+      if ((j == i) || (line.compare(j, prefix.size(), prefix) != 0)){
+        return false;
+      }
+      j += prefix.size();
+      while ((j < line.size()) && !isSpace(line[j])){
+        ++j;
+      }
+      return line.compare(j, suffix.size(), suffix) == 0;
+    }
+
+  }
+
+  ErrorFileMessage::ErrorFileMessage(const ErrorLevel& level, const std::string& message)
+    : m_level(level), m_message(message), m_count(1)
+  {}
+
+  ErrorLevel ErrorFileMessage::level() const
+  {
+    return m_level;
+  }
+
+  std::string ErrorFileMessage::message() const
+  {
+    return m_message;
+  }
+
+  unsigned ErrorFileMessage::count() const
+  {
+    return m_count;
+  }
+
+  std::string ErrorFileMessage::messageTemplate() const
+  {
+    std::string result;
+    result.reserve(m_message.size());
+    size_t i = 0;
+    while (i < m_message.size()){
+      size_t open = m_message.find('"', i);
+      size_t close = (open == std::string::npos) ? std::string::npos : m_message.find('"', open + 1);
+      if (close == std::string::npos){
+        result.append(m_message, i, std::string::npos);
+        break;
+      }
+      result.append(m_message, i, open - i);
+      result += "\"*\"";
+      i = close + 1;
+    }
+    return result;
+  }
+
+  boost::optional<std::string> ErrorFileMessage::objectName() const
+  {
+    size_t open = m_message.find('"');
+    if (open != std::string::npos){
+      size_t close = m_message.find('"', open + 1);
+      if (close != std::string::npos){
+        return m_message.substr(open + 1, close - open - 1);
+      }
+    }
+    return boost::none;
+  }
+
   /// constructor
   ErrorFile::ErrorFile(const openstudio::path& errPath)
     : m_completed(false), m_completedSuccessfully(false)
@@ -44,22 +191,38 @@ namespace energyplus {
     ifs.close();
   }
 
+  std::vector<ErrorFileMessage> ErrorFile::messages() const
+  {
+    return m_messages;
+  }
+
+  std::vector<ErrorFileMessage> ErrorFile::messages(const ErrorLevel& level) const
+  {
+    std::vector<ErrorFileMessage> result;
+    for (const ErrorFileMessage& message : m_messages){
+      if (message.level() == level){
+        result.push_back(message);
+      }
+    }
+    return result;
+  }
+
   /// get warnings
   std::vector<std::string> ErrorFile::warnings() const
   {
-    return m_warnings;
+    return messageStrings(ErrorLevel::Warning);
   }
 
   /// get severe errors
   std::vector<std::string> ErrorFile::severeErrors() const
   {
-    return m_severeErrors;
+    return messageStrings(ErrorLevel::Severe);
   }
 
   /// get fatal errors
   std::vector<std::string> ErrorFile::fatalErrors() const
   {
-    return m_fatalErrors;
+    return messageStrings(ErrorLevel::Fatal);
   }
 
 
@@ -75,92 +238,91 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is)
+  std::vector<std::string> ErrorFile::messageStrings(const ErrorLevel& level) const
   {
-    std::string line;
-
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([^\\s\\*]+)\\s*\\*\\*(.*)$");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
-
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
-
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
+    std::vector<std::string> result;
+    for (unsigned index : m_occurrences){
+      const ErrorFileMessage& message = m_messages[index];
+      if (message.level() == level){
+        result.push_back(message.m_message);
+      }
+    }
+    return result;
+  }
 
-    // repeat count
+  void ErrorFile::parse(openstudio::filesystem::ifstream& is)
+  {
+    // the error file is scanned by hand rather than with regular expressions, lines are of the form
+    //   "   ** <type> ** <message>"
+    //   "   **   ~~~   ** <continuation>"
+    //   "   ************* EnergyPlus Completed Successfully..."
 
+    // (level, message) to index into m_messages, only needed while parsing
+    std::unordered_map<std::string, unsigned> index;
 
-    // read the file line by line using regexes
-    while(std::getline(is, line)){
+    std::string line;
+    std::string type;
+    size_t rest;
 
-      boost::smatch matches;
+    // one line of look ahead is kept instead of seeking back in the stream
+    bool haveLine = static_cast<bool>(std::getline(is, line));
+    while(haveLine){
 
 //      LOG(Debug, "Parsing ErrorFile Line: " << line);
 
-
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)){
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second); boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second); boost::trim(warningOrErrorString);
+      if (scanMessage(line, type, rest)){
+        std::string warningOrErrorType = type;
+        std::string warningOrErrorString = line.substr(rest); boost::trim(warningOrErrorString);
 
         // read the rest of the multi line warning or error
         while(true){
-          std::streampos pos = is.tellg();
-          if (!std::getline(is, line)){
+          haveLine = static_cast<bool>(std::getline(is, line));
+          if (!haveLine){
             break;
           }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)){
-            std::string temp = std::string(matches[1].first, matches[1].second); boost::trim_right(temp);
+          if (scanMessage(line, type, rest) && (type == "~~~")){
+            std::string temp = line.substr(rest); boost::trim_right(temp);
             warningOrErrorString += "\n" + temp;
           }else{
-            // unget the line
-            is.seekg(pos);
             break;
           }
         }
 
         LOG(Trace, "Error parsed: " << warningOrErrorString);
 
-
-        // correctly sort warnings and errors
+        // collapse identical messages into one counted entry
         try{
           ErrorLevel level(warningOrErrorType);
 
-          switch(level.value()){
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
+          std::string key = level.valueName() + "\n" + warningOrErrorString;
+          auto it = index.find(key);
+          if (it == index.end()){
+            it = index.insert(std::make_pair(key, static_cast<unsigned>(m_messages.size()))).first;
+            m_messages.push_back(ErrorFileMessage(level, warningOrErrorString));
+          }else{
+            ++m_messages[it->second].m_count;
           }
+          m_occurrences.push_back(it->second);
 
         }catch(...){
           LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
         }
 
-      }else if (boost::regex_match(line, completedSuccessful)
-                || boost::regex_match(line, groundTempCompletedSuccessful)) {
+        // line already holds the next unparsed line
+        continue;
+
+      }else if (scanBanner(line, " EnergyPlus Completed Successfully")
+                || scanGroundTempBanner(line)) {
         m_completed = true;
         m_completedSuccessfully = true;
         break;
-      }else if (boost::regex_match(line, completedUnsuccessful)){
+      }else if (scanBanner(line, " EnergyPlus Terminated")){
         m_completed = true;
         m_completedSuccessfully = false;
         break;
       }
+
+      haveLine = static_cast<bool>(std::getline(is, line));
     }
 
   }
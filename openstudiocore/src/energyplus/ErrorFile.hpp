@@ -37,6 +37,8 @@
 #include "../utilities/core/Logger.hpp"
 
 
+#include <boost/optional.hpp>
+
 #include <string>
 #include <vector>
 
@@ -50,12 +52,51 @@ namespace energyplus {
       ((Severe))
       ((Fatal)) );
 
+  /** ErrorFileMessage is one unique warning or error in an EnergyPlus error file, together with the
+   *  number of times it was reported.  Identical messages at the same level share one entry. */
+  class ENERGYPLUS_API ErrorFileMessage {
+   public:
+
+    /// constructor
+    ErrorFileMessage(const ErrorLevel& level, const std::string& message);
+
+    /// get the error level
+    ErrorLevel level() const;
+
+    /// get the full message text, including continuation lines
+    std::string message() const;
+
+    /// number of times this message was reported
+    unsigned count() const;
+
+    /// get the message with each double quoted substring replaced by "*", messages that only differ
+    /// by the objects they refer to share the same template
+    std::string messageTemplate() const;
+
+    /// get the first double quoted substring of the message, usually the name of the offending object
+    boost::optional<std::string> objectName() const;
+
+   private:
+
+    friend class ErrorFile;
+
+    ErrorLevel m_level;
+    std::string m_message;
+    unsigned m_count;
+  };
+
   class ENERGYPLUS_API ErrorFile {
    public:
 
     /// constructor
     ErrorFile(const openstudio::path& errPath);
 
+    /// get unique messages of all levels, in order of first occurrence
+    std::vector<ErrorFileMessage> messages() const;
+
+    /// get unique messages of the given level, in order of first occurrence
+    std::vector<ErrorFileMessage> messages(const ErrorLevel& level) const;
+
     /// get warnings
     std::vector<std::string> warnings() const;
 
@@ -77,9 +118,12 @@ namespace energyplus {
 
     void parse(openstudio::filesystem::ifstream& is);
 
-    std::vector<std::string> m_warnings;
-    std::vector<std::string> m_severeErrors;
-    std::vector<std::string> m_fatalErrors;
+    std::vector<std::string> messageStrings(const ErrorLevel& level) const;
+
+    // unique messages in order of first occurrence
+    std::vector<ErrorFileMessage> m_messages;
+    // index into m_messages of every reported message, in file order
+    std::vector<unsigned> m_occurrences;
     bool m_completed;
     bool m_completedSuccessfully;
 
@@ -0,0 +1,106 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ForwardTranslationCache.hpp"
+
+#include "../model/Model_Impl.hpp"
+
+namespace openstudio {
+namespace energyplus {
+
+ForwardTranslationCache::ForwardTranslationCache(const model::Model& model)
+  : m_model(model)
+{
+  // the Workspace onChange follows every object change, addition and removal
+  m_model.getImpl<model::detail::Model_Impl>()->onChange.connect<ForwardTranslationCache, &ForwardTranslationCache::change>(this);
+}
+
+ForwardTranslationCache::~ForwardTranslationCache()
+{
+}
+
+model::Model ForwardTranslationCache::model() const
+{
+  return m_model;
+}
+
+ForwardTranslator& ForwardTranslationCache::forwardTranslator()
+{
+  return m_forwardTranslator;
+}
+
+Workspace ForwardTranslationCache::translateModel(ProgressBar* progressBar)
+{
+  if (m_workspace && !inTransaction()){
+    LOG(Debug, "Model has not changed since the last translation.");
+    return m_workspace->clone(true);
+  }
+
+  Workspace result = m_forwardTranslator.translateModel(m_model, progressBar);
+  if (inTransaction()){
+    m_workspace.reset();
+  }else{
+    m_workspace = result.clone(true);
+  }
+
+  return result;
+}
+
+bool ForwardTranslationCache::isDirty() const
+{
+  return (!m_workspace || inTransaction());
+}
+
+void ForwardTranslationCache::reset()
+{
+  m_workspace.reset();
+}
+
+std::vector<LogMessage> ForwardTranslationCache::warnings() const
+{
+  return m_forwardTranslator.warnings();
+}
+
+std::vector<LogMessage> ForwardTranslationCache::errors() const
+{
+  return m_forwardTranslator.errors();
+}
+
+bool ForwardTranslationCache::inTransaction() const
+{
+  return m_model.getImpl<model::detail::Model_Impl>()->inTransaction();
+}
+
+void ForwardTranslationCache::change()
+{
+  m_workspace.reset();
+}
+
+} // energyplus
+} // openstudio
@@ -0,0 +1,108 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef ENERGYPLUS_FORWARDTRANSLATIONCACHE_HPP
+#define ENERGYPLUS_FORWARDTRANSLATIONCACHE_HPP
+
+#include "EnergyPlusAPI.hpp"
+#include "ForwardTranslator.hpp"
+
+#include "../model/Model.hpp"
+
+#include "../utilities/idf/Workspace.hpp"
+#include "../utilities/core/Logger.hpp"
+
+#include <nano/nano_signal_slot.hpp>
+
+namespace openstudio {
+
+class ProgressBar;
+
+namespace energyplus {
+
+/** ForwardTranslationCache keeps the Workspace produced by the last translation of a Model and
+ *  returns a copy of it while the Model is unchanged, so repeated translations of an unchanged
+ *  Model are skipped. Any change to the Model, as reported by its onChange signal, discards the
+ *  cached Workspace and the next call to translateModel() translates the complete Model again.
+ *  Nothing is translated incrementally: the ForwardTranslator rewrites a copy of the Model
+ *  (combining spaces, removing orphans, copying space type loads and shading controls) before
+ *  translating it, so the IdfObjects of one changed ModelObject cannot be regenerated on their own. */
+class ENERGYPLUS_API ForwardTranslationCache : public Nano::Observer {
+ public:
+
+  explicit ForwardTranslationCache(const model::Model& model);
+
+  virtual ~ForwardTranslationCache();
+
+  /** The Model whose translation is cached. */
+  model::Model model() const;
+
+  /** The ForwardTranslator used to translate the Model. Call reset() after changing its options. */
+  ForwardTranslator& forwardTranslator();
+
+  /** Returns a copy of the cached Workspace if the Model has not changed since it was translated,
+   *  otherwise translates the complete Model. Nothing is cached while a WorkspaceTransaction is open
+   *  on the Model, its changes are only reported when it closes. */
+  Workspace translateModel(ProgressBar* progressBar=nullptr);
+
+  /** Returns true if the next call to translateModel() will translate the Model. */
+  bool isDirty() const;
+
+  /** Discards the cached Workspace. */
+  void reset();
+
+  /** Get warning messages generated by the last translation. */
+  std::vector<LogMessage> warnings() const;
+
+  /** Get error messages generated by the last translation. */
+  std::vector<LogMessage> errors() const;
+
+ private:
+
+  REGISTER_LOGGER("openstudio.energyplus.ForwardTranslationCache");
+
+  // no copies, the connection is made to this instance
+  ForwardTranslationCache(const ForwardTranslationCache& other);
+  ForwardTranslationCache& operator=(const ForwardTranslationCache& other);
+
+  bool inTransaction() const;
+
+  void change();
+
+  model::Model m_model;
+
+  ForwardTranslator m_forwardTranslator;
+
+  boost::optional<Workspace> m_workspace;
+};
+
+} // energyplus
+} // openstudio
+
+#endif // ENERGYPLUS_FORWARDTRANSLATIONCACHE_HPP
@@ -135,10 +135,8 @@ boost::optional<IdfObject> ForwardTranslator::translateLifeCycleCostParameters(
       sector = "Commercial";
     }
 
-    static boost::optional<IdfFile> usePriceEscalationFile;
-    if (!usePriceEscalationFile){
-     usePriceEscalationFile = findIdfFile(":/Resources/LCCusePriceEscalationDataSet2011.idf");
-    }
+    // loaded once, translators may run on several threads at once
+    static const boost::optional<IdfFile> usePriceEscalationFile = findIdfFile(":/Resources/LCCusePriceEscalationDataSet2011.idf");
     OS_ASSERT(usePriceEscalationFile);
 
     for (IdfObject object : usePriceEscalationFile->objects()){
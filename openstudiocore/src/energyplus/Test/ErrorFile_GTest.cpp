@@ -39,6 +39,8 @@
 #include <sstream>
 
 using openstudio::energyplus::ErrorFile;
+using openstudio::energyplus::ErrorFileMessage;
+using openstudio::energyplus::ErrorLevel;
 
 TEST_F(EnergyPlusFixture,ErrorFile_NoErrorsNoWarnings)
 {
@@ -115,3 +117,61 @@ TEST_F(EnergyPlusFixture,ErrorFile_WarningsAndCrash)
 }
 
 
+TEST_F(EnergyPlusFixture,ErrorFile_Messages)
+{
+  openstudio::path path = openstudio::toPath("./ErrorFile_Messages.err");
+  {
+    openstudio::filesystem::ofstream ofs(path);
+    ofs << "Program Version,EnergyPlus, Version 8.9.0" << std::endl;
+    ofs << "   ** Warning ** Node connection error for object=\"COIL 1\"" << std::endl;
+    ofs << "   **   ~~~   ** Check the node names." << std::endl;
+    ofs << "   ** Warning ** Node connection error for object=\"COIL 2\"" << std::endl;
+    ofs << "   **   ~~~   ** Check the node names." << std::endl;
+    ofs << "   ** Warning ** Node connection error for object=\"COIL 1\"" << std::endl;
+    ofs << "   **   ~~~   ** Check the node names." << std::endl;
+    ofs << "   ** Severe  ** Node connection error for object=\"COIL 1\"" << std::endl;
+    ofs << "   **   ~~~   ** Check the node names." << std::endl;
+    ofs << "   ** Warning ** Node connection error for object=\"COIL 1\"" << std::endl;
+    ofs << "   **   ~~~   ** Check the node names." << std::endl;
+    ofs << "   ** Warning ** Some missing fields have been filled with defaults." << std::endl;
+    ofs << "   ************* EnergyPlus Completed Successfully-- 5 Warning; 1 Severe Errors; Elapsed Time=00hr 00min  1.00sec" << std::endl;
+    ofs.close();
+  }
+
+  ErrorFile errorFile(path);
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+
+  // every occurrence is still reported, in file order
+  ASSERT_EQ(static_cast<unsigned>(5), errorFile.warnings().size());
+  EXPECT_EQ("Node connection error for object=\"COIL 2\"\n Check the node names.", errorFile.warnings()[1]);
+  EXPECT_EQ("Node connection error for object=\"COIL 1\"\n Check the node names.", errorFile.warnings()[3]);
+  ASSERT_EQ(static_cast<unsigned>(1), errorFile.severeErrors().size());
+
+  // identical messages at the same level are collapsed
+  std::vector<ErrorFileMessage> messages = errorFile.messages();
+  ASSERT_EQ(static_cast<unsigned>(4), messages.size());
+
+  EXPECT_EQ(ErrorLevel::Warning, messages[0].level().value());
+  EXPECT_EQ(static_cast<unsigned>(3), messages[0].count());
+  ASSERT_TRUE(messages[0].objectName());
+  EXPECT_EQ("COIL 1", messages[0].objectName().get());
+  EXPECT_EQ("Node connection error for object=\"*\"\n Check the node names.", messages[0].messageTemplate());
+
+  EXPECT_EQ(static_cast<unsigned>(1), messages[1].count());
+  ASSERT_TRUE(messages[1].objectName());
+  EXPECT_EQ("COIL 2", messages[1].objectName().get());
+  EXPECT_EQ(messages[0].messageTemplate(), messages[1].messageTemplate());
+
+  EXPECT_EQ(ErrorLevel::Severe, messages[2].level().value());
+  EXPECT_EQ(static_cast<unsigned>(1), messages[2].count());
+
+  EXPECT_EQ(static_cast<unsigned>(1), messages[3].count());
+  EXPECT_FALSE(messages[3].objectName());
+  EXPECT_EQ(messages[3].message(), messages[3].messageTemplate());
+
+  EXPECT_EQ(static_cast<unsigned>(3), errorFile.messages(ErrorLevel::Warning).size());
+  EXPECT_EQ(static_cast<unsigned>(1), errorFile.messages(ErrorLevel::Severe).size());
+  EXPECT_EQ(static_cast<unsigned>(0), errorFile.messages(ErrorLevel::Fatal).size());
+}
+
@@ -32,6 +32,7 @@
 
 #include "../ErrorFile.hpp"
 #include "../ForwardTranslator.hpp"
+#include "../ForwardTranslationCache.hpp"
 #include "../ReverseTranslator.hpp"
 
 #include "../../model/Model.hpp"
@@ -53,6 +54,7 @@
 #include "../../model/ThermalZone.hpp"
 #include "../../model/Space.hpp"
 #include "../../model/Lights.hpp"
+#include "../../model/LightsDefinition.hpp"
 #include "../../model/AirLoopHVAC.hpp"
 #include "../../model/Schedule.hpp"
 #include "../../model/ScheduleCompact.hpp"
@@ -78,6 +80,7 @@
 #include "../../utilities/sql/SqlFile.hpp"
 #include "../../utilities/idf/IdfFile.hpp"
 #include "../../utilities/idf/IdfObject.hpp"
+#include "../../utilities/idf/WorkspaceTransaction.hpp"
 #include <utilities/idd/Lights_FieldEnums.hxx>
 #include <utilities/idd/OS_Schedule_Compact_FieldEnums.hxx>
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
@@ -92,6 +95,7 @@
 
 #include <resources.hxx>
 
+#include <algorithm>
 #include <sstream>
 
 #include <vector>
@@ -750,3 +754,99 @@ TEST_F(EnergyPlusFixture, BadVariableName)
     EXPECT_TRUE(s == "Good Name" || s == "Bad, !Name") << s;
   }
 }
+
+TEST_F(EnergyPlusFixture, ForwardTranslationCache)
+{
+  Model model;
+  ThermalZone thermalZone(model);
+  Space space(model);
+  space.setThermalZone(thermalZone);
+
+  ForwardTranslationCache cache(model);
+  EXPECT_TRUE(cache.isDirty());
+  Workspace workspace1 = cache.translateModel();
+  EXPECT_FALSE(cache.isDirty());
+
+  // unchanged model is not translated again
+  Workspace workspace2 = cache.translateModel();
+  EXPECT_EQ(workspace1.numObjects(), workspace2.numObjects());
+  ASSERT_EQ(1u, workspace2.getObjectsByType(IddObjectType::Zone).size());
+
+  thermalZone.setName("Zone A");
+  EXPECT_TRUE(cache.isDirty());
+
+  Workspace workspace3 = cache.translateModel();
+  EXPECT_FALSE(cache.isDirty());
+  std::vector<WorkspaceObject> zones = workspace3.getObjectsByType(IddObjectType::Zone);
+  ASSERT_EQ(1u, zones.size());
+  EXPECT_EQ("Zone A", zones[0].name().get());
+
+  ForwardTranslator forwardTranslator;
+  EXPECT_EQ(forwardTranslator.translateModel(model).numObjects(), workspace3.numObjects());
+
+  // added and removed objects
+  ThermalZone thermalZone2(model);
+  EXPECT_TRUE(cache.isDirty());
+  EXPECT_EQ(forwardTranslator.translateModel(model).getObjectsByType(IddObjectType::Zone).size(),
+            cache.translateModel().getObjectsByType(IddObjectType::Zone).size());
+
+  thermalZone2.remove();
+  EXPECT_TRUE(cache.isDirty());
+  EXPECT_EQ(1u, cache.translateModel().getObjectsByType(IddObjectType::Zone).size());
+
+  // changes inside a transaction are only reported when it closes, nothing is cached meanwhile
+  {
+    WorkspaceTransaction transaction(model);
+    EXPECT_TRUE(cache.isDirty());
+    thermalZone.setName("Zone B");
+    zones = cache.translateModel().getObjectsByType(IddObjectType::Zone);
+    ASSERT_EQ(1u, zones.size());
+    EXPECT_EQ("Zone B", zones[0].name().get());
+    EXPECT_TRUE(cache.isDirty());
+  }
+  EXPECT_EQ("Zone A", thermalZone.nameString());
+  EXPECT_TRUE(cache.isDirty());
+  zones = cache.translateModel().getObjectsByType(IddObjectType::Zone);
+  ASSERT_EQ(1u, zones.size());
+  EXPECT_EQ("Zone A", zones[0].name().get());
+  EXPECT_FALSE(cache.isDirty());
+
+  cache.reset();
+  EXPECT_TRUE(cache.isDirty());
+  EXPECT_EQ(1u, cache.translateModel().getObjectsByType(IddObjectType::Zone).size());
+  EXPECT_FALSE(cache.isDirty());
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslationCache_MatchesTranslateModel)
+{
+  Model model = exampleModel();
+
+  ForwardTranslationCache cache(model);
+  cache.translateModel();
+  EXPECT_FALSE(cache.isDirty());
+
+  // space type loads are copied to each space during translation
+  std::vector<LightsDefinition> lightsDefinitions = model.getConcreteModelObjects<LightsDefinition>();
+  ASSERT_FALSE(lightsDefinitions.empty());
+  EXPECT_TRUE(lightsDefinitions[0].setWattsperSpaceFloorArea(12.5));
+
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  ASSERT_FALSE(spaces.empty());
+  spaces[0].setName("Renamed Space");
+  EXPECT_TRUE(cache.isDirty());
+
+  std::stringstream cacheIdf;
+  cacheIdf << cache.translateModel();
+
+  ForwardTranslator forwardTranslator;
+  std::stringstream freshIdf;
+  freshIdf << forwardTranslator.translateModel(model);
+
+  EXPECT_EQ(freshIdf.str(), cacheIdf.str());
+
+  // the cached result matches as well
+  EXPECT_FALSE(cache.isDirty());
+  std::stringstream cachedIdf;
+  cachedIdf << cache.translateModel();
+  EXPECT_EQ(freshIdf.str(), cachedIdf.str());
+}
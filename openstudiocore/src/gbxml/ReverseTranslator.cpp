@@ -71,7 +71,9 @@
 
 #include <QDomDocument>
 #include <QDomElement>
+#include <QFile>
 #include <QThread>
+#include <QXmlStreamReader>
 
 namespace openstudio {
 namespace gbxml {
@@ -107,23 +109,153 @@ namespace gbxml {
 
     m_idToObjectMap.clear();
 
+    m_idToElementMap.clear();
+
     boost::optional<openstudio::model::Model> result;
 
     if (openstudio::filesystem::exists(path)){
 
-      openstudio::filesystem::ifstream file(path, std::ios_base::binary);
-      if (file.is_open()) {
+      QFile file(toQString(path));
+      if (file.open(QFile::ReadOnly)) {
+
+        // the file is streamed twice so the whole document is never held in memory,
+        // first for everything but the surfaces and then for the surfaces
         QDomDocument doc;
-        doc.setContent(openstudio::filesystem::read_as_QByteArray(file));
-        file.close();
+        int numSurfaces = 0;
+        if (readIndexDocument(file, doc, numSurfaces)){
+          result = this->convert(doc);
+        }
+
+        if (result){
+          file.reset();
+          if (!translateSurfaces(file, numSurfaces, *result)){
+            result.reset();
+          }
+        }
+
+        if (result){
+          result->setFastNaming(false);
+        }
 
-        result = this->convert(doc);
+        file.close();
       }
     }
 
+    m_idToElementMap.clear();
+
     return result;
   }
 
+  QDomElement ReverseTranslator::readElement(QXmlStreamReader& reader, QDomDocument& doc, bool indexOnly, int& numSurfaces)
+  {
+    OS_ASSERT(reader.isStartElement());
+
+    QDomElement result;
+    std::vector<QDomElement> stack;
+
+    do {
+      if (reader.isStartElement()){
+        QString name = reader.qualifiedName().toString();
+
+        if (indexOnly){
+          if (name == "Surface"){
+            ++numSurfaces;
+            reader.skipCurrentElement();
+            continue;
+          }else if ((name == "PlanarGeometry") || (name == "ShellGeometry") || (name == "SpaceBoundary")){
+            reader.skipCurrentElement();
+            continue;
+          }
+        }
+
+        QDomElement element = doc.createElement(name);
+        for (const QXmlStreamAttribute& attribute : reader.attributes()){
+          element.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+        }
+
+        if (stack.empty()){
+          result = element;
+        }else{
+          stack.back().appendChild(element);
+        }
+        stack.push_back(element);
+
+        if (indexOnly && ((name == "Layer") || (name == "DaySchedule") || (name == "WeekSchedule"))){
+          m_idToElementMap.insert(std::make_pair(std::make_pair(name, element.attribute("id")), element));
+        }
+
+      }else if (reader.isEndElement()){
+        stack.pop_back();
+
+      }else if (reader.isCharacters() && !reader.isWhitespace()){
+        if (!stack.empty()){
+          stack.back().appendChild(doc.createTextNode(reader.text().toString()));
+        }
+      }
+    } while (!stack.empty() && !reader.atEnd() && (reader.readNext() != QXmlStreamReader::Invalid));
+
+    return result;
+  }
+
+  bool ReverseTranslator::readIndexDocument(QIODevice& device, QDomDocument& doc, int& numSurfaces)
+  {
+    numSurfaces = 0;
+
+    QXmlStreamReader reader(&device);
+    while (!reader.atEnd()){
+      if (reader.readNext() == QXmlStreamReader::StartElement){
+        doc.appendChild(readElement(reader, doc, true, numSurfaces));
+        break;
+      }
+    }
+
+    if (reader.hasError() || doc.documentElement().isNull()){
+      LOG(Error, "Could not read gbXML file: " << toString(reader.errorString()) << " at line " << reader.lineNumber());
+      return false;
+    }
+
+    return true;
+  }
+
+  bool ReverseTranslator::translateSurfaces(QIODevice& device, int numSurfaces, openstudio::model::Model& model)
+  {
+    if (m_progressBar){
+      m_progressBar->setWindowTitle(toString("Translating Surfaces"));
+      m_progressBar->setMinimum(0);
+      m_progressBar->setMaximum(numSurfaces);
+      m_progressBar->setValue(0);
+    }
+
+    int unused = 0;
+    QXmlStreamReader reader(&device);
+    while (!reader.atEnd()){
+      if ((reader.readNext() == QXmlStreamReader::StartElement) && (reader.qualifiedName() == "Surface")){
+
+        // each surface gets its own small document which is released once it is translated
+        QDomDocument surfaceDoc;
+        QDomElement surfaceElement = readElement(reader, surfaceDoc, false, unused);
+        surfaceDoc.appendChild(surfaceElement);
+
+        try {
+          boost::optional<model::ModelObject> surface = translateSurface(surfaceElement, surfaceDoc, model);
+        }catch(const std::exception&){
+          LOG(Error, "Could not translate surface " << surfaceElement);
+        }
+
+        if (m_progressBar){
+          m_progressBar->setValue(m_progressBar->value() + 1);
+        }
+      }
+    }
+
+    if (reader.hasError()){
+      LOG(Error, "Could not read gbXML file: " << toString(reader.errorString()) << " at line " << reader.lineNumber());
+      return false;
+    }
+
+    return true;
+  }
+
 
   std::vector<LogMessage> ReverseTranslator::warnings() const
   {
@@ -256,7 +388,6 @@ namespace gbxml {
     }
 
     // do constructions before surfaces
-    QDomNodeList layerElements = element.elementsByTagName("Layer");
     QDomNodeList constructionElements = element.elementsByTagName("Construction");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Constructions"));
@@ -267,7 +398,7 @@ namespace gbxml {
 
     for (int i = 0; i < constructionElements.count(); i++){
       QDomElement constructionElement = constructionElements.at(i).toElement();
-      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, layerElements, doc, model);
+      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, doc, model);
       OS_ASSERT(construction); // Krishnan, what type of error handling do you want?
 
       if (m_progressBar){
@@ -338,7 +469,7 @@ namespace gbxml {
     boost::optional<model::ModelObject> facility = translateCampus(campusElement, doc, model);
     OS_ASSERT(facility); // Krishnan, what type of error handling do you want?
 
-    model.setFastNaming(false);
+    // surfaces are translated as they are read, see translateSurfaces
 
     return model;
   }
@@ -353,27 +484,6 @@ namespace gbxml {
     boost::optional<model::ModelObject> building = translateBuilding(buildingElements.at(0).toElement(), doc, model);
     OS_ASSERT(building);
 
-    QDomNodeList surfaceElements = element.elementsByTagName("Surface");
-    if (m_progressBar){
-      m_progressBar->setWindowTitle(toString("Translating Surfaces"));
-      m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(surfaceElements.count());
-      m_progressBar->setValue(0);
-    }
-
-    for (int i = 0; i < surfaceElements.count(); ++i){
-
-      try {
-        boost::optional<model::ModelObject> surface = translateSurface(surfaceElements.at(i).toElement(), doc, model);
-      }catch(const std::exception&){
-        LOG(Error, "Could not translate surface " << surfaceElements.at(i).toElement());
-      }
-
-      if (m_progressBar){
-        m_progressBar->setValue(m_progressBar->value() + 1);
-      }
-    }
-
     return facility;
   }
 
@@ -41,9 +41,12 @@
 
 #include "../utilities/units/Unit.hpp"
 
+#include <QDomElement>
+
 class QDomDocument;
-class QDomElement;
 class QDomNodeList;
+class QIODevice;
+class QXmlStreamReader;
 
 namespace openstudio {
 
@@ -88,13 +91,26 @@ namespace gbxml {
 
     std::map<QString, openstudio::model::ModelObject> m_idToObjectMap;
 
+    // Layer, DaySchedule, and WeekSchedule elements by tag name and id
+    std::map<std::pair<QString, QString>, QDomElement> m_idToElementMap;
+
+    // reads the element at the current StartElement of reader, and all of its children, into doc
+    // if indexOnly, Surface and geometry elements are skipped and counted in numSurfaces
+    QDomElement readElement(QXmlStreamReader& reader, QDomDocument& doc, bool indexOnly, int& numSurfaces);
+
+    // reads everything but the surfaces and geometry, which make up most of a large file, into doc
+    bool readIndexDocument(QIODevice& device, QDomDocument& doc, int& numSurfaces);
+
+    // reads and translates the Surface elements one at a time
+    bool translateSurfaces(QIODevice& device, int numSurfaces, openstudio::model::Model& model);
+
     boost::optional<openstudio::model::Model> convert(const QDomDocument& doc);
     boost::optional<openstudio::model::Model> translateGBXML(const QDomElement& element, const QDomDocument& doc);
     boost::optional<openstudio::model::ModelObject> translateCampus(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuilding(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuildingStory(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateThermalZone(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateConstruction(const QDomElement& element, const QDomNodeList& layerElements, const QDomDocument& doc, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateConstruction(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateWindowType(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateMaterial(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateScheduleDay(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
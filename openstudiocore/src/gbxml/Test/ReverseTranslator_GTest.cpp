@@ -55,6 +55,7 @@
 
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/core/Optional.hpp"
+#include "../../utilities/core/Filesystem.hpp"
 
 #include <utilities/idd/OS_Surface_FieldEnums.hxx>
 #include <utilities/idd/OS_SubSurface_FieldEnums.hxx>
@@ -402,6 +403,37 @@ TEST_F(gbXMLFixture, ReverseTranslator_AlternateUnits)
 
 }
 
+TEST_F(gbXMLFixture, ReverseTranslator_TruncatedFile)
+{
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/TestCubeAlternateUnits.xml");
+  openstudio::path outputPath = resourcesPath() / openstudio::toPath("gbxml/TestCubeAlternateUnitsTruncated.xml");
+
+  std::string contents;
+  {
+    openstudio::filesystem::ifstream file(inputPath, std::ios_base::binary);
+    ASSERT_TRUE(file.is_open());
+    std::stringstream ss;
+    ss << file.rdbuf();
+    contents = ss.str();
+  }
+
+  {
+    openstudio::filesystem::ofstream file(outputPath, std::ios_base::binary);
+    ASSERT_TRUE(file.is_open());
+    file << contents.substr(0, contents.size() / 2);
+  }
+
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(outputPath);
+  EXPECT_FALSE(model);
+  EXPECT_FALSE(reverseTranslator.errors().empty());
+
+  // the complete file still translates with the same translator
+  model = reverseTranslator.loadModel(inputPath);
+  ASSERT_TRUE(model);
+  EXPECT_FALSE(model->getModelObjects<Surface>().empty());
+}
+
 TEST_F(gbXMLFixture, ReverseTranslator_HandleMapping)
 {
   //openstudio::Logger::instance().standardOutLogger().enable();
@@ -0,0 +1,278 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "BatchRunner.hpp"
+
+#include "ModelMeasure.hpp"
+#include "OSArgument.hpp"
+#include "OSRunner.hpp"
+
+#include "../energyplus/ForwardTranslator.hpp"
+
+#include "../utilities/filetypes/WorkflowStepResult.hpp"
+#include "../utilities/data/Variant.hpp"
+#include "../utilities/core/Assert.hpp"
+
+#include <QtConcurrent>
+
+#include <mutex>
+#include <set>
+#include <sstream>
+
+namespace openstudio {
+namespace measure {
+
+namespace {
+
+  // everything one worker needs to run a variant, filled in serially before the batch starts
+  struct BatchJob {
+    const BatchVariant* variant;
+    std::vector<std::shared_ptr<ModelMeasure> > measures;
+    WorkflowJSON workflow;
+    const model::Model* seed;
+    std::mutex* seedMutex;
+    openstudio::path dir;
+    bool translateToEnergyPlus;
+  };
+
+  std::map<std::string, OSArgument> userArguments(const ModelMeasure& measure, const MeasureStep& step, const model::Model& model)
+  {
+    std::vector<OSArgument> arguments = measure.arguments(model);
+    for (OSArgument& argument : arguments){
+      boost::optional<Variant> value = step.getArgument(argument.name());
+      if (!value){
+        continue;
+      }
+
+      bool result = false;
+      switch (value->variantType().value()){
+        case VariantType::Boolean:
+          result = argument.setValue(value->valueAsBoolean());
+          break;
+        case VariantType::Double:
+          result = argument.setValue(value->valueAsDouble());
+          break;
+        case VariantType::Integer:
+          result = argument.setValue(value->valueAsInteger());
+          break;
+        case VariantType::String:
+          result = argument.setValue(value->valueAsString());
+          break;
+      }
+
+      // e.g. a boolean argument given as "true", let the argument parse the text
+      if (!result){
+        std::stringstream ss;
+        ss << *value;
+        result = argument.setValue(ss.str());
+      }
+
+      if (!result){
+        LOG_FREE(Warn, "openstudio.measure.BatchRunner", "Cannot set argument '" << argument.name() << "' of measure '"
+          << step.measureDirName() << "' to '" << *value << "'");
+      }
+    }
+    return convertOSArgumentVectorToMap(arguments);
+  }
+
+  void runVariant(BatchJob& job)
+  {
+    // cloning only reads the seed, but the seed's objects fill some caches lazily so clones are made one at a time
+    boost::optional<model::Model> model;
+    {
+      std::lock_guard<std::mutex> lock(*job.seedMutex);
+      model = job.seed->clone(true).cast<model::Model>();
+    }
+
+    OSRunner runner(job.workflow);
+    runner.setCaptureProcessOutput(false);
+    runner.setLastOpenStudioModel(*model);
+
+    std::string completedStatus = "Success";
+    job.workflow.start();
+    for (size_t i = 0; i < job.measures.size(); ++i){
+      const std::shared_ptr<ModelMeasure>& measure = job.measures[i];
+      boost::optional<WorkflowStep> currentStep = job.workflow.currentStep();
+      OS_ASSERT(currentStep);
+      MeasureStep step = currentStep->cast<MeasureStep>();
+
+      // as in the workflow gem the step is started here rather than relying on the measure to call
+      // ModelMeasure::run, the runner ignores the second start that call makes
+      runner.prepareForMeasureRun(*measure);
+
+      bool result = false;
+      try{
+        result = measure->run(*model, runner, userArguments(*measure, step, *model));
+      }catch(const std::exception& e){
+        runner.registerError(e.what());
+      }
+
+      boost::optional<StepResult> stepResult = runner.result().stepResult();
+      bool failed = !result || (stepResult && (*stepResult == StepResult::Fail));
+
+      // incrementStep returns false once the last step is done, anywhere else the step was not recorded
+      bool lastStep = (i + 1 == job.measures.size());
+      if (runner.incrementStep() == lastStep){
+        LOG_FREE(Error, "openstudio.measure.BatchRunner", "Variant '" << job.variant->name() << "' could not complete step '"
+          << step.measureDirName() << "'");
+        failed = true;
+      }
+
+      if (failed){
+        completedStatus = "Fail";
+        break;
+      }
+      if (runner.halted()){
+        // as in the workflow gem the run ends with the status given to haltWorkflow, runners overriding
+        // haltWorkflow may not record one, use its default then
+        completedStatus = job.workflow.completedStatus().get_value_or("Invalid");
+        LOG_FREE(Info, "openstudio.measure.BatchRunner", "Variant '" << job.variant->name() << "' halted at step '"
+          << step.measureDirName() << "' with status '" << completedStatus << "'");
+        break;
+      }
+    }
+
+    job.workflow.setCompletedStatus(completedStatus);
+
+    if (completedStatus == "Success"){
+      model->save(job.dir / toPath("in.osm"), true);
+      if (job.translateToEnergyPlus){
+        energyplus::ForwardTranslator forwardTranslator;
+        Workspace workspace = forwardTranslator.translateModel(*model);
+        workspace.save(job.dir / toPath("in.idf"), true);
+      }
+    }
+  }
+
+  // exceptions must not leave the worker thread, they fail the variant instead
+  void runBatchJob(BatchJob& job)
+  {
+    try{
+      boost::filesystem::create_directories(job.dir);
+      runVariant(job);
+    }catch(const std::exception& e){
+      LOG_FREE(Error, "openstudio.measure.BatchRunner", "Variant '" << job.variant->name() << "' failed: " << e.what());
+      job.workflow.setCompletedStatus("Fail");
+    }
+
+    job.workflow.saveAs(job.dir / toPath("in.osw"));
+  }
+
+}
+
+BatchVariant::BatchVariant(const std::string& name)
+  : m_name(name)
+{
+}
+
+std::string BatchVariant::name() const
+{
+  return m_name;
+}
+
+std::vector<MeasureStep> BatchVariant::measureSteps() const
+{
+  return m_steps;
+}
+
+void BatchVariant::addMeasureStep(const std::shared_ptr<ModelMeasure>& measure, const MeasureStep& step)
+{
+  OS_ASSERT(measure);
+  m_measures.push_back(measure);
+  m_steps.push_back(step);
+}
+
+BatchRunner::BatchRunner(const model::Model& seed, const WorkflowJSON& workflow, const openstudio::path& outputDir)
+  : m_seed(seed), m_workflow(workflow.clone()), m_outputDir(outputDir), m_translateToEnergyPlus(true)
+{
+}
+
+openstudio::path BatchRunner::outputDir() const
+{
+  return m_outputDir;
+}
+
+bool BatchRunner::translateToEnergyPlus() const
+{
+  return m_translateToEnergyPlus;
+}
+
+void BatchRunner::setTranslateToEnergyPlus(bool translateToEnergyPlus)
+{
+  m_translateToEnergyPlus = translateToEnergyPlus;
+}
+
+std::vector<WorkflowJSON> BatchRunner::run(const std::vector<BatchVariant>& variants) const
+{
+  std::set<std::string> names;
+  for (const BatchVariant& variant : variants){
+    if (!names.insert(variant.name()).second){
+      LOG_AND_THROW("Variant name '" << variant.name() << "' is used more than once");
+    }
+  }
+
+  std::mutex seedMutex;
+
+  std::vector<BatchJob> jobs;
+  jobs.reserve(variants.size());
+  for (const BatchVariant& variant : variants){
+    // steps are copied through their JSON so that variants sharing a MeasureStep get their own results
+    std::vector<WorkflowStep> steps;
+    for (const MeasureStep& step : variant.m_steps){
+      boost::optional<WorkflowStep> copy = WorkflowStep::fromString(step.string());
+      OS_ASSERT(copy);
+      steps.push_back(*copy);
+    }
+
+    WorkflowJSON workflow = m_workflow.clone();
+    workflow.setWorkflowSteps(steps);
+
+    BatchJob job;
+    job.variant = &variant;
+    job.measures = variant.m_measures;
+    job.workflow = workflow;
+    job.seed = &m_seed;
+    job.seedMutex = &seedMutex;
+    job.dir = m_outputDir / toPath(variant.name());
+    job.translateToEnergyPlus = m_translateToEnergyPlus;
+    jobs.push_back(job);
+  }
+
+  QtConcurrent::blockingMap(jobs, &runBatchJob);
+
+  std::vector<WorkflowJSON> result;
+  result.reserve(jobs.size());
+  for (const BatchJob& job : jobs){
+    result.push_back(job.workflow);
+  }
+  return result;
+}
+
+} // measure
+} // openstudio
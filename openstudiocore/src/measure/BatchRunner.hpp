@@ -0,0 +1,144 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef MEASURE_BATCHRUNNER_HPP
+#define MEASURE_BATCHRUNNER_HPP
+
+#include "MeasureAPI.hpp"
+
+#include "../model/Model.hpp"
+
+#include "../utilities/filetypes/WorkflowJSON.hpp"
+#include "../utilities/filetypes/WorkflowStep.hpp"
+#include "../utilities/core/Path.hpp"
+#include "../utilities/core/Logger.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace measure {
+
+class ModelMeasure;
+
+/** BatchVariant is one datapoint of a BatchRunner, a named list of ModelMeasures to apply in order
+ *  to a copy of the seed model. The argument values of each measure are taken from its MeasureStep. */
+class MEASURE_API BatchVariant {
+ public:
+
+  /** @name Constructors and Destructors */
+  //@{
+
+  /** The name is used as the variant's output directory, so it must be unique within a batch. */
+  explicit BatchVariant(const std::string& name);
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  std::string name() const;
+
+  std::vector<MeasureStep> measureSteps() const;
+
+  //@}
+  /** @name Setters */
+  //@{
+
+  /** Appends measure, configured by step. The same measure may be added to many variants and is then
+   *  run on several threads at once, its run method must only modify the model and runner it is passed. */
+  void addMeasureStep(const std::shared_ptr<ModelMeasure>& measure, const MeasureStep& step);
+
+  //@}
+
+ private:
+
+  friend class BatchRunner;
+
+  std::string m_name;
+  std::vector<std::shared_ptr<ModelMeasure> > m_measures;
+  std::vector<MeasureStep> m_steps;
+};
+
+/** BatchRunner applies many BatchVariants to one seed model in process. The seed is loaded by the caller
+ *  once, each variant works on a clone of it with its own OSRunner, and variants run on the global
+ *  thread pool. For each variant the directory outputDir/name is created and receives in.osw, with the
+ *  step results, and if all steps succeed in.osm and, unless disabled, the EnergyPlus translation in.idf.
+ *
+ *  Only C++ measures can be run this way, Ruby measures must not be called from worker threads. */
+class MEASURE_API BatchRunner {
+ public:
+
+  /** @name Constructors and Destructors */
+  //@{
+
+  /** The seed model is cloned with its handles kept, so measure arguments that refer to seed objects by
+   *  handle still apply. The seed is not modified. Each variant's workflow is a clone of workflow with
+   *  its workflow steps replaced by the variant's measure steps. */
+  BatchRunner(const model::Model& seed, const WorkflowJSON& workflow, const openstudio::path& outputDir);
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  openstudio::path outputDir() const;
+
+  /** Returns true if in.idf is written for each successful variant. Defaults to true. */
+  bool translateToEnergyPlus() const;
+
+  //@}
+  /** @name Setters */
+  //@{
+
+  void setTranslateToEnergyPlus(bool translateToEnergyPlus);
+
+  //@}
+  /** @name Actions */
+  //@{
+
+  /** Runs all variants and returns their workflows in the same order, with step results and completed
+   *  status set. Throws if two variants have the same name. */
+  std::vector<WorkflowJSON> run(const std::vector<BatchVariant>& variants) const;
+
+  //@}
+
+ private:
+
+  REGISTER_LOGGER("openstudio.measure.BatchRunner");
+
+  model::Model m_seed;
+  WorkflowJSON m_workflow;
+  openstudio::path m_outputDir;
+  bool m_translateToEnergyPlus;
+};
+
+} // measure
+} // openstudio
+
+#endif // MEASURE_BATCHRUNNER_HPP
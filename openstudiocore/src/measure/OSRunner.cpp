@@ -48,7 +48,7 @@ namespace openstudio {
 namespace measure {
 
 OSRunner::OSRunner(const WorkflowJSON& workflow)
-  : m_workflow(workflow), m_startedStep(false), m_streamsCaptured(false),
+  : m_workflow(workflow), m_startedStep(false), m_startedMeasure(nullptr), m_streamsCaptured(false), m_captureProcessOutput(true),
     m_unitsPreference("IP"), m_languagePreference("en"), m_halted(false),
     m_originalStdOut(nullptr), m_originalStdErr(nullptr)
 {
@@ -159,6 +159,7 @@ void OSRunner::reset()
 {
   m_workflow.reset();
   m_startedStep = false;
+  m_startedMeasure = nullptr;
 
   restoreStreams();
 
@@ -205,9 +206,11 @@ bool OSRunner::incrementStep()
   }
 
   // restore stdout and stderr
-  m_result.setStdOut(m_bufferStdOut.str());
-  m_result.setStdErr(m_bufferStdErr.str());
-  restoreStreams();
+  if (m_streamsCaptured){
+    m_result.setStdOut(m_bufferStdOut.str());
+    m_result.setStdErr(m_bufferStdErr.str());
+    restoreStreams();
+  }
 
   // check for created files
 
@@ -246,6 +249,7 @@ bool OSRunner::incrementStep()
 
   m_result = WorkflowStepResult();
   m_startedStep = false;
+  m_startedMeasure = nullptr;
 
   return m_workflow.incrementStep();
 }
@@ -265,7 +269,12 @@ void OSRunner::prepareForMeasureRun(const OSMeasure& measure) {
     return;
   }
   if (m_startedStep){
-    LOG(Error, "Step already started");
+    // the workflow gem and BatchRunner start the step before running the measure, ModelMeasure::run starts it again
+    if (&measure == m_startedMeasure){
+      LOG(Debug, "Step already started for this measure");
+    }else{
+      LOG(Error, "Step already started");
+    }
     return;
   }
   boost::optional<WorkflowStep> currentStep = m_workflow.currentStep();
@@ -275,12 +284,17 @@ void OSRunner::prepareForMeasureRun(const OSMeasure& measure) {
   }
 
   m_startedStep = true;
+  m_startedMeasure = &measure;
 
   // create a new result
   m_result = WorkflowStepResult();
   m_result.setStartedAt(DateTime::nowUTC());
   m_result.setStepResult(StepResult::Success);
 
+  if (!m_captureProcessOutput){
+    return;
+  }
+
   // capture std out and err
   captureStreams();
 
@@ -945,6 +959,16 @@ void OSRunner::resetLanguagePreference()
   m_languagePreference = "en";
 }
 
+bool OSRunner::captureProcessOutput() const
+{
+  return m_captureProcessOutput;
+}
+
+void OSRunner::setCaptureProcessOutput(bool captureProcessOutput)
+{
+  m_captureProcessOutput = captureProcessOutput;
+}
+
 std::string OSRunner::cleanValueName(const std::string& name) const
 {
   static const boost::regex allowableCharacters("[^0-9a-zA-Z]");
@@ -320,6 +320,14 @@ class MEASURE_API OSRunner {
 
   void resetLanguagePreference();
 
+  /** Returns true if std::cout, std::cerr and new files in the current directory are recorded in the
+   *  step result while a measure runs. Defaults to true. */
+  bool captureProcessOutput() const;
+
+  /** All three are shared by the whole process, so capture must be turned off when several runners
+   *  are used on different threads at once. */
+  void setCaptureProcessOutput(bool captureProcessOutput);
+
  private:
   REGISTER_LOGGER("openstudio.measure.OSRunner");
 
@@ -330,7 +338,10 @@ class MEASURE_API OSRunner {
 
   WorkflowJSON m_workflow;
   bool m_startedStep;
+  // only compared, to recognize a measure starting its own step again
+  const OSMeasure* m_startedMeasure;
   bool m_streamsCaptured;
+  bool m_captureProcessOutput;
   std::string m_unitsPreference;
   std::string m_languagePreference;
 
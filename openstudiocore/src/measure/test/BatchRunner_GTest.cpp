@@ -0,0 +1,309 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "MeasureFixture.hpp"
+
+#include "../BatchRunner.hpp"
+#include "../ModelMeasure.hpp"
+#include "../OSArgument.hpp"
+#include "../OSRunner.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Building.hpp"
+#include "../../model/Building_Impl.hpp"
+#include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
+
+#include "../../utilities/filetypes/WorkflowJSON.hpp"
+#include "../../utilities/filetypes/WorkflowStep.hpp"
+#include "../../utilities/filetypes/WorkflowStepResult.hpp"
+#include "../../utilities/core/StringStreamLogSink.hpp"
+
+#include <chrono>
+
+using namespace openstudio;
+using namespace openstudio::measure;
+
+class SetBuildingNameMeasure : public ModelMeasure {
+ public:
+
+  virtual std::string name() const override {
+    return "SetBuildingNameMeasure";
+  }
+
+  virtual std::vector<OSArgument> arguments(const model::Model& model) const override {
+    std::vector<OSArgument> result;
+    result.push_back(OSArgument::makeStringArgument("building_name"));
+    return result;
+  }
+
+  virtual bool run(model::Model& model,
+                   OSRunner& runner,
+                   const std::map<std::string, OSArgument>& user_arguments) const override
+  {
+    ModelMeasure::run(model, runner, user_arguments);
+    if (!runner.validateUserArguments(arguments(model), user_arguments)){
+      return false;
+    }
+
+    std::string buildingName = runner.getStringArgumentValue("building_name", user_arguments);
+    if (buildingName.empty()){
+      runner.registerError("Empty building name");
+      return false;
+    }
+
+    model.getUniqueModelObject<model::Building>().setName(buildingName);
+    runner.registerFinalCondition("Building renamed to " + buildingName);
+    return true;
+  }
+
+};
+
+// does not call ModelMeasure::run, the batch runner has to start its step
+class AddSpaceMeasure : public ModelMeasure {
+ public:
+
+  virtual std::string name() const override {
+    return "AddSpaceMeasure";
+  }
+
+  virtual bool run(model::Model& model,
+                   OSRunner& runner,
+                   const std::map<std::string, OSArgument>& user_arguments) const override
+  {
+    model::Space space(model);
+    runner.registerFinalCondition("Added " + space.nameString());
+    return true;
+  }
+
+};
+
+// stops the workflow after its own step
+class HaltMeasure : public ModelMeasure {
+ public:
+
+  virtual std::string name() const override {
+    return "HaltMeasure";
+  }
+
+  virtual bool run(model::Model& model,
+                   OSRunner& runner,
+                   const std::map<std::string, OSArgument>& user_arguments) const override
+  {
+    ModelMeasure::run(model, runner, user_arguments);
+    runner.haltWorkflow();
+    return true;
+  }
+
+};
+
+TEST_F(MeasureFixture, BatchRunner)
+{
+  model::Model seed = model::exampleModel();
+  std::string seedName = seed.getUniqueModelObject<model::Building>().nameString();
+  unsigned numObjects = seed.numObjects();
+
+  openstudio::path outputDir = toPath("./BatchRunner");
+  if (boost::filesystem::exists(outputDir)){
+    boost::filesystem::remove_all(outputDir);
+  }
+
+  std::shared_ptr<ModelMeasure> measure = std::make_shared<SetBuildingNameMeasure>();
+
+  const unsigned numVariants = 20;
+  std::vector<BatchVariant> variants;
+  for (unsigned i = 0; i < numVariants; ++i){
+    MeasureStep step("SetBuildingNameMeasure");
+    step.setArgument("building_name", "Building " + std::to_string(i));
+    BatchVariant variant("variant_" + std::to_string(i));
+    variant.addMeasureStep(measure, step);
+    variants.push_back(variant);
+  }
+
+  // fails in the measure, no model is written
+  MeasureStep failStep("SetBuildingNameMeasure");
+  failStep.setArgument("building_name", "");
+  BatchVariant failVariant("fail");
+  failVariant.addMeasureStep(measure, failStep);
+  variants.push_back(failVariant);
+
+  BatchRunner batchRunner(seed, WorkflowJSON(), outputDir);
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<WorkflowJSON> workflows = batchRunner.run(variants);
+  auto end = std::chrono::steady_clock::now();
+  double minutes = std::chrono::duration<double>(end - start).count() / 60.0;
+  LOG(Info, "Ran " << variants.size() << " variants of the example model at " << variants.size() / minutes << " variants per minute");
+
+  ASSERT_EQ(variants.size(), workflows.size());
+
+  // the seed is not touched
+  EXPECT_EQ(seedName, seed.getUniqueModelObject<model::Building>().nameString());
+  EXPECT_EQ(numObjects, seed.numObjects());
+
+  for (unsigned i = 0; i < numVariants; ++i){
+    openstudio::path dir = outputDir / toPath("variant_" + std::to_string(i));
+    ASSERT_TRUE(workflows[i].completedStatus());
+    EXPECT_EQ("Success", workflows[i].completedStatus().get());
+    ASSERT_EQ(1u, workflows[i].workflowSteps().size());
+    boost::optional<WorkflowStepResult> stepResult = workflows[i].workflowSteps()[0].result();
+    ASSERT_TRUE(stepResult);
+    ASSERT_TRUE(stepResult->stepResult());
+    EXPECT_EQ(StepResult::Success, stepResult->stepResult()->value());
+
+    EXPECT_TRUE(boost::filesystem::exists(dir / toPath("in.osw")));
+    EXPECT_TRUE(boost::filesystem::exists(dir / toPath("in.idf")));
+    boost::optional<model::Model> model = model::Model::load(dir / toPath("in.osm"));
+    ASSERT_TRUE(model);
+    EXPECT_EQ("Building " + std::to_string(i), model->getUniqueModelObject<model::Building>().nameString());
+    EXPECT_EQ(numObjects, model->numObjects());
+  }
+
+  ASSERT_TRUE(workflows[numVariants].completedStatus());
+  EXPECT_EQ("Fail", workflows[numVariants].completedStatus().get());
+  EXPECT_TRUE(boost::filesystem::exists(outputDir / toPath("fail/in.osw")));
+  EXPECT_FALSE(boost::filesystem::exists(outputDir / toPath("fail/in.osm")));
+
+  // variant names are directory names
+  variants.push_back(failVariant);
+  EXPECT_THROW(batchRunner.run(variants), std::exception);
+}
+
+TEST_F(MeasureFixture, BatchRunner_MultipleSteps)
+{
+  model::Model seed = model::exampleModel();
+  size_t numSpaces = seed.getConcreteModelObjects<model::Space>().size();
+
+  openstudio::path outputDir = toPath("./BatchRunner_MultipleSteps");
+  if (boost::filesystem::exists(outputDir)){
+    boost::filesystem::remove_all(outputDir);
+  }
+
+  std::shared_ptr<ModelMeasure> setName = std::make_shared<SetBuildingNameMeasure>();
+  std::shared_ptr<ModelMeasure> addSpace = std::make_shared<AddSpaceMeasure>();
+  std::shared_ptr<ModelMeasure> halt = std::make_shared<HaltMeasure>();
+
+  MeasureStep firstName("SetBuildingNameMeasure");
+  firstName.setArgument("building_name", "First");
+  MeasureStep secondName("SetBuildingNameMeasure");
+  secondName.setArgument("building_name", "Second");
+  MeasureStep emptyName("SetBuildingNameMeasure");
+  emptyName.setArgument("building_name", "");
+
+  // every step runs and records a result
+  BatchVariant three("three");
+  three.addMeasureStep(setName, firstName);
+  three.addMeasureStep(addSpace, MeasureStep("AddSpaceMeasure"));
+  three.addMeasureStep(setName, secondName);
+
+  // the first step fails, the rest are not run
+  BatchVariant failFirst("fail_first");
+  failFirst.addMeasureStep(setName, emptyName);
+  failFirst.addMeasureStep(addSpace, MeasureStep("AddSpaceMeasure"));
+
+  // the last step fails after the others succeeded
+  BatchVariant failLast("fail_last");
+  failLast.addMeasureStep(addSpace, MeasureStep("AddSpaceMeasure"));
+  failLast.addMeasureStep(setName, emptyName);
+
+  // the second step halts the workflow, the third is not run
+  BatchVariant halted("halted");
+  halted.addMeasureStep(addSpace, MeasureStep("AddSpaceMeasure"));
+  halted.addMeasureStep(halt, MeasureStep("HaltMeasure"));
+  halted.addMeasureStep(setName, secondName);
+
+  std::vector<BatchVariant> variants;
+  variants.push_back(three);
+  variants.push_back(failFirst);
+  variants.push_back(failLast);
+  variants.push_back(halted);
+
+  StringStreamLogSink sink;
+  sink.setLogLevel(Error);
+
+  BatchRunner batchRunner(seed, WorkflowJSON(), outputDir);
+  batchRunner.setTranslateToEnergyPlus(false);
+  std::vector<WorkflowJSON> workflows = batchRunner.run(variants);
+  ASSERT_EQ(4u, workflows.size());
+
+  // measures calling ModelMeasure::run start their already started step quietly
+  for (const LogMessage& message : sink.logMessages()){
+    EXPECT_NE("openstudio.measure.OSRunner", message.logChannel()) << message.logMessage();
+  }
+
+  ASSERT_TRUE(workflows[0].completedStatus());
+  EXPECT_EQ("Success", workflows[0].completedStatus().get());
+  std::vector<WorkflowStep> steps = workflows[0].workflowSteps();
+  ASSERT_EQ(3u, steps.size());
+  for (const WorkflowStep& step : steps){
+    boost::optional<WorkflowStepResult> stepResult = step.result();
+    ASSERT_TRUE(stepResult);
+    ASSERT_TRUE(stepResult->stepResult());
+    EXPECT_EQ(StepResult::Success, stepResult->stepResult()->value());
+  }
+  EXPECT_FALSE(boost::filesystem::exists(outputDir / toPath("three/in.idf")));
+  boost::optional<model::Model> model = model::Model::load(outputDir / toPath("three/in.osm"));
+  ASSERT_TRUE(model);
+  EXPECT_EQ("Second", model->getUniqueModelObject<model::Building>().nameString());
+  EXPECT_EQ(numSpaces + 1, model->getConcreteModelObjects<model::Space>().size());
+
+  ASSERT_TRUE(workflows[1].completedStatus());
+  EXPECT_EQ("Fail", workflows[1].completedStatus().get());
+  steps = workflows[1].workflowSteps();
+  ASSERT_EQ(2u, steps.size());
+  ASSERT_TRUE(steps[0].result());
+  ASSERT_TRUE(steps[0].result()->stepResult());
+  EXPECT_EQ(StepResult::Fail, steps[0].result()->stepResult()->value());
+  EXPECT_FALSE(steps[1].result());
+  EXPECT_FALSE(boost::filesystem::exists(outputDir / toPath("fail_first/in.osm")));
+
+  ASSERT_TRUE(workflows[2].completedStatus());
+  EXPECT_EQ("Fail", workflows[2].completedStatus().get());
+  steps = workflows[2].workflowSteps();
+  ASSERT_EQ(2u, steps.size());
+  ASSERT_TRUE(steps[0].result());
+  ASSERT_TRUE(steps[0].result()->stepResult());
+  EXPECT_EQ(StepResult::Success, steps[0].result()->stepResult()->value());
+  ASSERT_TRUE(steps[1].result());
+  ASSERT_TRUE(steps[1].result()->stepResult());
+  EXPECT_EQ(StepResult::Fail, steps[1].result()->stepResult()->value());
+  EXPECT_FALSE(boost::filesystem::exists(outputDir / toPath("fail_last/in.osm")));
+
+  ASSERT_TRUE(workflows[3].completedStatus());
+  EXPECT_EQ("Invalid", workflows[3].completedStatus().get());
+  steps = workflows[3].workflowSteps();
+  ASSERT_EQ(3u, steps.size());
+  ASSERT_TRUE(steps[0].result());
+  ASSERT_TRUE(steps[1].result());
+  ASSERT_TRUE(steps[1].result()->stepResult());
+  EXPECT_EQ(StepResult::Success, steps[1].result()->stepResult()->value());
+  EXPECT_FALSE(steps[2].result());
+  EXPECT_FALSE(boost::filesystem::exists(outputDir / toPath("halted/in.osm")));
+}
@@ -618,6 +618,10 @@ namespace detail {
 
   double Building_Impl::floorArea() const
   {
+    if (boost::optional<double> cached = cachedAggregate("floorArea")) {
+      return *cached;
+    }
+
     double result = 0;
     for (const Space& space : spaces()){
       bool partofTotalFloorArea = space.partofTotalFloorArea();
@@ -625,7 +629,7 @@ namespace detail {
         result += space.multiplier() * space.floorArea();
       }
     }
-    return result;
+    return setCachedAggregate("floorArea", result);
   }
 
   boost::optional<double> Building_Impl::conditionedFloorArea() const
@@ -656,6 +660,10 @@ namespace detail {
   }
 
   double Building_Impl::exteriorSurfaceArea() const {
+    if (boost::optional<double> cached = cachedAggregate("exteriorSurfaceArea")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
       OptionalSpace space = surface.space();
@@ -664,33 +672,45 @@ namespace detail {
         result += surface.grossArea() * space->multiplier();
       }
     }
-    return result;
+    return setCachedAggregate("exteriorSurfaceArea", result);
   }
 
   double Building_Impl::exteriorWallArea() const {
+    if (boost::optional<double> cached = cachedAggregate("exteriorWallArea")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Surface& exteriorWall : exteriorWalls()) {
       if (OptionalSpace space = exteriorWall.space()) {
         result += exteriorWall.grossArea() * space->multiplier();
       }
     }
-    return result;
+    return setCachedAggregate("exteriorWallArea", result);
   }
 
   double Building_Impl::airVolume() const {
+    if (boost::optional<double> cached = cachedAggregate("airVolume")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.volume() * space.multiplier();
     }
-    return result;
+    return setCachedAggregate("airVolume", result);
   }
 
   double Building_Impl::numberOfPeople() const {
+    if (boost::optional<double> cached = cachedAggregate("numberOfPeople")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.numberOfPeople() * space.multiplier();
     }
-    return result;
+    return setCachedAggregate("numberOfPeople", result);
   }
 
   double Building_Impl::peoplePerFloorArea() const {
@@ -718,11 +738,15 @@ namespace detail {
   }
 
   double Building_Impl::lightingPower() const {
+    if (boost::optional<double> cached = cachedAggregate("lightingPower")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.multiplier() * space.lightingPower();
     }
-    return result;
+    return setCachedAggregate("lightingPower", result);
   }
 
   double Building_Impl::lightingPowerPerFloorArea() const {
@@ -756,11 +780,15 @@ namespace detail {
   }
 
   double Building_Impl::electricEquipmentPower() const {
+    if (boost::optional<double> cached = cachedAggregate("electricEquipmentPower")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.multiplier() * space.electricEquipmentPower();
     }
-    return result;
+    return setCachedAggregate("electricEquipmentPower", result);
   }
 
   double Building_Impl::electricEquipmentPowerPerFloorArea() const {
@@ -794,11 +822,15 @@ namespace detail {
   }
 
   double Building_Impl::gasEquipmentPower() const {
+    if (boost::optional<double> cached = cachedAggregate("gasEquipmentPower")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.multiplier() * space.gasEquipmentPower();
     }
-    return result;
+    return setCachedAggregate("gasEquipmentPower", result);
   }
 
   double Building_Impl::gasEquipmentPowerPerFloorArea() const {
@@ -37,6 +37,12 @@
 #include "ModelObject_Impl.hpp"
 #include "ResourceObject.hpp"
 #include "ResourceObject_Impl.hpp"
+#include "SpaceLoad.hpp"
+#include "SpaceLoad_Impl.hpp"
+#include "SpaceLoadInstance.hpp"
+#include "SpaceLoadDefinition.hpp"
+#include "SpaceLoadDefinition_Impl.hpp"
+#include "ConstructionBase_Impl.hpp"
 
 // central list of all concrete ModelObject header files (_Impl and non-_Impl)
 // needed here for ::createObject
@@ -84,13 +90,15 @@ namespace detail {
 
   // default constructor
   Model_Impl::Model_Impl()
-    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio)
+    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio),
+      m_aggregateDependenciesTracked(false)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
   }
 
   Model_Impl::Model_Impl(const IdfFile& idfFile)
-    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft))
+    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft)),
+      m_aggregateDependenciesTracked(false)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
     if (iddFileType() != IddFileType::OpenStudio) {
@@ -102,7 +110,8 @@ namespace detail {
 
   Model_Impl::Model_Impl(const openstudio::detail::Workspace_Impl& workspace,
                          bool keepHandles)
-    : openstudio::detail::Workspace_Impl(workspace,keepHandles)
+    : openstudio::detail::Workspace_Impl(workspace,keepHandles),
+      m_aggregateDependenciesTracked(false)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
     if (iddFileType() != IddFileType::OpenStudio) {
@@ -116,7 +125,8 @@ namespace detail {
   Model_Impl::Model_Impl(const Model_Impl& other, bool keepHandles)
     : Workspace_Impl(other, keepHandles),
       m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
-      m_workflowJSON(WorkflowJSON(other.m_workflowJSON))
+      m_workflowJSON(WorkflowJSON(other.m_workflowJSON)),
+      m_aggregateDependenciesTracked(false)
   {
     // notice we are cloning the workflow and sqlfile too, if necessary
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
@@ -129,7 +139,8 @@ namespace detail {
                          StrictnessLevel level)
     : Workspace_Impl(other,hs,keepHandles,level),
       m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
-      m_workflowJSON(WorkflowJSON(other.m_workflowJSON))
+      m_workflowJSON(WorkflowJSON(other.m_workflowJSON)),
+      m_aggregateDependenciesTracked(false)
   {
     // notice we are cloning the workflow and sqlfile too, if necessary
   }
@@ -987,6 +998,7 @@ namespace detail {
     clearCachedRunPeriod(dummy);
     clearCachedYearDescription(dummy);
     clearCachedWeatherFile(dummy);
+    untrackAggregateDependencies();
   }
 
   void Model_Impl::clearCachedBuilding(const Handle &)
@@ -1019,6 +1031,227 @@ namespace detail {
     m_cachedWeatherFile.reset();
   }
 
+  boost::optional<double> Model_Impl::cachedAggregate(const Handle& handle, const std::string& aggregate) const
+  {
+    auto it = m_cachedAggregates.find(std::make_pair(handle, aggregate));
+    if (it != m_cachedAggregates.end()){
+      return it->second;
+    }
+    return boost::none;
+  }
+
+  namespace {
+
+    // objects whose data feeds Space, ThermalZone and Building area and load aggregates
+    bool isAggregateDependency(const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& object)
+    {
+      return std::dynamic_pointer_cast<Space_Impl>(object) ||
+             std::dynamic_pointer_cast<SpaceType_Impl>(object) ||
+             std::dynamic_pointer_cast<Surface_Impl>(object) ||
+             std::dynamic_pointer_cast<SpaceLoad_Impl>(object) ||
+             std::dynamic_pointer_cast<SpaceLoadDefinition_Impl>(object) ||
+             std::dynamic_pointer_cast<ConstructionBase_Impl>(object) ||
+             std::dynamic_pointer_cast<DefaultConstructionSet_Impl>(object) ||
+             std::dynamic_pointer_cast<DefaultSurfaceConstructions_Impl>(object) ||
+             std::dynamic_pointer_cast<ThermalZone_Impl>(object) ||
+             std::dynamic_pointer_cast<BuildingStory_Impl>(object) ||
+             std::dynamic_pointer_cast<Building_Impl>(object);
+    }
+
+    // children of a space or space type and the definitions of its loads
+    void appendChildSources(const ParentObject& parent, std::vector<Handle>& result)
+    {
+      for (const ModelObject& child : parent.children()){
+        result.push_back(child.handle());
+        if (boost::optional<SpaceLoadInstance> instance = child.optionalCast<SpaceLoadInstance>()){
+          result.push_back(instance->definition().handle());
+        }
+      }
+    }
+
+    // objects the aggregates cached for object are computed from
+    std::vector<Handle> aggregateSources(const WorkspaceObject& object)
+    {
+      std::vector<Handle> result;
+      if (boost::optional<Space> space = object.optionalCast<Space>()){
+        appendChildSources(*space, result);
+        if (boost::optional<SpaceType> spaceType = space->spaceType()){
+          result.push_back(spaceType->handle());
+          appendChildSources(*spaceType, result);
+        }
+      }else if (boost::optional<ThermalZone> thermalZone = object.optionalCast<ThermalZone>()){
+        for (const Space& space : thermalZone->spaces()){
+          result.push_back(space.handle());
+        }
+      }else if (boost::optional<Building> building = object.optionalCast<Building>()){
+        for (const Space& space : building->spaces()){
+          result.push_back(space.handle());
+          if (boost::optional<ThermalZone> thermalZone = space.thermalZone()){
+            result.push_back(thermalZone->handle());
+          }
+        }
+      }
+      return result;
+    }
+
+    void appendSpaceLoadDependents(const SpaceLoad& spaceLoad, std::vector<Handle>& result)
+    {
+      if (boost::optional<Space> space = spaceLoad.space()){
+        result.push_back(space->handle());
+      }
+      if (boost::optional<SpaceType> spaceType = spaceLoad.spaceType()){
+        for (const Space& space : spaceType->spaces()){
+          result.push_back(space.handle());
+        }
+      }
+    }
+
+    // appends the objects whose aggregates are computed from object as it is now, aggregates cached
+    // from its previous state are found through the recorded sources. Returns false if the change
+    // may affect any aggregate.
+    bool appendAggregateDependents(const WorkspaceObject& object, const boost::optional<Building>& building, std::vector<Handle>& result)
+    {
+      if (boost::optional<Space> space = object.optionalCast<Space>()){
+        if (boost::optional<ThermalZone> thermalZone = space->thermalZone()){
+          result.push_back(thermalZone->handle());
+        }
+        if (building){
+          result.push_back(building->handle());
+        }
+      }else if (boost::optional<Surface> surface = object.optionalCast<Surface>()){
+        if (boost::optional<Space> space = surface->space()){
+          result.push_back(space->handle());
+        }
+      }else if (boost::optional<SpaceLoad> spaceLoad = object.optionalCast<SpaceLoad>()){
+        appendSpaceLoadDependents(*spaceLoad, result);
+      }else if (boost::optional<SpaceLoadDefinition> definition = object.optionalCast<SpaceLoadDefinition>()){
+        for (const SpaceLoadInstance& instance : definition->instances()){
+          appendSpaceLoadDependents(instance, result);
+        }
+      }else if (boost::optional<SpaceType> spaceType = object.optionalCast<SpaceType>()){
+        for (const Space& space : spaceType->spaces()){
+          result.push_back(space.handle());
+        }
+      }else if (!object.optionalCast<ThermalZone>()){
+        // constructions decide which surfaces are air walls, the building and stories supply
+        // default space types and construction sets
+        return false;
+      }
+      return true;
+    }
+
+  }
+
+  double Model_Impl::setCachedAggregate(const Handle& handle, const std::string& aggregate, double value) const
+  {
+    if (!m_aggregateDependenciesTracked){
+      const_cast<Model_Impl*>(this)->trackAggregateDependencies();
+    }
+
+    // record the sources when the first aggregate of this object is cached, they are cleared with it
+    auto it = m_cachedAggregates.lower_bound(std::make_pair(handle, std::string()));
+    if ((it == m_cachedAggregates.end()) || (it->first.first != handle)){
+      if (boost::optional<WorkspaceObject> object = getObject(handle)){
+        for (const Handle& source : aggregateSources(*object)){
+          m_aggregateDependents[source].insert(handle);
+        }
+      }
+    }
+
+    m_cachedAggregates[std::make_pair(handle, aggregate)] = value;
+    return value;
+  }
+
+  void Model_Impl::clearCachedAggregates(const Handle& handle)
+  {
+    if (m_cachedAggregates.empty()){
+      m_aggregateDependents.clear();
+      return;
+    }
+
+    std::vector<Handle> stale(1, handle);
+    if (boost::optional<WorkspaceObject> object = getObject(handle)){
+      if (!appendAggregateDependents(*object, building(), stale)){
+        clearCachedAggregates();
+        return;
+      }
+    }
+
+    while (!stale.empty()){
+      Handle current = stale.back();
+      stale.pop_back();
+
+      auto first = m_cachedAggregates.lower_bound(std::make_pair(current, std::string()));
+      auto last = first;
+      while ((last != m_cachedAggregates.end()) && (last->first.first == current)){
+        ++last;
+      }
+      m_cachedAggregates.erase(first, last);
+
+      // each entry is visited once, so cycles between sources and dependents terminate
+      auto dependents = m_aggregateDependents.find(current);
+      if (dependents != m_aggregateDependents.end()){
+        stale.insert(stale.end(), dependents->second.begin(), dependents->second.end());
+        m_aggregateDependents.erase(dependents);
+      }
+    }
+  }
+
+  void Model_Impl::clearCachedAggregates()
+  {
+    m_cachedAggregates.clear();
+    m_aggregateDependents.clear();
+  }
+
+  void Model_Impl::trackAggregateDependencies()
+  {
+    m_aggregateDependenciesTracked = true;
+
+    this->addWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::addAggregateDependency>(this);
+    this->removeWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::removeAggregateDependency>(this);
+
+    for (const WorkspaceObject& object : objects()){
+      std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+      if (isAggregateDependency(impl)){
+        std::shared_ptr<ModelObject_Impl> modelObject = std::dynamic_pointer_cast<ModelObject_Impl>(impl);
+        impl.get()->openstudio::detail::WorkspaceObject_Impl::onChange.connect<ModelObject_Impl, &ModelObject_Impl::clearCachedAggregates>(modelObject.get());
+      }
+    }
+  }
+
+  void Model_Impl::untrackAggregateDependencies()
+  {
+    if (m_aggregateDependenciesTracked){
+      this->addWorkspaceObjectPtr.disconnect<Model_Impl, &Model_Impl::addAggregateDependency>(this);
+      this->removeWorkspaceObjectPtr.disconnect<Model_Impl, &Model_Impl::removeAggregateDependency>(this);
+      for (const WorkspaceObject& object : objects()){
+        std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+        if (std::shared_ptr<ModelObject_Impl> modelObject = std::dynamic_pointer_cast<ModelObject_Impl>(impl)){
+          impl.get()->openstudio::detail::WorkspaceObject_Impl::onChange.disconnect<ModelObject_Impl, &ModelObject_Impl::clearCachedAggregates>(modelObject.get());
+        }
+      }
+      m_aggregateDependenciesTracked = false;
+    }
+    clearCachedAggregates();
+  }
+
+  void Model_Impl::addAggregateDependency(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const IddObjectType& iddObjectType, const UUID& handle)
+  {
+    if (isAggregateDependency(object)){
+      std::shared_ptr<ModelObject_Impl> modelObject = std::dynamic_pointer_cast<ModelObject_Impl>(object);
+      object.get()->openstudio::detail::WorkspaceObject_Impl::onChange.connect<ModelObject_Impl, &ModelObject_Impl::clearCachedAggregates>(modelObject.get());
+      clearCachedAggregates(handle);
+    }
+  }
+
+  void Model_Impl::removeAggregateDependency(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const IddObjectType& iddObjectType, const UUID& handle)
+  {
+    // emitted before the object leaves the workspace, so its relationships can still be followed
+    if (isAggregateDependency(object)){
+      clearCachedAggregates(handle);
+    }
+  }
+
   void Model_Impl::autosize() {
     for (auto optModelObj : objects()) {
       if (auto modelObj = optModelObj.optionalCast<HVACComponent>()) { // HVACComponent
@@ -1115,6 +1115,23 @@ namespace detail {
     return setPointer(index,schedule.handle());
   }
 
+  boost::optional<double> ModelObject_Impl::cachedAggregate(const std::string& aggregate) const
+  {
+    return model().getImpl<Model_Impl>()->cachedAggregate(handle(), aggregate);
+  }
+
+  double ModelObject_Impl::setCachedAggregate(const std::string& aggregate, double value) const
+  {
+    return model().getImpl<Model_Impl>()->setCachedAggregate(handle(), aggregate, value);
+  }
+
+  void ModelObject_Impl::clearCachedAggregates()
+  {
+    if (initialized()){
+      model().getImpl<Model_Impl>()->clearCachedAggregates(handle());
+    }
+  }
+
   boost::optional<ModelObject> ModelObject_Impl::parentAsModelObject() const {
     boost::optional<ModelObject> result;
     OptionalParentObject intermediate = parent();
@@ -296,6 +296,15 @@ namespace detail {
                      const std::string& scheduleDisplayName,
                      Schedule& schedule);
 
+    /** Returns the value of aggregate cached for this object by the Model, see Model_Impl::cachedAggregate. */
+    boost::optional<double> cachedAggregate(const std::string& aggregate) const;
+
+    /** Caches value as aggregate for this object in the Model and returns it. */
+    double setCachedAggregate(const std::string& aggregate, double value) const;
+
+    /** Clears the aggregates the Model cached from this object, connected to onChange by the Model. */
+    void clearCachedAggregates();
+
    private:
 
     REGISTER_LOGGER("openstudio.model.ModelObject");
@@ -48,6 +48,8 @@
 
 #include <boost/optional.hpp>
 
+#include <map>
+#include <set>
 #include <vector>
 
 namespace openstudio {
@@ -253,6 +255,29 @@ namespace detail {
 
     void disconnect(ModelObject object, unsigned port);
 
+    //@}
+    /** @name Aggregate Cache */
+    //@{
+
+    /** Returns the value of aggregate (e.g. "floorArea") cached for the object with handle, if any.
+     *  Space, ThermalZone and Building use this to avoid recomputing areas and loads from unchanged
+     *  geometry. When a surface, space load, space load definition, space type, space or thermal
+     *  zone changes, is added or is removed, only the aggregates of the spaces it feeds (before and
+     *  after the change) and of the thermal zones and building summing those spaces are cleared.
+     *  Changes to constructions, construction sets, building stories or the building clear all
+     *  cached aggregates.
+     *
+     *  The cache is filled by const getters without synchronization, like the rest of the
+     *  model's cached data it is not thread-safe. Concurrent queries on one Model, even through
+     *  const methods, must be serialized by the caller. */
+    boost::optional<double> cachedAggregate(const Handle& handle, const std::string& aggregate) const;
+
+    /** Caches value as aggregate for the object with handle and returns it, see cachedAggregate. */
+    double setCachedAggregate(const Handle& handle, const std::string& aggregate, double value) const;
+
+    /** Clears the cached aggregates that depend on the object with handle, see cachedAggregate. */
+    void clearCachedAggregates(const Handle& handle);
+
     //@}
     /** @name Nano Signals */
     //@{
@@ -303,6 +328,11 @@ namespace detail {
     mutable boost::optional<YearDescription> m_cachedYearDescription;
     mutable boost::optional<WeatherFile> m_cachedWeatherFile;
 
+    mutable std::map<std::pair<Handle, std::string>, double> m_cachedAggregates;
+    // objects with cached aggregates, by the handles of the objects they were computed from
+    mutable std::map<Handle, std::set<Handle> > m_aggregateDependents;
+    mutable bool m_aggregateDependenciesTracked;
+
   // private slots:
     void clearCachedData();
     void clearCachedBuilding(const Handle& handle);
@@ -311,6 +341,11 @@ namespace detail {
     void clearCachedRunPeriod(const Handle& handle);
     void clearCachedYearDescription(const Handle& handle);
     void clearCachedWeatherFile(const Handle& handle);
+    void clearCachedAggregates();
+    void trackAggregateDependencies();
+    void untrackAggregateDependencies();
+    void addAggregateDependency(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const IddObjectType& iddObjectType, const UUID& handle);
+    void removeAggregateDependency(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const IddObjectType& iddObjectType, const UUID& handle);
 
     typedef std::function<std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>(Model_Impl *, const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>&, bool)> CopyConstructorFunction;
     typedef std::map<IddObjectType, CopyConstructorFunction> CopyConstructorMap;
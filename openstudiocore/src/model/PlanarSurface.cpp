@@ -521,33 +521,43 @@ namespace model {
 
     std::vector<std::vector<Point3d> > PlanarSurface_Impl::triangulation() const
     {
-      if (m_cachedTriangulation.empty()){
-        Transformation faceTransformation = Transformation::alignFace(this->vertices());
-        Transformation faceTransformationInverse = faceTransformation.inverse();
+      std::vector<std::vector<Point3d> > result;
 
-        std::vector<Point3d> faceVertices = faceTransformationInverse*this->vertices();
-        std::reverse(faceVertices.begin(), faceVertices.end());
+      Transformation faceTransformation = Transformation::alignFace(this->vertices());
+      Transformation faceTransformationInverse = faceTransformation.inverse();
 
-        std::vector<std::vector<Point3d> > faceHoles;
-        for (const ModelObject& child : this->children()){
-          OptionalPlanarSurface surface = child.optionalCast<PlanarSurface>();
-          if (surface){
-            if (surface->subtractFromGrossArea()){
-              std::vector<Point3d> holeVertices = faceTransformationInverse*surface->vertices();
-              std::reverse(holeVertices.begin(), holeVertices.end());
-              faceHoles.push_back(holeVertices);
-            }
+      std::vector<std::vector<Point3d> > faceHoles;
+      for (const ModelObject& child : this->children()){
+        OptionalPlanarSurface surface = child.optionalCast<PlanarSurface>();
+        if (surface){
+          if (surface->subtractFromGrossArea()){
+            std::vector<Point3d> holeVertices = faceTransformationInverse*surface->vertices();
+            std::reverse(holeVertices.begin(), holeVertices.end());
+            faceHoles.push_back(holeVertices);
           }
         }
+      }
+
+      for (std::vector<Point3d> faceTriangle : faceTriangulation(faceHoles)){
+        std::reverse(faceTriangle.begin(), faceTriangle.end());
+        result.push_back(faceTransformation*faceTriangle);
+      }
+      return result;
+    }
 
-        std::vector<std::vector<Point3d> > faceTriangulation = computeTriangulation(faceVertices, faceHoles);
+    std::vector<std::vector<Point3d> > PlanarSurface_Impl::faceTriangulation(const std::vector<std::vector<Point3d> >& faceHoles) const
+    {
+      // sub surfaces do not signal changes to their parent, compare the holes instead
+      if (!m_cachedFaceTriangulation || (m_cachedFaceHoles != faceHoles)){
+        Transformation faceTransformation = Transformation::alignFace(this->vertices());
 
-        for (std::vector<Point3d> faceTriangle : faceTriangulation){
-          std::reverse(faceTriangle.begin(), faceTriangle.end());
-          m_cachedTriangulation.push_back(faceTransformation*faceTriangle);
-        }
+        std::vector<Point3d> faceVertices = faceTransformation.inverse()*this->vertices();
+        std::reverse(faceVertices.begin(), faceVertices.end());
+
+        m_cachedFaceTriangulation = computeTriangulation(faceVertices, faceHoles);
+        m_cachedFaceHoles = faceHoles;
       }
-      return m_cachedTriangulation;
+      return m_cachedFaceTriangulation.get();
     }
 
     Point3d PlanarSurface_Impl::centroid() const
@@ -613,7 +623,8 @@ namespace model {
       m_cachedVertices.reset();
       m_cachedPlane.reset();
       m_cachedOutwardNormal.reset();
-      m_cachedTriangulation.clear();
+      m_cachedFaceTriangulation.reset();
+      m_cachedFaceHoles.clear();
     }
 
     bool PlanarSurface_Impl::setConstructionAsModelObject(boost::optional<ModelObject> modelObject)
@@ -806,6 +817,11 @@ std::vector<std::vector<Point3d> > PlanarSurface::triangulation() const
   return getImpl<detail::PlanarSurface_Impl>()->triangulation();
 }
 
+std::vector<std::vector<Point3d> > PlanarSurface::faceTriangulation(const std::vector<std::vector<Point3d> >& faceHoles) const
+{
+  return getImpl<detail::PlanarSurface_Impl>()->faceTriangulation(faceHoles);
+}
+
 Point3d PlanarSurface::centroid() const
 {
   return getImpl<detail::PlanarSurface_Impl>()->centroid();
@@ -224,6 +224,11 @@ class MODEL_API PlanarSurface : public ParentObject {
   /// Get a triangulation of this surface, subsurfaces will be replaced by holes in the triangulation
   virtual std::vector<std::vector<Point3d> > triangulation() const;
 
+  /** Get a triangulation of this surface in face coordinates, i.e. of the reversed vertices after
+   *  Transformation::alignFace as passed to computeTriangulation, with faceHoles given in the same coordinates.
+   *  The result is cached until the vertices of this surface or the holes change. */
+  std::vector<std::vector<Point3d> > faceTriangulation(const std::vector<std::vector<Point3d> >& faceHoles) const;
+
   /// Return the centroid of this planar surface's vertices
   Point3d centroid() const;
 
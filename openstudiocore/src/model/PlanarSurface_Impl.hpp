@@ -171,6 +171,8 @@ namespace detail {
 
     std::vector<std::vector<Point3d> > triangulation() const;
 
+    std::vector<std::vector<Point3d> > faceTriangulation(const std::vector<std::vector<Point3d> >& faceHoles) const;
+
     Point3d centroid() const;
 
     std::vector<ModelObject> solarCollectors() const;
@@ -200,7 +202,8 @@ namespace detail {
     mutable boost::optional<std::vector<Point3d> > m_cachedVertices;
     mutable boost::optional<Plane> m_cachedPlane;
     mutable boost::optional<Vector3d> m_cachedOutwardNormal;
-    mutable std::vector<std::vector<Point3d> > m_cachedTriangulation;
+    mutable boost::optional<std::vector<std::vector<Point3d> > > m_cachedFaceTriangulation;
+    mutable std::vector<std::vector<Point3d> > m_cachedFaceHoles;
 
   };
 
@@ -35,9 +35,12 @@
 #include "ScheduleTypeRegistry.hpp"
 #include "ScheduleDay.hpp"
 #include "ScheduleDay_Impl.hpp"
+#include "YearDescription.hpp"
+#include "YearDescription_Impl.hpp"
 
 #include "../utilities/idf/ValidityReport.hpp"
 
+#include "../utilities/time/Time.hpp"
 #include "../utilities/core/Assert.hpp"
 
 using openstudio::Handle;
@@ -98,6 +101,71 @@ namespace detail {
     return true;
   }
 
+  std::vector<double> Schedule_Impl::annualValues(unsigned numberOfTimestepsPerHour) const {
+    if ((numberOfTimestepsPerHour == 0) || (60 % numberOfTimestepsPerHour != 0)) {
+      LOG(Error, "Number of timesteps per hour must evenly divide 60, not " << numberOfTimestepsPerHour << ".");
+      return std::vector<double>();
+    }
+
+    auto it = m_cachedAnnualValues.find(numberOfTimestepsPerHour);
+    if (it != m_cachedAnnualValues.end()) {
+      return it->second;
+    }
+
+    // the YearDescription determines the calendar for all schedule types
+    observeForAnnualValues(getObject<ModelObject>());
+    observeForAnnualValues(model().getUniqueModelObject<YearDescription>());
+    for (const ModelObject& dependency : annualValuesDependencies()) {
+      observeForAnnualValues(dependency);
+    }
+
+    std::vector<double> result = computeAnnualValues(numberOfTimestepsPerHour);
+    if (!result.empty()) {
+      m_cachedAnnualValues[numberOfTimestepsPerHour] = result;
+    }
+    return result;
+  }
+
+  std::vector<double> Schedule_Impl::computeAnnualValues(unsigned /*numberOfTimestepsPerHour*/) const {
+    LOG(Warn, "Annual values are not available for " << briefDescription() << ".");
+    return std::vector<double>();
+  }
+
+  std::vector<ModelObject> Schedule_Impl::annualValuesDependencies() const {
+    return std::vector<ModelObject>();
+  }
+
+  std::vector<double> Schedule_Impl::dayValues(const ScheduleDay& daySchedule, unsigned numberOfTimestepsPerHour) {
+    unsigned numberOfTimesteps = 24 * numberOfTimestepsPerHour;
+    int minutesPerTimestep = 60 / numberOfTimestepsPerHour;
+    std::vector<double> result(numberOfTimesteps);
+    for (unsigned i = 0; i < numberOfTimesteps; ++i) {
+      result[i] = daySchedule.getValue(openstudio::Time(0, 0, (i + 1) * minutesPerTimestep));
+    }
+    return result;
+  }
+
+  void Schedule_Impl::clearCachedAnnualValues() {
+    m_cachedAnnualValues.clear();
+  }
+
+  void Schedule_Impl::observeForAnnualValues(const ModelObject& modelObject) const {
+    // Nano signals do not de-duplicate connections, so only connect to each object once. Stale
+    // connections only cause extra invalidation and go away with the observed object.
+    if (!m_annualValuesObservedHandles.insert(modelObject.handle()).second) {
+      return;
+    }
+    auto impl = modelObject.getImpl<ModelObject_Impl>();
+    auto self = const_cast<Schedule_Impl*>(this);
+    impl->onChange.connect<Schedule_Impl, &Schedule_Impl::clearCachedAnnualValues>(self);
+    impl->onRemoveFromWorkspace.connect<Schedule_Impl, &Schedule_Impl::clearCachedAnnualValuesOnRemove>(self);
+  }
+
+  void Schedule_Impl::clearCachedAnnualValuesOnRemove(const Handle& handle) {
+    m_annualValuesObservedHandles.erase(handle);
+    clearCachedAnnualValues();
+  }
+
 } // detail
 
 Schedule::Schedule(IddObjectType type,const Model& model)
@@ -113,5 +181,9 @@ Schedule::Schedule(std::shared_ptr<detail::Schedule_Impl> impl)
   OS_ASSERT(getImpl<detail::Schedule_Impl>());
 }
 
+std::vector<double> Schedule::annualValues(unsigned numberOfTimestepsPerHour) const {
+  return getImpl<detail::Schedule_Impl>()->annualValues(numberOfTimestepsPerHour);
+}
+
 } // model
 } // openstudio
@@ -62,6 +62,18 @@ class MODEL_API Schedule : public ScheduleBase {
 
   virtual ~Schedule() {}
 
+  //@}
+  /** @name Queries */
+  //@{
+
+  /** Returns this schedule's value at the end of each timestep of the year described by the
+   *  model's YearDescription (8760 * numberOfTimestepsPerHour values, or 8784 * numberOfTimestepsPerHour
+   *  in a leap year). numberOfTimestepsPerHour must evenly divide 60. The values are computed
+   *  once per timestep and cached until this schedule, or any object it refers to, changes.
+   *  Currently supported for ScheduleConstant, ScheduleRuleset, ScheduleCompact, ScheduleYear
+   *  and ScheduleFixedInterval; returns an empty vector otherwise. */
+  std::vector<double> annualValues(unsigned numberOfTimestepsPerHour = 1) const;
+
   //@}
  protected:
   /// @cond
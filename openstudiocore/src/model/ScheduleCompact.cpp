@@ -33,6 +33,8 @@
 
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
+#include "YearDescription.hpp"
+#include "YearDescription_Impl.hpp"
 
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 
@@ -40,6 +42,13 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
+#include "../utilities/time/Date.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <algorithm>
+#include <cstdio>
 
 using openstudio::Handle;
 using openstudio::OptionalHandle;
@@ -217,6 +226,127 @@ namespace detail {
     std::vector<std::string> types;
     return types;
   }
+  std::vector<double> ScheduleCompact_Impl::computeAnnualValues(unsigned numberOfTimestepsPerHour) const {
+    YearDescription yd = this->model().getUniqueModelObject<YearDescription>();
+    unsigned numberOfDays = yd.makeDate(MonthOfYear::Dec, 31).dayOfYear();
+    unsigned numberOfTimestepsPerDay = 24 * numberOfTimestepsPerHour;
+    unsigned minutesPerTimestep = 60 / numberOfTimestepsPerHour;
+
+    std::vector<double> result(numberOfDays * numberOfTimestepsPerDay, 0.0);
+    std::vector<bool> dayIsSet(numberOfDays, false);
+
+    // days are zero-based, current Through: block covers [firstDay, endDay)
+    unsigned firstDay = 0;
+    unsigned endDay = 0;
+    std::vector<unsigned> forDays;
+    bool interpolate = false;
+    unsigned lastUntil = 0;
+    double lastValue = 0.0;
+    boost::optional<unsigned> until;
+
+    for (const IdfExtensibleGroup& eg : extensibleGroups()) {
+      std::string str = eg.getString(0,true).get();
+      boost::trim(str);
+      if (str.empty()) {
+        continue;
+      }
+
+      std::string::size_type colon = str.find(':');
+      std::string keyword = (colon == std::string::npos) ? std::string() : boost::to_lower_copy(str.substr(0, colon));
+      std::string argument = (colon == std::string::npos) ? std::string() : boost::trim_copy(str.substr(colon + 1));
+
+      if (keyword == "through") {
+        unsigned month = 0, day = 0;
+        if (std::sscanf(argument.c_str(), "%u/%u", &month, &day) != 2) {
+          LOG(Warn, "Cannot parse '" << str << "' in " << briefDescription() << ", cannot compute annual values.");
+          return std::vector<double>();
+        }
+        firstDay = endDay;
+        endDay = yd.makeDate(month, day).dayOfYear();
+        forDays.clear();
+      }
+      else if (keyword == "for") {
+        std::vector<std::string> dayTypes;
+        boost::split(dayTypes, argument, boost::is_any_of(" \t,"), boost::token_compress_on);
+
+        // each day takes the first For: block that names it, AllOtherDays picks up the remainder
+        forDays.clear();
+        for (unsigned d = firstDay; d < endDay; ++d) {
+          if (dayIsSet[d]) {
+            continue;
+          }
+          int dayOfWeek = yd.makeDate(d + 1).dayOfWeek().value();
+          bool weekend = (dayOfWeek == DayOfWeek::Saturday) || (dayOfWeek == DayOfWeek::Sunday);
+          for (const std::string& dayType : dayTypes) {
+            if (istringEqual(dayType, "AllDays") ||
+                istringEqual(dayType, "AllOtherDays") ||
+                (istringEqual(dayType, "Weekdays") && !weekend) ||
+                (istringEqual(dayType, "Weekends") && weekend) ||
+                (istringEqual(dayType, "Sunday") && (dayOfWeek == DayOfWeek::Sunday)) ||
+                (istringEqual(dayType, "Monday") && (dayOfWeek == DayOfWeek::Monday)) ||
+                (istringEqual(dayType, "Tuesday") && (dayOfWeek == DayOfWeek::Tuesday)) ||
+                (istringEqual(dayType, "Wednesday") && (dayOfWeek == DayOfWeek::Wednesday)) ||
+                (istringEqual(dayType, "Thursday") && (dayOfWeek == DayOfWeek::Thursday)) ||
+                (istringEqual(dayType, "Friday") && (dayOfWeek == DayOfWeek::Friday)) ||
+                (istringEqual(dayType, "Saturday") && (dayOfWeek == DayOfWeek::Saturday)))
+            {
+              dayIsSet[d] = true;
+              forDays.push_back(d);
+              break;
+            }
+          }
+        }
+        interpolate = false;
+        lastUntil = 0;
+        until.reset();
+      }
+      else if (keyword == "interpolate") {
+        interpolate = !istringEqual(argument, "No");
+      }
+      else if (keyword == "until") {
+        unsigned hours = 0, minutes = 0;
+        if ((std::sscanf(argument.c_str(), "%u:%u", &hours, &minutes) != 2) || (60 * hours + minutes > 24 * 60)) {
+          LOG(Warn, "Cannot parse '" << str << "' in " << briefDescription() << ", cannot compute annual values.");
+          return std::vector<double>();
+        }
+        until = 60 * hours + minutes;
+      }
+      else {
+        boost::optional<double> value = eg.getDouble(0);
+        if (!value || !until) {
+          LOG(Warn, "Unexpected field '" << str << "' in " << briefDescription() << ", cannot compute annual values.");
+          return std::vector<double>();
+        }
+
+        // timesteps ending in (lastUntil, until]
+        double startValue = (lastUntil == 0) ? *value : lastValue;
+        for (unsigned i = lastUntil / minutesPerTimestep; i < numberOfTimestepsPerDay; ++i) {
+          unsigned minutes = (i + 1) * minutesPerTimestep;
+          if (minutes > *until) {
+            break;
+          }
+          double v = *value;
+          if (interpolate && (*until > lastUntil)) {
+            v = startValue + (*value - startValue) * double(minutes - lastUntil) / double(*until - lastUntil);
+          }
+          for (unsigned d : forDays) {
+            result[d * numberOfTimestepsPerDay + i] = v;
+          }
+        }
+        lastUntil = *until;
+        lastValue = *value;
+        until.reset();
+      }
+    }
+
+    if (std::find(dayIsSet.begin(), dayIsSet.end(), false) != dayIsSet.end()) {
+      LOG(Warn, briefDescription() << " does not cover every day of the year, cannot compute annual values.");
+      return std::vector<double>();
+    }
+
+    return result;
+  }
+
 } // detail
 
 // create a new ScheduleCompact object in the model's workspace
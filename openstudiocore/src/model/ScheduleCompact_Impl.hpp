@@ -105,6 +105,8 @@ namespace detail {
     boost::optional<Quantity> getConstantValue(bool returnIP=false) const;
 
     //@}
+   protected:
+    virtual std::vector<double> computeAnnualValues(unsigned numberOfTimestepsPerHour) const override;
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleCompact");
   };
@@ -33,6 +33,8 @@
 
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
+#include "YearDescription.hpp"
+#include "YearDescription_Impl.hpp"
 
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 
@@ -40,6 +42,7 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/time/Date.hpp"
 
 using openstudio::Handle;
 using openstudio::OptionalHandle;
@@ -167,6 +170,12 @@ namespace detail {
     std::vector<std::string> types;
     return types;
   }
+  std::vector<double> ScheduleConstant_Impl::computeAnnualValues(unsigned numberOfTimestepsPerHour) const {
+    YearDescription yd = this->model().getUniqueModelObject<YearDescription>();
+    unsigned numberOfDays = yd.makeDate(MonthOfYear::Dec, 31).dayOfYear();
+    return std::vector<double>(numberOfDays * 24 * numberOfTimestepsPerHour, value());
+  }
+
 } // detail
 
 // create a new ScheduleConstant object in the model's workspace
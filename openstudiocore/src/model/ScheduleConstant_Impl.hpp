@@ -110,6 +110,8 @@ namespace detail {
     virtual void ensureNoLeapDays() override;
 
     //@}
+   protected:
+    virtual std::vector<double> computeAnnualValues(unsigned numberOfTimestepsPerHour) const override;
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleConstant");
   };
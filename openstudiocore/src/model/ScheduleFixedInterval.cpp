@@ -34,6 +34,8 @@
 
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
+#include "YearDescription.hpp"
+#include "YearDescription_Impl.hpp"
 
 #include <utilities/idd/OS_Schedule_FixedInterval_FieldEnums.hxx>
 #include <utilities/idd/IddEnums.hxx>
@@ -276,6 +278,48 @@ namespace detail {
     OS_ASSERT(result);
   }
 
+  std::vector<double> ScheduleFixedInterval_Impl::computeAnnualValues(unsigned numberOfTimestepsPerHour) const
+  {
+    YearDescription yd = this->model().getUniqueModelObject<YearDescription>();
+    unsigned numberOfDays = yd.makeDate(MonthOfYear::Dec, 31).dayOfYear();
+    Date startDate = yd.makeDate(this->startMonth(), this->startDay());
+
+    long intervalLength = static_cast<long>(this->intervalLength());
+    if (intervalLength <= 0){
+      LOG(Warn, briefDescription() << " has an invalid interval length, cannot compute annual values.");
+      return std::vector<double>();
+    }
+
+    std::vector<double> values;
+    values.reserve(this->numExtensibleGroups());
+    for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(extensibleGroups()))
+    {
+      OptionalDouble x = group.getDouble(0);
+      OS_ASSERT(x);
+      values.push_back(*x);
+    }
+
+    double outOfRangeValue = this->outOfRangeValue();
+    long startMinutes = (startDate.dayOfYear() - 1) * 24 * 60;
+    long minutesPerTimestep = 60 / numberOfTimestepsPerHour;
+    unsigned numberOfTimesteps = numberOfDays * 24 * numberOfTimestepsPerHour;
+
+    // value i applies to the interval ending intervalLength*(i+1) minutes after the start date
+    std::vector<double> result(numberOfTimesteps, outOfRangeValue);
+    for (unsigned j = 0; j < numberOfTimesteps; ++j){
+      long minutesFromStart = static_cast<long>(j + 1) * minutesPerTimestep - startMinutes;
+      if (minutesFromStart <= 0){
+        continue;
+      }
+      unsigned long i = (minutesFromStart + intervalLength - 1) / intervalLength - 1;
+      if (i < values.size()){
+        result[j] = values[i];
+      }
+    }
+
+    return result;
+  }
+
   void ScheduleFixedInterval_Impl::ensureNoLeapDays()
   {
     boost::optional<int> month;
@@ -115,6 +115,7 @@ namespace detail {
 
     //@}
    protected:
+    virtual std::vector<double> computeAnnualValues(unsigned numberOfTimestepsPerHour) const override;
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleFixedInterval");
   };
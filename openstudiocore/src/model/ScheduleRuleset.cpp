@@ -349,6 +349,9 @@ namespace detail {
 
   bool ScheduleRuleset_Impl::setScheduleRuleIndex(ScheduleRule& scheduleRule, unsigned index)
   {
+    // rules are added, removed, and reordered through here, new rules are not yet observed
+    clearCachedAnnualValues();
+
     std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
     unsigned N = scheduleRules.size();
 
@@ -488,6 +491,42 @@ namespace detail {
     }
   }
 
+  std::vector<double> ScheduleRuleset_Impl::computeAnnualValues(unsigned numberOfTimestepsPerHour) const
+  {
+    YearDescription yd = this->model().getUniqueModelObject<YearDescription>();
+    openstudio::Date startDate = yd.makeDate(MonthOfYear::Jan, 1);
+    openstudio::Date endDate = yd.makeDate(MonthOfYear::Dec, 31);
+
+    std::vector<ScheduleDay> daySchedules = this->getDaySchedules(startDate, endDate);
+
+    // evaluate each distinct day schedule only once
+    std::map<Handle, std::vector<double> > dayValuesMap;
+    std::vector<double> result;
+    result.reserve(daySchedules.size() * 24 * numberOfTimestepsPerHour);
+    for (const ScheduleDay& daySchedule : daySchedules){
+      auto it = dayValuesMap.find(daySchedule.handle());
+      if (it == dayValuesMap.end()){
+        it = dayValuesMap.insert(std::make_pair(daySchedule.handle(), dayValues(daySchedule, numberOfTimestepsPerHour))).first;
+      }
+      result.insert(result.end(), it->second.begin(), it->second.end());
+    }
+
+    return result;
+  }
+
+  std::vector<ModelObject> ScheduleRuleset_Impl::annualValuesDependencies() const
+  {
+    std::vector<ModelObject> result;
+    if (boost::optional<ScheduleDay> defaultDaySchedule = this->optionalDefaultDaySchedule()){
+      result.push_back(*defaultDaySchedule);
+    }
+    for (const ScheduleRule& scheduleRule : this->scheduleRules()){
+      result.push_back(scheduleRule);
+      result.push_back(scheduleRule.daySchedule());
+    }
+    return result;
+  }
+
   boost::optional<ScheduleDay> ScheduleRuleset_Impl::optionalDefaultDaySchedule() const {
     return getObject<ScheduleRuleset>().getModelObjectTarget<ScheduleDay>(OS_Schedule_RulesetFields::DefaultDayScheduleName);
   }
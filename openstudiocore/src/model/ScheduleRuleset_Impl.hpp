@@ -148,6 +148,10 @@ namespace detail {
     virtual void ensureNoLeapDays() override;
 
     //@}
+   protected:
+    virtual std::vector<double> computeAnnualValues(unsigned numberOfTimestepsPerHour) const override;
+
+    virtual std::vector<ModelObject> annualValuesDependencies() const override;
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleRuleset");
 
@@ -31,6 +31,8 @@
 #include "ScheduleYear_Impl.hpp"
 #include "ScheduleWeek.hpp"
 #include "ScheduleWeek_Impl.hpp"
+#include "ScheduleDay.hpp"
+#include "ScheduleDay_Impl.hpp"
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
 #include "YearDescription.hpp"
@@ -264,6 +266,80 @@ namespace detail {
     this->clearExtensibleGroups();
   }
 
+  std::vector<double> ScheduleYear_Impl::computeAnnualValues(unsigned numberOfTimestepsPerHour) const
+  {
+    YearDescription yd = this->model().getUniqueModelObject<YearDescription>();
+    openstudio::Date date = yd.makeDate(MonthOfYear::Jan, 1);
+    openstudio::Date endDate = yd.makeDate(MonthOfYear::Dec, 31);
+
+    std::vector<ScheduleWeek> scheduleWeeks = this->scheduleWeeks(); // these are already sorted
+    std::vector<openstudio::Date> dates = this->dates(); // these are already sorted
+    unsigned N = dates.size();
+    OS_ASSERT(scheduleWeeks.size() == N);
+
+    // evaluate each distinct day schedule only once
+    std::map<Handle, std::vector<double> > dayValuesMap;
+    std::vector<double> result;
+    result.reserve(endDate.dayOfYear() * 24 * numberOfTimestepsPerHour);
+
+    unsigned i = 0;
+    while (date <= endDate){
+
+      // want first date which is greater than or equal to the target date
+      while ((i < N) && (dates[i] < date)){
+        ++i;
+      }
+      if (i == N){
+        LOG(Warn, briefDescription() << " does not cover " << date << ", cannot compute annual values.");
+        return std::vector<double>();
+      }
+
+      boost::optional<ScheduleDay> daySchedule;
+      switch (date.dayOfWeek().value()){
+        case DayOfWeek::Sunday : daySchedule = scheduleWeeks[i].sundaySchedule(); break;
+        case DayOfWeek::Monday : daySchedule = scheduleWeeks[i].mondaySchedule(); break;
+        case DayOfWeek::Tuesday : daySchedule = scheduleWeeks[i].tuesdaySchedule(); break;
+        case DayOfWeek::Wednesday : daySchedule = scheduleWeeks[i].wednesdaySchedule(); break;
+        case DayOfWeek::Thursday : daySchedule = scheduleWeeks[i].thursdaySchedule(); break;
+        case DayOfWeek::Friday : daySchedule = scheduleWeeks[i].fridaySchedule(); break;
+        case DayOfWeek::Saturday : daySchedule = scheduleWeeks[i].saturdaySchedule(); break;
+        default : OS_ASSERT(false);
+      }
+      if (!daySchedule){
+        LOG(Warn, scheduleWeeks[i].briefDescription() << " has no day schedule for " << date << ", cannot compute annual values for " << briefDescription() << ".");
+        return std::vector<double>();
+      }
+
+      auto it = dayValuesMap.find(daySchedule->handle());
+      if (it == dayValuesMap.end()){
+        it = dayValuesMap.insert(std::make_pair(daySchedule->handle(), dayValues(*daySchedule, numberOfTimestepsPerHour))).first;
+      }
+      result.insert(result.end(), it->second.begin(), it->second.end());
+
+      date += Time(1);
+    }
+
+    return result;
+  }
+
+  std::vector<ModelObject> ScheduleYear_Impl::annualValuesDependencies() const
+  {
+    std::vector<ModelObject> result;
+    for (const ScheduleWeek& scheduleWeek : this->scheduleWeeks()){
+      result.push_back(scheduleWeek);
+      std::vector<boost::optional<ScheduleDay> > daySchedules = {
+        scheduleWeek.sundaySchedule(), scheduleWeek.mondaySchedule(), scheduleWeek.tuesdaySchedule(),
+        scheduleWeek.wednesdaySchedule(), scheduleWeek.thursdaySchedule(), scheduleWeek.fridaySchedule(),
+        scheduleWeek.saturdaySchedule() };
+      for (const boost::optional<ScheduleDay>& daySchedule : daySchedules){
+        if (daySchedule){
+          result.push_back(*daySchedule);
+        }
+      }
+    }
+    return result;
+  }
+
   void ScheduleYear_Impl::ensureNoLeapDays()
   {
     for (IdfExtensibleGroup group : this->extensibleGroups()){
@@ -121,6 +121,9 @@ namespace detail {
 
     //@}
    protected:
+    virtual std::vector<double> computeAnnualValues(unsigned numberOfTimestepsPerHour) const override;
+
+    virtual std::vector<ModelObject> annualValuesDependencies() const override;
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleYear");
   };
@@ -34,10 +34,14 @@
 
 #include <QObject>
 
+#include <map>
+#include <set>
+
 namespace openstudio {
 namespace model {
 
 class ScheduleTypeLimits;
+class ScheduleDay;
 
 namespace detail {
 
@@ -61,12 +65,38 @@ namespace detail {
     // virtual destructor
     virtual ~Schedule_Impl(){}
 
+    //@}
+    /** @name Queries */
+    //@{
+
+    std::vector<double> annualValues(unsigned numberOfTimestepsPerHour) const;
+
     //@}
    protected:
     virtual bool candidateIsCompatibleWithCurrentUse(const ScheduleTypeLimits& candidate) const override;
 
     virtual bool okToResetScheduleTypeLimits() const override;
+
+    /** Evaluates this schedule at the end of each timestep of the model's year. Returns an empty
+     *  vector if this type of schedule cannot be evaluated. */
+    virtual std::vector<double> computeAnnualValues(unsigned numberOfTimestepsPerHour) const;
+
+    /** Objects other than this schedule whose changes affect computeAnnualValues. */
+    virtual std::vector<ModelObject> annualValuesDependencies() const;
+
+    /** Returns the values of daySchedule at the end of each timestep of the day. */
+    static std::vector<double> dayValues(const ScheduleDay& daySchedule, unsigned numberOfTimestepsPerHour);
+
+    void clearCachedAnnualValues();
    private:
+    void observeForAnnualValues(const ModelObject& modelObject) const;
+
+    void clearCachedAnnualValuesOnRemove(const Handle& handle);
+
+    mutable std::map<unsigned, std::vector<double> > m_cachedAnnualValues;
+
+    mutable std::set<Handle> m_annualValuesObservedHandles;
+
     REGISTER_LOGGER("openstudio.model.Schedule");
   };
 
@@ -907,6 +907,10 @@ namespace detail {
 
   double Space_Impl::floorArea() const
   {
+    if (boost::optional<double> cached = cachedAggregate("floorArea")) {
+      return *cached;
+    }
+
     double result = 0;
     for (const Surface& surface : this->surfaces()) {
       if (istringEqual(surface.surfaceType(), "Floor"))
@@ -917,10 +921,14 @@ namespace detail {
         result += surface.grossArea();
       }
     }
-    return result;
+    return setCachedAggregate("floorArea", result);
   }
 
   double Space_Impl::exteriorArea() const {
+    if (boost::optional<double> cached = cachedAggregate("exteriorArea")) {
+      return *cached;
+    }
+
     double result = 0;
     for (const Surface& surface : this->surfaces()) {
       if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
@@ -928,10 +936,14 @@ namespace detail {
         result += surface.grossArea();
       }
     }
-    return result;
+    return setCachedAggregate("exteriorArea", result);
   }
 
   double Space_Impl::exteriorWallArea() const {
+    if (boost::optional<double> cached = cachedAggregate("exteriorWallArea")) {
+      return *cached;
+    }
+
     double result = 0;
     for (const Surface& surface : this->surfaces()) {
       if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
@@ -942,10 +954,14 @@ namespace detail {
         }
       }
     }
-    return result;
+    return setCachedAggregate("exteriorWallArea", result);
   }
 
   double Space_Impl::volume() const {
+    if (boost::optional<double> cached = cachedAggregate("volume")) {
+      return *cached;
+    }
+
     double result = 0;
 
     // TODO: need a better method
@@ -973,10 +989,14 @@ namespace detail {
       result = (roofHeight - floorHeight) * this->floorArea();
     }
 
-    return result;
+    return setCachedAggregate("volume", result);
   }
 
   double Space_Impl::numberOfPeople() const {
+    if (boost::optional<double> cached = cachedAggregate("numberOfPeople")) {
+      return *cached;
+    }
+
     double result = 0.0;
     double area = floorArea();
 
@@ -990,7 +1010,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return setCachedAggregate("numberOfPeople", result);
   }
 
   bool Space_Impl::setNumberOfPeople(double numberOfPeople) {
@@ -1055,6 +1075,10 @@ namespace detail {
 
 
   double Space_Impl::peoplePerFloorArea() const {
+    if (boost::optional<double> cached = cachedAggregate("peoplePerFloorArea")) {
+      return *cached;
+    }
+
     double result = 0.0;
     double area = floorArea();
 
@@ -1068,7 +1092,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return setCachedAggregate("peoplePerFloorArea", result);
   }
 
   bool Space_Impl::setPeoplePerFloorArea(double peoplePerFloorArea) {
@@ -1198,6 +1222,10 @@ namespace detail {
   }
 
   double Space_Impl::lightingPower() const {
+    if (boost::optional<double> cached = cachedAggregate("lightingPower")) {
+      return *cached;
+    }
+
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1218,7 +1246,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return setCachedAggregate("lightingPower", result);
   }
 
   bool Space_Impl::setLightingPower(double lightingPower) {
@@ -1291,6 +1319,10 @@ namespace detail {
   }
 
   double Space_Impl::lightingPowerPerFloorArea() const {
+    if (boost::optional<double> cached = cachedAggregate("lightingPowerPerFloorArea")) {
+      return *cached;
+    }
+
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1311,7 +1343,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return setCachedAggregate("lightingPowerPerFloorArea", result);
   }
 
   bool Space_Impl::setLightingPowerPerFloorArea(double lightingPowerPerFloorArea) {
@@ -1479,6 +1511,10 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPower() const {
+    if (boost::optional<double> cached = cachedAggregate("electricEquipmentPower")) {
+      return *cached;
+    }
+
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1493,7 +1529,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return setCachedAggregate("electricEquipmentPower", result);
   }
 
   double Space_Impl::electricEquipmentITEAirCooledPower() const {
@@ -1577,6 +1613,10 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPowerPerFloorArea() const {
+    if (boost::optional<double> cached = cachedAggregate("electricEquipmentPowerPerFloorArea")) {
+      return *cached;
+    }
+
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1591,7 +1631,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return setCachedAggregate("electricEquipmentPowerPerFloorArea", result);
   }
 
   double Space_Impl::electricEquipmentITEAirCooledPowerPerFloorArea() const {
@@ -1758,6 +1798,10 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPower() const {
+    if (boost::optional<double> cached = cachedAggregate("gasEquipmentPower")) {
+      return *cached;
+    }
+
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1772,7 +1816,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return setCachedAggregate("gasEquipmentPower", result);
   }
 
   bool Space_Impl::setGasEquipmentPower(double gasEquipmentPower) {
@@ -1839,6 +1883,10 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPowerPerFloorArea() const {
+    if (boost::optional<double> cached = cachedAggregate("gasEquipmentPowerPerFloorArea")) {
+      return *cached;
+    }
+
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1853,7 +1901,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return setCachedAggregate("gasEquipmentPowerPerFloorArea", result);
   }
 
   bool Space_Impl::setGasEquipmentPowerPerFloorArea(double gasEquipmentPowerPerFloorArea)
@@ -1030,43 +1030,63 @@ namespace detail {
   }
 
   double ThermalZone_Impl::floorArea() const {
+    if (boost::optional<double> cached = cachedAggregate("floorArea")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.floorArea();
     }
-    return result;
+    return setCachedAggregate("floorArea", result);
   }
 
   double ThermalZone_Impl::exteriorSurfaceArea() const {
+    if (boost::optional<double> cached = cachedAggregate("exteriorSurfaceArea")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.exteriorArea();
     }
-    return result;
+    return setCachedAggregate("exteriorSurfaceArea", result);
   }
 
   double ThermalZone_Impl::exteriorWallArea() const {
+    if (boost::optional<double> cached = cachedAggregate("exteriorWallArea")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.exteriorWallArea();
     }
-    return result;
+    return setCachedAggregate("exteriorWallArea", result);
   }
 
   double ThermalZone_Impl::airVolume() const {
+    if (boost::optional<double> cached = cachedAggregate("airVolume")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.volume();
     }
-    return result;
+    return setCachedAggregate("airVolume", result);
   }
 
   double ThermalZone_Impl::numberOfPeople() const {
+    if (boost::optional<double> cached = cachedAggregate("numberOfPeople")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.numberOfPeople();
     }
-    return result;
+    return setCachedAggregate("numberOfPeople", result);
   }
 
   double ThermalZone_Impl::peoplePerFloorArea() const {
@@ -1097,11 +1117,15 @@ namespace detail {
   }
 
   double ThermalZone_Impl::lightingPower() const {
+    if (boost::optional<double> cached = cachedAggregate("lightingPower")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.lightingPower();
     }
-    return result;
+    return setCachedAggregate("lightingPower", result);
   }
 
   double ThermalZone_Impl::lightingPowerPerFloorArea() const {
@@ -1135,11 +1159,15 @@ namespace detail {
   }
 
   double ThermalZone_Impl::electricEquipmentPower() const {
+    if (boost::optional<double> cached = cachedAggregate("electricEquipmentPower")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.electricEquipmentPower();
     }
-    return result;
+    return setCachedAggregate("electricEquipmentPower", result);
   }
 
   double ThermalZone_Impl::electricEquipmentPowerPerFloorArea() const {
@@ -1173,11 +1201,15 @@ namespace detail {
   }
 
   double ThermalZone_Impl::gasEquipmentPower() const {
+    if (boost::optional<double> cached = cachedAggregate("gasEquipmentPower")) {
+      return *cached;
+    }
+
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.gasEquipmentPower();
     }
-    return result;
+    return setCachedAggregate("gasEquipmentPower", result);
   }
 
   double ThermalZone_Impl::gasEquipmentPowerPerFloorArea() const {
@@ -60,6 +60,7 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
 #include "../utilities/geometry/Point3d.hpp"
+#include "../utilities/geometry/PointHashGrid.hpp"
 #include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/geometry/Transformation.hpp"
@@ -138,18 +139,6 @@ namespace openstudio
 
     }
 
-    size_t getVertexIndex(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001)
-    {
-      size_t n = allPoints.size();
-      for (size_t i = 0; i < n; ++i){
-        if (std::sqrt(std::pow(point3d.x()-allPoints[i].x(), 2) + std::pow(point3d.y()-allPoints[i].y(), 2) + std::pow(point3d.z()-allPoints[i].z(), 2)) < tol){
-          return i;
-        }
-      }
-      allPoints.push_back(point3d);
-      return (allPoints.size() - 1);
-    }
-
     void updateUserData(ThreeUserData& userData, const PlanarSurface& planarSurface)
     {
       std::string name = planarSurface.nameString();
@@ -319,7 +308,8 @@ namespace openstudio
 
       Point3dVectorVector finalFaceVertices;
       if (triangulateSurfaces){
-        finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
+        // cached on the surface, the viewer exports again after every edit
+        finalFaceVertices = planarSurface.faceTriangulation(faceSubVertices);
         if (finalFaceVertices.empty()){
           LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << faceSubVertices.size() << " sub surfaces");
           return;
@@ -328,7 +318,7 @@ namespace openstudio
         finalFaceVertices.push_back(faceVertices);
       }
 
-      Point3dVector allVertices;
+      PointHashGrid allVertices;
       std::vector<size_t> faceIndices;
       for (const auto& finalFaceVerts : finalFaceVertices) {
         Point3dVector finalVerts = siteTransformation*t*finalFaceVerts;
@@ -352,14 +342,14 @@ namespace openstudio
         Point3dVector::reverse_iterator it = finalVerts.rbegin();
         Point3dVector::reverse_iterator itend = finalVerts.rend();
         for (; it != itend; ++it){
-          faceIndices.push_back(getVertexIndex(*it, allVertices));
+          faceIndices.push_back(allVertices.pointIndex(*it));
         }
 
         // convert to 1 based indices
         //face_indices.each_index {|i| face_indices[i] = face_indices[i] + 1}
       }
 
-      ThreeGeometryData geometryData(toThreeVector(allVertices), faceIndices);
+      ThreeGeometryData geometryData(toThreeVector(allVertices.points()), faceIndices);
 
       ThreeGeometry geometry(toThreeUUID(toString(planarSurface.handle())), "Geometry", geometryData);
       geometries.push_back(geometry);
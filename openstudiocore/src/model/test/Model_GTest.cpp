@@ -29,6 +29,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "ModelFixture.hpp"
 
 #include "../Model.hpp"
@@ -511,6 +513,77 @@ TEST_F(ModelFixture, ExampleModel_ReloadTwoTimes)
   }
 }
 
+TEST_F(ModelFixture, ExampleModel_BinaryLoadSave)
+{
+  Model model = exampleModel();
+
+  openstudio::path textPath = toPath("./ExampleModel_BinaryLoadSave.osm");
+  openstudio::path binaryPath = toPath("./ExampleModel_BinaryLoadSave_Binary.osm");
+  EXPECT_TRUE(model.save(textPath, true));
+  EXPECT_TRUE(model.saveBinary(binaryPath, true));
+  EXPECT_TRUE(IdfFile::isBinary(binaryPath));
+  EXPECT_FALSE(IdfFile::isBinary(textPath));
+
+  boost::optional<Model> textModel = Model::load(textPath);
+  boost::optional<Model> binaryModel = Model::load(binaryPath);
+  ASSERT_TRUE(textModel);
+  ASSERT_TRUE(binaryModel);
+  ASSERT_EQ(model.numObjects(), binaryModel->numObjects());
+
+  // objects keep their handles
+  for (const WorkspaceObject& object : model.objects()) {
+    EXPECT_TRUE(binaryModel->getObject(object.handle())) << object.briefDescription();
+  }
+
+  // the binary round trip prints exactly the same text as the text round trip and the original
+  std::stringstream ss0, ss1, ss2;
+  model.toIdfFile().print(ss0);
+  textModel->toIdfFile().print(ss1);
+  binaryModel->toIdfFile().print(ss2);
+  EXPECT_EQ(ss1.str(), ss2.str());
+  EXPECT_EQ(ss0.str(), ss2.str());
+
+  // and saving the binary model again gives the same binary file
+  openstudio::path binaryPath2 = toPath("./ExampleModel_BinaryLoadSave_Binary2.osm");
+  EXPECT_TRUE(binaryModel->saveBinary(binaryPath2, true));
+  EXPECT_EQ(openstudio::filesystem::file_size(binaryPath), openstudio::filesystem::file_size(binaryPath2));
+  boost::optional<Model> binaryModel2 = Model::load(binaryPath2);
+  ASSERT_TRUE(binaryModel2);
+  std::stringstream ss3;
+  binaryModel2->toIdfFile().print(ss3);
+  EXPECT_EQ(ss2.str(), ss3.str());
+}
+
+TEST_F(ModelFixture, ExampleModel_BinaryLoadTiming)
+{
+  Model model = exampleModel();
+
+  openstudio::path textPath = toPath("./ExampleModel_BinaryLoadTiming.osm");
+  openstudio::path binaryPath = toPath("./ExampleModel_BinaryLoadTiming_Binary.osm");
+  EXPECT_TRUE(model.save(textPath, true));
+  EXPECT_TRUE(model.saveBinary(binaryPath, true));
+
+  const unsigned nLoads = 10;
+
+  auto start = std::chrono::steady_clock::now();
+  boost::optional<Model> textModel;
+  for (unsigned i = 0; i < nLoads; ++i) {
+    textModel = Model::load(textPath);
+  }
+  auto textEnd = std::chrono::steady_clock::now();
+  boost::optional<Model> binaryModel;
+  for (unsigned i = 0; i < nLoads; ++i) {
+    binaryModel = Model::load(binaryPath);
+  }
+  auto binaryEnd = std::chrono::steady_clock::now();
+  LOG(Info, "Loaded the example model " << nLoads << " times from text in "
+    << std::chrono::duration_cast<std::chrono::milliseconds>(textEnd - start).count() << " ms and from binary in "
+    << std::chrono::duration_cast<std::chrono::milliseconds>(binaryEnd - textEnd).count() << " ms");
+
+  ASSERT_TRUE(textModel);
+  ASSERT_TRUE(binaryModel);
+  EXPECT_EQ(textModel->numObjects(), binaryModel->numObjects());
+}
 
 TEST_F(ModelFixture, Model_building) {
   Model model;
@@ -838,6 +838,61 @@ TEST_F(ModelFixture, ScheduleRuleset_DesignDays)
   EXPECT_FALSE(summerSchedule.handle().isNull());
 }
 
+TEST_F(ModelFixture, ScheduleRuleset_AnnualValues)
+{
+  Model model;
+
+  // 2009-01-01 is a Thursday, 2009-01-04 a Sunday
+  model::YearDescription yd = model.getUniqueModelObject<model::YearDescription>();
+  yd.setCalendarYear(2009);
+
+  ScheduleRuleset schedule(model);
+  ScheduleDay defaultDaySchedule = schedule.defaultDaySchedule();
+  defaultDaySchedule.clearValues();
+  defaultDaySchedule.addValue(Time(0,8), 0.0);
+  defaultDaySchedule.addValue(Time(0,24), 1.0);
+
+  std::vector<double> values = schedule.annualValues(4);
+  ASSERT_EQ(8760u * 4u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[31]);
+  EXPECT_DOUBLE_EQ(1.0, values[32]);
+  EXPECT_DOUBLE_EQ(1.0, values.back());
+
+  EXPECT_TRUE(schedule.annualValues(7).empty());
+
+  // new rule invalidates the cached values
+  ScheduleRule rule(schedule);
+  rule.setApplySunday(true);
+  rule.daySchedule().clearValues();
+  rule.daySchedule().addValue(Time(0,24), 2.0);
+
+  values = schedule.annualValues(1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[0]);
+  EXPECT_DOUBLE_EQ(2.0, values[3 * 24]);
+  EXPECT_DOUBLE_EQ(1.0, values[4 * 24 + 8]);
+
+  // so does changing the rule or its day schedule
+  rule.daySchedule().addValue(Time(0,12), 3.0);
+  values = schedule.annualValues(1);
+  EXPECT_DOUBLE_EQ(3.0, values[3 * 24]);
+  EXPECT_DOUBLE_EQ(2.0, values[3 * 24 + 12]);
+
+  rule.setApplySunday(false);
+  rule.setApplyMonday(true);
+  values = schedule.annualValues(1);
+  EXPECT_DOUBLE_EQ(0.0, values[3 * 24]);
+  EXPECT_DOUBLE_EQ(3.0, values[4 * 24]);
+
+  rule.remove();
+  values = schedule.annualValues(1);
+  EXPECT_DOUBLE_EQ(0.0, values[4 * 24]);
+
+  // and so does the calendar
+  EXPECT_TRUE(yd.setCalendarYear(2012));
+  EXPECT_EQ(8784u, schedule.annualValues(1).size());
+}
+
 /*
 January
 
@@ -34,6 +34,8 @@
 #include "../ScheduleYear_Impl.hpp"
 #include "../ScheduleWeek.hpp"
 #include "../ScheduleWeek_Impl.hpp"
+#include "../ScheduleDay.hpp"
+#include "../ScheduleDay_Impl.hpp"
 #include "../YearDescription.hpp"
 #include "../YearDescription_Impl.hpp"
 #include "../ScheduleTypeLimits.hpp"
@@ -171,3 +173,66 @@ TEST_F(ModelFixture, Schedule_Year)
   ASSERT_TRUE(yearSchedule.getScheduleWeek(yd.makeDate(12,31)));
   EXPECT_EQ(weekSchedule3.handle(), yearSchedule.getScheduleWeek(yd.makeDate(12,31))->handle());
 }
+
+TEST_F(ModelFixture, ScheduleYear_AnnualValues)
+{
+  Model model;
+
+  // 2009-01-01 is a Thursday, 2009-03-01 a Sunday
+  YearDescription yd = model.getUniqueModelObject<YearDescription>();
+  yd.setCalendarYear(2009);
+
+  ScheduleDay weekday(model);
+  weekday.clearValues();
+  weekday.addValue(Time(0,8), 0.0);
+  weekday.addValue(Time(0,24), 1.0);
+
+  ScheduleDay weekend(model);
+  weekend.clearValues();
+  weekend.addValue(Time(0,24), 2.0);
+
+  ScheduleDay allDays(model);
+  allDays.clearValues();
+  allDays.addValue(Time(0,24), 3.0);
+
+  ScheduleWeek winter(model);
+  EXPECT_TRUE(winter.setWeekdaySchedule(weekday));
+  EXPECT_TRUE(winter.setWeekendSchedule(weekend));
+
+  ScheduleWeek rest(model);
+  EXPECT_TRUE(rest.setAllSchedules(allDays));
+
+  ScheduleYear yearSchedule(model);
+  EXPECT_TRUE(yearSchedule.addScheduleWeek(yd.makeDate(3,1), winter));
+
+  // does not cover the whole year
+  EXPECT_TRUE(yearSchedule.annualValues().empty());
+
+  EXPECT_TRUE(yearSchedule.addScheduleWeek(yd.makeDate(12,31), rest));
+
+  std::vector<double> values = yearSchedule.annualValues(2);
+  ASSERT_EQ(8760u * 2u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[15]);
+  EXPECT_DOUBLE_EQ(1.0, values[16]);
+  EXPECT_DOUBLE_EQ(2.0, values[2 * 48]);
+  EXPECT_DOUBLE_EQ(2.0, values[59 * 48]);
+  EXPECT_DOUBLE_EQ(3.0, values[60 * 48]);
+  EXPECT_DOUBLE_EQ(3.0, values.back());
+
+  // changing a day schedule the values were built from invalidates them
+  allDays.addValue(Time(0,12), 4.0);
+  values = yearSchedule.annualValues(2);
+  ASSERT_EQ(8760u * 2u, values.size());
+  EXPECT_DOUBLE_EQ(4.0, values[60 * 48]);
+  EXPECT_DOUBLE_EQ(3.0, values[60 * 48 + 24]);
+
+  // as does changing a week schedule
+  EXPECT_TRUE(winter.setSundaySchedule(weekday));
+  values = yearSchedule.annualValues(2);
+  EXPECT_DOUBLE_EQ(0.0, values[59 * 48]);
+  EXPECT_DOUBLE_EQ(1.0, values[59 * 48 + 16]);
+  EXPECT_DOUBLE_EQ(2.0, values[2 * 48]);
+
+  yearSchedule.clearScheduleWeeks();
+  EXPECT_TRUE(yearSchedule.annualValues(2).empty());
+}
@@ -32,9 +32,18 @@
 #include "ModelFixture.hpp"
 #include "../ScheduleConstant.hpp"
 #include "../ScheduleConstant_Impl.hpp"
+#include "../ScheduleCompact.hpp"
+#include "../ScheduleCompact_Impl.hpp"
+#include "../ScheduleFixedInterval.hpp"
+#include "../ScheduleFixedInterval_Impl.hpp"
+#include "../YearDescription.hpp"
+#include "../YearDescription_Impl.hpp"
 #include "../ScheduleTypeRegistry.hpp"
 
 #include "../../utilities/idf/ValidityReport.hpp"
+#include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/time/Date.hpp"
+#include "../../utilities/time/Time.hpp"
 
 using namespace openstudio::model;
 using namespace openstudio;
@@ -51,3 +60,52 @@ TEST_F(ModelFixture, Schedule_FinalStrictness) {
   EXPECT_EQ(0u,report.numErrors());
 }
 
+
+TEST_F(ModelFixture, Schedule_AnnualValues) {
+  Model model;
+
+  // 2009-01-01 is a Thursday, 2009-01-03 a Saturday
+  YearDescription yd = model.getUniqueModelObject<YearDescription>();
+  yd.setCalendarYear(2009);
+
+  ScheduleConstant constant(model);
+  constant.setValue(0.5);
+  std::vector<double> values = constant.annualValues(6);
+  ASSERT_EQ(8760u * 6u, values.size());
+  EXPECT_DOUBLE_EQ(0.5, values[1000]);
+  constant.setValue(0.25);
+  EXPECT_DOUBLE_EQ(0.25, constant.annualValues(6)[1000]);
+
+  ScheduleCompact compact(model);
+  compact.clearExtensibleGroups();
+  std::vector<std::string> fields = { "Through: 6/30", "For: Weekdays", "Until: 12:00", "1", "Until: 24:00", "2",
+                                      "For: AllOtherDays", "Until: 24:00", "3",
+                                      "Through: 12/31", "For: AllDays", "Until: 24:00", "4" };
+  for (const std::string& field : fields) {
+    compact.pushExtensibleGroup(std::vector<std::string>(1, field));
+  }
+  values = compact.annualValues();
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(1.0, values[0]);
+  EXPECT_DOUBLE_EQ(1.0, values[11]);
+  EXPECT_DOUBLE_EQ(2.0, values[12]);
+  EXPECT_DOUBLE_EQ(3.0, values[2 * 24]);
+  EXPECT_DOUBLE_EQ(4.0, values[181 * 24]);
+  EXPECT_DOUBLE_EQ(4.0, values.back());
+
+  // incomplete data
+  compact.clearExtensibleGroups();
+  EXPECT_TRUE(compact.annualValues().empty());
+
+  ScheduleFixedInterval fixedInterval(model);
+  Vector hourlyValues(8760);
+  for (unsigned i = 0; i < 8760; ++i) {
+    hourlyValues[i] = i;
+  }
+  EXPECT_TRUE(fixedInterval.setTimeSeries(TimeSeries(Date(MonthOfYear::Jan, 1), Time(0,1), hourlyValues, "")));
+  values = fixedInterval.annualValues(4);
+  ASSERT_EQ(8760u * 4u, values.size());
+  EXPECT_DOUBLE_EQ(0.0, values[3]);
+  EXPECT_DOUBLE_EQ(1.0, values[4]);
+  EXPECT_DOUBLE_EQ(8759.0, values.back());
+}
@@ -70,6 +70,7 @@
 #include "../../utilities/geometry/Geometry.hpp"
 #include "../../utilities/geometry/BoundingBox.hpp"
 #include "../../utilities/idf/WorkspaceObjectWatcher.hpp"
+#include "../../utilities/idf/WorkspaceTransaction.hpp"
 #include "../../utilities/core/Compare.hpp"
 
 #include <iostream>
@@ -256,6 +257,222 @@ TEST_F(ModelFixture, Space_FloorArea)
   EXPECT_NEAR(6, space.floorArea(), 0.0001);
 }
 
+TEST_F(ModelFixture, Space_CachedAggregates)
+{
+  Model model;
+  Building building = model.getUniqueModelObject<Building>();
+  Space space(model);
+  ThermalZone thermalZone(model);
+  EXPECT_TRUE(space.setThermalZone(thermalZone));
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 10, 0));
+  points.push_back(Point3d(10, 10, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  Surface floor(points, model);
+  EXPECT_TRUE(floor.setSpace(space));
+
+  EXPECT_NEAR(100, space.floorArea(), 0.0001);
+  EXPECT_NEAR(100, thermalZone.floorArea(), 0.0001);
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+
+  // changing the vertices of a surface invalidates the cached areas
+  points.clear();
+  points.push_back(Point3d(0, 20, 0));
+  points.push_back(Point3d(10, 20, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  EXPECT_TRUE(floor.setVertices(points));
+  EXPECT_NEAR(200, space.floorArea(), 0.0001);
+  EXPECT_NEAR(200, thermalZone.floorArea(), 0.0001);
+  EXPECT_NEAR(200, building.floorArea(), 0.0001);
+
+  // so does a surface created before the query and added to the space after it
+  points.clear();
+  points.push_back(Point3d(10, 20, 0));
+  points.push_back(Point3d(20, 20, 0));
+  points.push_back(Point3d(20, 0, 0));
+  points.push_back(Point3d(10, 0, 0));
+  Surface floor2(points, model);
+  EXPECT_NEAR(200, space.floorArea(), 0.0001);
+  EXPECT_TRUE(floor2.setSpace(space));
+  EXPECT_NEAR(400, space.floorArea(), 0.0001);
+
+  // thermal zone multiplier applies to the building
+  EXPECT_TRUE(thermalZone.setMultiplier(2));
+  EXPECT_NEAR(400, space.floorArea(), 0.0001);
+  EXPECT_NEAR(800, building.floorArea(), 0.0001);
+
+  // loads inherited from the space type
+  EXPECT_EQ(0, space.lightingPower());
+  SpaceType spaceType(model);
+  LightsDefinition definition(model);
+  EXPECT_TRUE(definition.setWattsperSpaceFloorArea(1));
+  Lights lights(definition);
+  EXPECT_TRUE(lights.setSpaceType(spaceType));
+  EXPECT_EQ(0, space.lightingPower());
+  EXPECT_TRUE(space.setSpaceType(spaceType));
+  EXPECT_NEAR(400, space.lightingPower(), 0.0001);
+  EXPECT_NEAR(1, space.lightingPowerPerFloorArea(), 0.0001);
+  EXPECT_NEAR(800, building.lightingPower(), 0.0001);
+  EXPECT_TRUE(definition.setWattsperSpaceFloorArea(2));
+  EXPECT_NEAR(800, space.lightingPower(), 0.0001);
+  EXPECT_NEAR(1600, building.lightingPower(), 0.0001);
+
+  // removing a surface
+  floor2.remove();
+  EXPECT_NEAR(200, space.floorArea(), 0.0001);
+  EXPECT_NEAR(400, space.lightingPower(), 0.0001);
+  EXPECT_NEAR(400, building.floorArea(), 0.0001);
+
+  // cloned models start with an empty cache
+  Model clone = model.clone().cast<Model>();
+  std::vector<Space> clonedSpaces = clone.getConcreteModelObjects<Space>();
+  ASSERT_EQ(1u, clonedSpaces.size());
+  EXPECT_NEAR(200, clonedSpaces[0].floorArea(), 0.0001);
+  clonedSpaces[0].surfaces()[0].remove();
+  EXPECT_EQ(0, clonedSpaces[0].floorArea());
+  EXPECT_NEAR(200, space.floorArea(), 0.0001);
+}
+
+TEST_F(ModelFixture, Space_CachedAggregatesInvalidation)
+{
+  Model model;
+  Building building = model.getUniqueModelObject<Building>();
+  std::shared_ptr<detail::Model_Impl> modelImpl = model.getImpl<detail::Model_Impl>();
+
+  Space space1(model);
+  ThermalZone thermalZone1(model);
+  EXPECT_TRUE(space1.setThermalZone(thermalZone1));
+  Space space2(model);
+  ThermalZone thermalZone2(model);
+  EXPECT_TRUE(space2.setThermalZone(thermalZone2));
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 10, 0));
+  points.push_back(Point3d(10, 10, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  Surface floor1(points, model);
+  EXPECT_TRUE(floor1.setSpace(space1));
+  Surface floor2(points, model);
+  EXPECT_TRUE(floor2.setSpace(space2));
+
+  EXPECT_NEAR(100, thermalZone1.floorArea(), 0.0001);
+  EXPECT_NEAR(100, thermalZone2.floorArea(), 0.0001);
+  EXPECT_NEAR(200, building.floorArea(), 0.0001);
+
+  // editing a surface of one space keeps the aggregates of the other space and its zone
+  points.clear();
+  points.push_back(Point3d(0, 20, 0));
+  points.push_back(Point3d(10, 20, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  EXPECT_TRUE(floor1.setVertices(points));
+  EXPECT_FALSE(modelImpl->cachedAggregate(space1.handle(), "floorArea"));
+  EXPECT_FALSE(modelImpl->cachedAggregate(thermalZone1.handle(), "floorArea"));
+  EXPECT_FALSE(modelImpl->cachedAggregate(building.handle(), "floorArea"));
+  EXPECT_TRUE(modelImpl->cachedAggregate(space2.handle(), "floorArea"));
+  EXPECT_TRUE(modelImpl->cachedAggregate(thermalZone2.handle(), "floorArea"));
+  EXPECT_NEAR(200, thermalZone1.floorArea(), 0.0001);
+  EXPECT_NEAR(100, thermalZone2.floorArea(), 0.0001);
+  EXPECT_NEAR(300, building.floorArea(), 0.0001);
+
+  // moving a surface clears the space it left and the space it joined
+  EXPECT_TRUE(floor1.setSpace(space2));
+  EXPECT_EQ(0, space1.floorArea());
+  EXPECT_EQ(0, thermalZone1.floorArea());
+  EXPECT_NEAR(300, space2.floorArea(), 0.0001);
+  EXPECT_NEAR(300, thermalZone2.floorArea(), 0.0001);
+  EXPECT_NEAR(300, building.floorArea(), 0.0001);
+
+  // so does moving a space between zones
+  EXPECT_TRUE(space2.setThermalZone(thermalZone1));
+  EXPECT_NEAR(300, thermalZone1.floorArea(), 0.0001);
+  EXPECT_EQ(0, thermalZone2.floorArea());
+
+  // loads on a space type clear the spaces using it
+  SpaceType spaceType(model);
+  EXPECT_TRUE(space1.setSpaceType(spaceType));
+  LightsDefinition definition(model);
+  EXPECT_TRUE(definition.setWattsperSpaceFloorArea(1));
+  EXPECT_EQ(0, space2.lightingPower());
+  EXPECT_EQ(0, space1.lightingPower());
+  Lights lights(definition);
+  EXPECT_TRUE(lights.setSpaceType(spaceType));
+  EXPECT_TRUE(modelImpl->cachedAggregate(space2.handle(), "lightingPower"));
+  EXPECT_FALSE(modelImpl->cachedAggregate(space1.handle(), "lightingPower"));
+  EXPECT_TRUE(space2.setSpaceType(spaceType));
+  EXPECT_NEAR(300, space2.lightingPower(), 0.0001);
+  EXPECT_NEAR(300, building.lightingPower(), 0.0001);
+
+  // and stop applying once the load moves to a space
+  EXPECT_TRUE(lights.setSpace(space1));
+  EXPECT_EQ(0, space2.lightingPower());
+  EXPECT_EQ(0, space1.lightingPower());
+  EXPECT_TRUE(definition.setWattsperSpaceFloorArea(2));
+  EXPECT_EQ(0, building.lightingPower());
+}
+
+TEST_F(ModelFixture, Space_CachedAggregatesInTransaction)
+{
+  Model model;
+  Building building = model.getUniqueModelObject<Building>();
+  Space space(model);
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 10, 0));
+  points.push_back(Point3d(10, 10, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  Surface floor(points, model);
+  EXPECT_TRUE(floor.setSpace(space));
+
+  EXPECT_NEAR(100, floor.grossArea(), 0.0001);
+  EXPECT_NEAR(-1, floor.outwardNormal().z(), 0.0001);
+  EXPECT_NEAR(100, space.floorArea(), 0.0001);
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+
+  Point3dVector largerPoints;
+  largerPoints.push_back(Point3d(0, 20, 0));
+  largerPoints.push_back(Point3d(10, 20, 0));
+  largerPoints.push_back(Point3d(10, 0, 0));
+  largerPoints.push_back(Point3d(0, 0, 0));
+  Point3dVector flippedPoints(largerPoints.rbegin(), largerPoints.rend());
+
+  // cached geometry and aggregates follow edits made inside a transaction
+  {
+    WorkspaceTransaction transaction(model);
+    EXPECT_TRUE(floor.setVertices(largerPoints));
+    EXPECT_NEAR(200, floor.grossArea(), 0.0001);
+    EXPECT_NEAR(-1, floor.outwardNormal().z(), 0.0001);
+    EXPECT_NEAR(200, space.floorArea(), 0.0001);
+    EXPECT_NEAR(200, building.floorArea(), 0.0001);
+
+    EXPECT_TRUE(floor.setVertices(flippedPoints));
+    EXPECT_NEAR(200, floor.grossArea(), 0.0001);
+    EXPECT_NEAR(1, floor.outwardNormal().z(), 0.0001);
+  }
+
+  // and are cleared again when it rolls back
+  EXPECT_EQ(4u, floor.vertices().size());
+  EXPECT_NEAR(100, floor.grossArea(), 0.0001);
+  EXPECT_NEAR(-1, floor.outwardNormal().z(), 0.0001);
+  EXPECT_NEAR(100, space.floorArea(), 0.0001);
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+
+  {
+    WorkspaceTransaction transaction(model);
+    EXPECT_TRUE(floor.setVertices(largerPoints));
+    EXPECT_NEAR(200, space.floorArea(), 0.0001);
+    EXPECT_TRUE(transaction.commit());
+  }
+  EXPECT_NEAR(200, floor.grossArea(), 0.0001);
+  EXPECT_NEAR(200, space.floorArea(), 0.0001);
+  EXPECT_NEAR(200, building.floorArea(), 0.0001);
+}
+
 TEST_F(ModelFixture, Space_Attributes)
 {
   Model model;
@@ -87,6 +87,7 @@
 
 #include "../../utilities/geometry/Geometry.hpp"
 #include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/geometry/Transformation.hpp"
 #include "../../utilities/geometry/Vector3d.hpp"
 
 #include "../../utilities/math/FloatCompare.hpp"
@@ -306,6 +307,64 @@ TEST_F(ModelFixture, Surface_Area)
   EXPECT_EQ(5.0, triangulatedArea(surface.triangulation()));
 }
 
+TEST_F(ModelFixture, Surface_Triangulation_Cache)
+{
+  Model model;
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 0, 3));
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(4, 0, 0));
+  points.push_back(Point3d(4, 0, 3));
+
+  Surface surface(points, model);
+  EXPECT_NEAR(12.0, triangulatedArea(surface.triangulation()), 1.0e-8);
+
+  // repeated calls give the same triangulation
+  std::vector<std::vector<Point3d> > faceHoles;
+  std::vector<std::vector<Point3d> > faceTriangulation = surface.faceTriangulation(faceHoles);
+  EXPECT_EQ(faceTriangulation, surface.faceTriangulation(faceHoles));
+  EXPECT_NEAR(12.0, triangulatedArea(faceTriangulation), 1.0e-8);
+
+  // adding a sub surface changes the holes
+  points.clear();
+  points.push_back(Point3d(1, 0, 2));
+  points.push_back(Point3d(1, 0, 1));
+  points.push_back(Point3d(2, 0, 1));
+  points.push_back(Point3d(2, 0, 2));
+
+  SubSurface window(points, model);
+  EXPECT_TRUE(window.setSurface(surface));
+  EXPECT_NEAR(11.0, triangulatedArea(surface.triangulation()), 1.0e-8);
+
+  // sub surface edits are not signaled to the parent surface
+  points.clear();
+  points.push_back(Point3d(1, 0, 2));
+  points.push_back(Point3d(1, 0, 1));
+  points.push_back(Point3d(3, 0, 1));
+  points.push_back(Point3d(3, 0, 2));
+  EXPECT_TRUE(window.setVertices(points));
+  EXPECT_NEAR(10.0, triangulatedArea(surface.triangulation()), 1.0e-8);
+
+  // explicit holes in face coordinates are honored
+  Transformation faceTransformation = Transformation::alignFace(surface.vertices());
+  Point3dVector faceHole = faceTransformation.inverse()*window.vertices();
+  std::reverse(faceHole.begin(), faceHole.end());
+  faceHoles.clear();
+  faceHoles.push_back(faceHole);
+  EXPECT_NEAR(10.0, triangulatedArea(surface.faceTriangulation(faceHoles)), 1.0e-8);
+  EXPECT_NEAR(12.0, triangulatedArea(surface.faceTriangulation(std::vector<std::vector<Point3d> >())), 1.0e-8);
+
+  // changing the surface vertices clears the cache
+  points.clear();
+  points.push_back(Point3d(0, 0, 3));
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(5, 0, 0));
+  points.push_back(Point3d(5, 0, 3));
+  EXPECT_TRUE(surface.setVertices(points));
+  EXPECT_NEAR(13.0, triangulatedArea(surface.triangulation()), 1.0e-8);
+}
+
 /* HAS TO WAIT UNTIL WE GET A GOOD OSM EXAMPLE
 TEST_F(ModelFixture, Surface_Area_In_File)
 {
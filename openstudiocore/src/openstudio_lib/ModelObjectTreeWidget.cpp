@@ -60,10 +60,10 @@ ModelObjectTreeWidget::ModelObjectTreeWidget(const model::Model& model, QWidget*
   m_vLayout->addWidget(m_treeWidget);
 
   // model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.connect<ModelObjectTreeWidget, &ModelObjectTreeWidget::objectAdded>(this);
-  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &ModelObjectTreeWidget::objectAdded, Qt::QueuedConnection);
+  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectsAddedPtr, this, &ModelObjectTreeWidget::objectsAdded);
 
   //model.getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObjectPtr.connect<ModelObjectTreeWidget, &ModelObjectTreeWidget::objectRemoved>(this);
-  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectRemovedPtr, this, &ModelObjectTreeWidget::objectRemoved, Qt::QueuedConnection);
+  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectsRemovedPtr, this, &ModelObjectTreeWidget::objectsRemoved);
 }
 
 OSItem* ModelObjectTreeWidget::selectedItem() const
@@ -87,14 +87,18 @@ openstudio::model::Model ModelObjectTreeWidget::model() const
   return m_model;
 }
 
-void ModelObjectTreeWidget::objectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+void ModelObjectTreeWidget::objectsAdded(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes)
 {
-  onObjectAdded(impl->getObject<model::ModelObject>(), iddObjectType, handle);
+  for (const auto& change : changes){
+    onObjectAdded(change.object->getObject<model::ModelObject>(), change.iddObjectType, change.handle);
+  }
 }
 
-void ModelObjectTreeWidget::objectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+void ModelObjectTreeWidget::objectsRemoved(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes)
 {
-  onObjectRemoved(impl->getObject<model::ModelObject>(), iddObjectType, handle);
+  for (const auto& change : changes){
+    onObjectRemoved(change.object->getObject<model::ModelObject>(), change.iddObjectType, change.handle);
+  }
 }
 
 void ModelObjectTreeWidget::refresh()
@@ -34,6 +34,7 @@
 #include <nano/nano_signal_slot.hpp> // Signal-Slot replacement
 
 #include "../model/Model.hpp"
+#include "../utilities/idf/Workspace_Impl.hpp"
 
 class QTreeWidget;
 
@@ -69,9 +70,9 @@ class ModelObjectTreeWidget : public OSItemSelector, public Nano::Observer
 
   private slots:
 
-    void objectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+    void objectsAdded(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes);
 
-    void objectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+    void objectsRemoved(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes);
 
   private:
 
@@ -67,10 +67,10 @@ void ModelObjectVectorController::attachModel(const model::Model& model)
   if (m_model){
 
     // m_model->getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.disconnect<ModelObjectVectorController, &ModelObjectVectorController::objectAdded>(this);
-    disconnect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &ModelObjectVectorController::objectAdded);
+    disconnect(OSAppBase::instance(), &OSAppBase::workspaceObjectsAddedPtr, this, &ModelObjectVectorController::objectsAdded);
 
      //m_model->getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObjectPtr.disconnect<ModelObjectVectorController, &ModelObjectVectorController::objectRemoved>(this);
-    disconnect(OSAppBase::instance(), &OSAppBase::workspaceObjectRemovedPtr, this, &ModelObjectVectorController::objectRemoved);
+    disconnect(OSAppBase::instance(), &OSAppBase::workspaceObjectsRemovedPtr, this, &ModelObjectVectorController::objectsRemoved);
 
     m_model.reset();
   }
@@ -78,10 +78,10 @@ void ModelObjectVectorController::attachModel(const model::Model& model)
   m_model = model;
 
   // m_model->getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.connect<ModelObjectVectorController, &ModelObjectVectorController::objectAdded>(this);
-  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &ModelObjectVectorController::objectAdded, Qt::QueuedConnection);
+  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectsAddedPtr, this, &ModelObjectVectorController::objectsAdded);
 
   //m_model->getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObjectPtr.connect<ModelObjectVectorController, &ModelObjectVectorController::objectRemoved>(this);
-  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectRemovedPtr, this, &ModelObjectVectorController::objectRemoved, Qt::QueuedConnection);
+  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectsRemovedPtr, this, &ModelObjectVectorController::objectsRemoved);
 }
 
 void ModelObjectVectorController::attachOtherModelObject(const model::ModelObject& modelObject)
@@ -113,10 +113,10 @@ void ModelObjectVectorController::detach()
 
   if (m_model){
     // m_model->getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.disconnect<ModelObjectVectorController, &ModelObjectVectorController::objectAdded>(this);
-    disconnect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &ModelObjectVectorController::objectAdded);
+    disconnect(OSAppBase::instance(), &OSAppBase::workspaceObjectsAddedPtr, this, &ModelObjectVectorController::objectsAdded);
 
      //m_model->getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObjectPtr.disconnect<ModelObjectVectorController, &ModelObjectVectorController::objectRemoved>(this);
-    disconnect(OSAppBase::instance(), &OSAppBase::workspaceObjectRemovedPtr, this, &ModelObjectVectorController::objectRemoved);
+    disconnect(OSAppBase::instance(), &OSAppBase::workspaceObjectsRemovedPtr, this, &ModelObjectVectorController::objectsRemoved);
 
     m_model.reset();
   }
@@ -148,7 +148,7 @@ void ModelObjectVectorController::detachOtherModelObjects()
 {
   for (size_t i = 0; i < m_otherModelObjects.size(); i++) {
     // m_model->getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.disconnect<ModelObjectVectorController, &ModelObjectVectorController::objectAdded>(this);
-    disconnect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &ModelObjectVectorController::objectAdded);
+    disconnect(OSAppBase::instance(), &OSAppBase::workspaceObjectsAddedPtr, this, &ModelObjectVectorController::objectsAdded);
 
     // m_model->getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObjectPtr.disconnect<ModelObjectVectorController, &ModelObjectVectorController::objectRemoved>(this);
     //connect(OSAppBase::instance(), &OSAppBase::workspaceObjectRemovedPtr, this, &ModelObjectVectorController::objectRemoved, Qt::QueuedConnection);
@@ -178,14 +178,18 @@ void ModelObjectVectorController::change()
   }
 }
 
-void ModelObjectVectorController::objectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+void ModelObjectVectorController::objectsAdded(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes)
 {
-  onObjectAdded(impl->getObject<model::ModelObject>(), iddObjectType, handle);
+  for (const auto& change : changes){
+    onObjectAdded(change.object->getObject<model::ModelObject>(), change.iddObjectType, change.handle);
+  }
 }
 
-void ModelObjectVectorController::objectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+void ModelObjectVectorController::objectsRemoved(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes)
 {
-  onObjectRemoved(impl->getObject<model::ModelObject>(), iddObjectType, handle);
+  for (const auto& change : changes){
+    onObjectRemoved(change.object->getObject<model::ModelObject>(), change.iddObjectType, change.handle);
+  }
 }
 
 void ModelObjectVectorController::onChangeRelationship(const openstudio::model::ModelObject& modelObject, int index, Handle newHandle, Handle oldHandle)
@@ -33,6 +33,7 @@
 #include "OSVectorController.hpp"
 #include "../model/ModelObject.hpp"
 #include "../model/Component.hpp"
+#include "../utilities/idf/Workspace_Impl.hpp"
 #include <vector>
 
 namespace openstudio {
@@ -53,9 +54,9 @@ public:
 
 protected slots:
 
-  void objectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+  void objectsAdded(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes);
 
-  void objectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+  void objectsRemoved(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes);
 
   void changeRelationship(int index, Handle newHandle, Handle oldHandle);
 
@@ -51,7 +51,7 @@
 namespace openstudio {
 
 OSAppBase::OSAppBase( int & argc, char ** argv, const QSharedPointer<MeasureManager> &t_measureManager )
-  : QApplication(argc, argv), m_measureManager(t_measureManager)
+  : QApplication(argc, argv), m_measureManager(t_measureManager), m_workspaceObjectChangesScheduled(false)
 {
   openstudio::path userMeasuresDir = BCLMeasure::userMeasuresDir();
 
@@ -130,6 +130,41 @@ void OSAppBase::removeWorkspaceObjectPtr(std::shared_ptr<openstudio::detail::Wor
   emit workspaceObjectRemovedPtr(wPtr, type, uuid);
 }
 
+void OSAppBase::addWorkspaceObjects(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes) {
+  for (const auto& change : changes) {
+    m_workspaceObjectChanges.added(change);
+  }
+  if (!m_workspaceObjectChangesScheduled) {
+    m_workspaceObjectChangesScheduled = true;
+    QTimer::singleShot(0, this, SLOT(emitWorkspaceObjectChanges()));
+  }
+}
+
+void OSAppBase::removeWorkspaceObjects(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes) {
+  for (const auto& change : changes) {
+    m_workspaceObjectChanges.removed(change);
+  }
+  if (!m_workspaceObjectChangesScheduled) {
+    m_workspaceObjectChangesScheduled = true;
+    QTimer::singleShot(0, this, SLOT(emitWorkspaceObjectChanges()));
+  }
+}
+
+void OSAppBase::emitWorkspaceObjectChanges() {
+  m_workspaceObjectChangesScheduled = false;
+
+  std::vector<openstudio::detail::WorkspaceObjectChange> added;
+  std::vector<openstudio::detail::WorkspaceObjectChange> removed;
+  m_workspaceObjectChanges.take(added, removed);
+
+  if (!removed.empty()) {
+    emit workspaceObjectsRemovedPtr(removed);
+  }
+  if (!added.empty()) {
+    emit workspaceObjectsAddedPtr(added);
+  }
+}
+
 QWidget *OSAppBase::mainWidget()
 {
   std::shared_ptr<OSDocument> document = currentDocument();
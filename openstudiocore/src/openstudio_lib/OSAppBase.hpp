@@ -36,6 +36,7 @@
 
 #include "OpenStudioAPI.hpp"
 #include "../utilities/core/Logger.hpp"
+#include "../utilities/idf/Workspace_Impl.hpp"
 
 #include <QApplication>
 
@@ -88,6 +89,10 @@ class OPENSTUDIO_API OSAppBase : public QApplication, public BaseApp
   void removeWorkspaceObject(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
   void removeWorkspaceObjectPtr(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type, const openstudio::UUID& uuid );
 
+  void addWorkspaceObjects(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes);
+
+  void removeWorkspaceObjects(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes);
+
   signals:
   void workspaceObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
   void workspaceObjectAddedPtr(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
@@ -95,6 +100,12 @@ class OPENSTUDIO_API OSAppBase : public QApplication, public BaseApp
   void workspaceObjectRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
   void workspaceObjectRemovedPtr(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
 
+  // All objects added to or removed from the model since the last pass through the event loop,
+  // emitted at most once per pass. Already deferred, so connect directly rather than queued.
+  void workspaceObjectsAddedPtr(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes);
+
+  void workspaceObjectsRemovedPtr(const std::vector<openstudio::detail::WorkspaceObjectChange>& changes);
+
   protected:
 
   virtual bool event(QEvent * e) override;
@@ -109,6 +120,14 @@ class OPENSTUDIO_API OSAppBase : public QApplication, public BaseApp
 
   boost::shared_ptr<WaitDialog> m_waitDialog;
 
+  detail::WorkspaceObjectChangeQueue m_workspaceObjectChanges;
+
+  bool m_workspaceObjectChangesScheduled;
+
+  private slots:
+
+  void emitWorkspaceObjectChanges();
+
   public slots:
 
   virtual void reloadFile(const QString& osmPath, bool modified, bool saveCurrentTabs) = 0;
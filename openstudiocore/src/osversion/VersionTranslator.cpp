@@ -288,6 +288,9 @@ boost::optional<model::Model> VersionTranslator::loadModel(const openstudio::pat
   }
 
   path wp = completePathToFile(pathToOldOsm,path(),modelFileExtension(),false);
+  if (IdfFile::isBinary(wp)) {
+    return updateVersion(wp, false, progressBar);
+  }
   openstudio::filesystem::ifstream inFile(wp);
   if (inFile) {
     return loadModel(inFile,progressBar);
@@ -319,6 +322,13 @@ boost::optional<model::Component> VersionTranslator::loadComponent(const openstu
     return boost::none;
   }
   path wp = completePathToFile(pathToOldOsc,path(),componentFileExtension(),false);
+  if (IdfFile::isBinary(wp)) {
+    model::OptionalModel result = updateVersion(wp, true, progressBar);
+    if (result) {
+      return result->optionalCast<model::Component>();
+    }
+    return boost::none;
+  }
   openstudio::filesystem::ifstream inFile(wp);
   if (inFile) {
     return loadComponent(inFile,progressBar);
@@ -390,6 +400,38 @@ void VersionTranslator::setAllowNewerVersions(bool allowNewerVersions)
 boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
                                                                bool isComponent,
                                                                ProgressBar* progressBar) {
+  resetTranslation(isComponent);
+  initializeMap(is);
+  return translateMap(progressBar);
+}
+
+boost::optional<model::Model> VersionTranslator::updateVersion(const openstudio::path& binaryPath,
+                                                               bool isComponent,
+                                                               ProgressBar* progressBar) {
+  resetTranslation(isComponent);
+
+  // binary files are only written and read with the current IDD, so there is nothing to update
+  // but they still go through the same validity checks and fixes as text files
+  OptionalIdfFile oIdfFile = IdfFile::loadBinary(binaryPath);
+  if (!oIdfFile) {
+    LOG(Error,"Unable to load binary file '" << toString(binaryPath) << "'.");
+    return boost::none;
+  }
+  if (!(oIdfFile->iddFileType() == IddFileType::OpenStudio)) {
+    LOG(Error,"Binary file '" << toString(binaryPath) << "' uses IddFileType "
+        << oIdfFile->iddFileType().valueName() << ", not OpenStudio.");
+    return boost::none;
+  }
+
+  m_originalVersion = oIdfFile->version();
+  m_nObjectsStart = oIdfFile->numObjects();
+  m_map[VersionString(openStudioVersion())] = *oIdfFile;
+  LOG(Debug,"Initial model has " << m_nObjectsStart << " objects.");
+
+  return translateMap(progressBar);
+}
+
+void VersionTranslator::resetTranslation(bool isComponent) {
   m_originalVersion = VersionString("0.0.0");
   m_map.clear();
   m_logSink.setThreadId(QThread::currentThread());
@@ -402,8 +444,9 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
   m_nObjectsFinalIdf = 0;
   m_nObjectsFinalModel = 0;
   m_isComponent = isComponent;
+}
 
-  initializeMap(is);
+boost::optional<model::Model> VersionTranslator::translateMap(ProgressBar* progressBar) {
   OS_ASSERT(m_map.size() < 2u);
   if (m_map.size() == 0u) {
     return boost::none;
@@ -457,7 +500,7 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
   OS_ASSERT(test);
   fixInterobjectIssuesStage2(tempModel,issueInfo);
 
-  if (isComponent) {
+  if (m_isComponent) {
     try {
       result = model::Component(tempModel.toIdfFile()); // includes name conflict fixes
     }
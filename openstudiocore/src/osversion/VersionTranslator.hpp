@@ -98,7 +98,8 @@ class OSVERSION_API VersionTranslator {
   //@{
 
   /** Returns a current-version OpenStudio Model, if possible. The file at pathToOldOsm must
-   *  be an osm of version 0.7.0 or later. */
+   *  be an osm of version 0.7.0 or later, or a binary osm written by Workspace::saveBinary
+   *  with the current version. */
   boost::optional<model::Model> loadModel(const openstudio::path& pathToOldOsm,
                                           ProgressBar* progressBar = nullptr);
 
@@ -182,8 +183,18 @@ class OSVERSION_API VersionTranslator {
                                               bool isComponent,
                                               ProgressBar* progressBar = nullptr);
 
+  // loads a file written by IdfFile::saveBinary, which is always at the current version
+  boost::optional<model::Model> updateVersion(const openstudio::path& binaryPath,
+                                              bool isComponent,
+                                              ProgressBar* progressBar = nullptr);
+
+  void resetTranslation(bool isComponent);
+
   void initializeMap(std::istream& is);
 
+  // updates the model in m_map to the current version and checks it
+  boost::optional<model::Model> translateMap(ProgressBar* progressBar);
+
   IddFileAndFactoryWrapper getIddFile(const VersionString& version);
 
   void update(const VersionString& startVersion);
@@ -388,6 +388,30 @@ TEST_F(OSVersionFixture,VersionTranslator_FutureVersion_ExampleModel2) {
   m2 = translator.loadModel(ss);
   EXPECT_FALSE(m2);
 }
+
+TEST_F(OSVersionFixture,VersionTranslator_BinaryModel) {
+  model::Model model = model::exampleModel();
+
+  openstudio::path textPath = toPath("./VersionTranslator_BinaryModel.osm");
+  openstudio::path binaryPath = toPath("./VersionTranslator_BinaryModel_Binary.osm");
+  EXPECT_TRUE(model.save(textPath, true));
+  EXPECT_TRUE(model.saveBinary(binaryPath, true));
+
+  osversion::VersionTranslator translator;
+  boost::optional<model::Model> textModel = translator.loadModel(textPath);
+  ASSERT_TRUE(textModel);
+
+  boost::optional<model::Model> binaryModel = translator.loadModel(binaryPath);
+  ASSERT_TRUE(binaryModel);
+  EXPECT_TRUE(translator.errors().empty());
+  EXPECT_TRUE(translator.warnings().empty());
+  EXPECT_EQ(VersionString(openStudioVersion()), translator.originalVersion());
+
+  std::stringstream ss1, ss2;
+  textModel->toIdfFile().print(ss1);
+  binaryModel->toIdfFile().print(ss2);
+  EXPECT_EQ(ss1.str(), ss2.str());
+}
 /*
 TEST_F(OSVersionFixture,VersionTranslator_0_7_4_NameRefsTranslated) {
   // Translator adds handle fields, but leaves initial name references as-is.
@@ -30,34 +30,89 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
-#include <iostream>
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/FilesystemHelpers.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
 #include <fstream>
 #include <vector>
 
-#include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
-
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
-
 using namespace std;
-using namespace boost;
 using namespace openstudio;
 
 namespace openstudio{
 namespace radiance{
 
+  namespace {
+
+    // conversion from footcandles to lux
+    const double footcandlesToLux(10.76);
+
+    // identifies the binary cache layout, bump the version when the layout changes
+    const char cacheMagic[8] = {'O', 'S', 'A', 'I', 'M', '0', '0', '2'};
+
+    template<typename T>
+    void writeValue(std::ostream& os, const T& t)
+    {
+      os.write(reinterpret_cast<const char*>(&t), sizeof(T));
+    }
+
+    template<typename T>
+    void writeValues(std::ostream& os, const T* t, size_t n)
+    {
+      if (n > 0){
+        os.write(reinterpret_cast<const char*>(t), n*sizeof(T));
+      }
+    }
+
+    template<typename T>
+    bool readValue(std::istream& is, T& t)
+    {
+      return static_cast<bool>(is.read(reinterpret_cast<char*>(&t), sizeof(T)));
+    }
+
+    template<typename T>
+    bool readValues(std::istream& is, T* t, size_t n)
+    {
+      if (n == 0){
+        return true;
+      }
+      return static_cast<bool>(is.read(reinterpret_cast<char*>(t), n*sizeof(T)));
+    }
+
+  }
+
+  DaylightMetricThresholds::DaylightMetricThresholds()
+    : daylightAutonomy(300.0), usefulDaylightLower(100.0), usefulDaylightUpper(2000.0)
+  {}
+
+  DaylightMetricThresholds::DaylightMetricThresholds(double daylightAutonomy, double usefulDaylightLower, double usefulDaylightUpper)
+    : daylightAutonomy(daylightAutonomy), usefulDaylightLower(usefulDaylightLower), usefulDaylightUpper(usefulDaylightUpper)
+  {}
+
   /// default constructor
   AnnualIlluminanceMap::AnnualIlluminanceMap()
+    : m_sourceStampTakenAt(0)
   {}
 
   /// constructor with path
   AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::path& path)
+    : m_sourceStampTakenAt(0)
+  {
+    init(path, true);
+  }
+
+  AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::path& path, const DaylightMetricThresholds& thresholds, bool keepIlluminance)
+    : m_sourceStampTakenAt(0), m_thresholds(thresholds)
   {
-    init(path);
+    init(path, keepIlluminance);
   }
 
-  void AnnualIlluminanceMap::init(const openstudio::path& path)
+  void AnnualIlluminanceMap::init(const openstudio::path& path, bool keepIlluminance)
   {
     // file must exist
     if (!exists( path )){
@@ -65,6 +120,15 @@ namespace radiance{
       return;
     }
 
+    m_path = path;
+
+    // stamp the file before reading it, so a rewrite while it is read makes a saved cache stale
+    m_sourceStampTakenAt = std::time(nullptr);
+    openstudio::filesystem::FileStamp sourceStamp;
+    if (openstudio::filesystem::file_stamp(path, sourceStamp)){
+      m_sourceStamp = sourceStamp;
+    }
+
     // open file
     openstudio::filesystem::ifstream file(path);
 
@@ -75,20 +139,14 @@ namespace radiance{
     unsigned M=0;
     unsigned N=0;
 
-    // temp string to read file
+    // temp string to read file, reused for every line
     string line;
 
     // lines 1 and 2 are the header lines
     string line1, line2;
 
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
-
-    // conversion from footcandles to lux
-    const double footcandlesToLux(10.76);
+    // illuminance values of the current line in lux
+    std::vector<float> values;
 
     // read the rest of the file line by line
     while(getline(file, line)){
@@ -115,51 +173,83 @@ namespace radiance{
         M = m_xVector.size();
         N = m_yVector.size();
 
+        values.resize(M*N);
+        m_daylightAutonomyCounts.assign(M*N, 0);
+        m_usefulDaylightCounts.assign(M*N, 0);
+
       }else{
 
         // each line contains the month, day, time (in hours),
         // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
         // followed by M*N illuminance points
 
-        // break the line up by spaces
-        vector<string> lineVector;
-        tokenizer<char_separator<char>, std::string::const_iterator, std::string > tk(line, char_separator<char>(" "));
-        for (tokenizer<char_separator<char>, std::string::const_iterator, std::string >::iterator it(tk.begin()); it!=tk.end(); ++it)
-        {
-           lineVector.push_back(*it);
+        // parse the numbers in place, illuminance values go straight into the row buffer
+        double header[6];
+        unsigned numNumbers = 0;
+        const char* p = line.c_str();
+        char* end = nullptr;
+        while (true){
+          while (*p == ' ' || *p == '\t' || *p == '\r'){
+            ++p;
+          }
+          if (*p == '\0'){
+            break;
+          }
+
+          double value = std::strtod(p, &end);
+          if (end == p){
+            LOG(Fatal, "Cannot read illuminance value on line " << lineNum << ": '" << std::string(p, std::min<size_t>(std::strlen(p), 20)) << "'.");
+            return;
+          }
+          p = end;
+
+          if (numNumbers < 6){
+            header[numNumbers] = value;
+          }else if (numNumbers - 6 < M*N){
+            values[numNumbers - 6] = static_cast<float>(footcandlesToLux*value);
+          }
+          ++numNumbers;
         }
 
         // total number minus 6 standard header items
-        unsigned numValues = lineVector.size() - 6;
+        unsigned numValues = (numNumbers < 6) ? 0 : numNumbers - 6;
 
-        if (numValues != M*N){
+        if (numNumbers < 6 || numValues != M*N){
           LOG(Fatal,  "Incorrect number of illuminance values read " << numValues << ", expecting " << M*N << ".");
           return;
         }else{
 
-          MonthOfYear month = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          unsigned day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+          MonthOfYear month = monthOfYear(static_cast<unsigned>(header[0]));
+          unsigned day = static_cast<unsigned>(header[1]);
+          double fracDays = header[2] / 24.0;
 
           // ignore solar angles and global horizontal for now
 
           // make the date time
           DateTime dateTime(Date(month, day), Time(fracDays));
 
-          // matrix we are going to read in
-          Matrix illuminanceMap(M,N);
+          // accumulate daylight metrics
+          for (unsigned k = 0; k < M*N; ++k){
+            double value = values[k];
+            if (value >= m_thresholds.daylightAutonomy){
+              ++m_daylightAutonomyCounts[k];
+            }
+            if (value >= m_thresholds.usefulDaylightLower && value <= m_thresholds.usefulDaylightUpper){
+              ++m_usefulDaylightCounts[k];
+            }
+          }
 
-          // read in the values
-          unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j){
-            for (unsigned i = 0; i < M; ++i){
-              illuminanceMap(i,j) = footcandlesToLux*lexical_cast<double>(lineVector[index]);
-              ++index;
+          if (keepIlluminance){
+            if (m_illuminance.empty()){
+              // estimate the number of timesteps from the length of the first line to avoid regrowing a large array
+              size_t numLines = static_cast<size_t>(openstudio::filesystem::file_size(path) / (line.size() + 1)) + 1;
+              m_illuminance.reserve(numLines*M*N);
             }
+            m_illuminance.insert(m_illuminance.end(), values.begin(), values.end());
           }
 
+          m_dateTimeIndex[dateTime] = m_dateTimes.size();
           m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
         }
       }
     }
@@ -168,17 +258,198 @@ namespace radiance{
     file.close();
   }
 
+  boost::optional<AnnualIlluminanceMap> AnnualIlluminanceMap::loadCache(const openstudio::path& cachePath, const openstudio::path& sourcePath)
+  {
+    if (!exists(cachePath) || !exists(sourcePath)){
+      return boost::none;
+    }
+
+    openstudio::filesystem::ifstream file(cachePath, std::ios_base::binary);
+    if (!file.is_open()){
+      return boost::none;
+    }
+
+    char magic[8];
+    if (!readValues(file, magic, 8) || std::memcmp(magic, cacheMagic, 8) != 0){
+      LOG(Warn, "'" << toString(cachePath) << "' is not an illuminance map cache.");
+      return boost::none;
+    }
+
+    // the cache is stale if the source file changed after it was read, a map read within the
+    // resolution of the source modification time cannot tell a later rewrite apart and is not used
+    openstudio::filesystem::FileStamp sourceStamp;
+    std::int64_t stampTakenAt = 0;
+    if (!readValue(file, sourceStamp.size) || !readValue(file, sourceStamp.lastWriteSeconds) ||
+        !readValue(file, sourceStamp.lastWriteNanoseconds) || !readValue(file, sourceStamp.fileId) ||
+        !readValue(file, stampTakenAt)){
+      return boost::none;
+    }
+    openstudio::filesystem::FileStamp currentStamp;
+    if (!openstudio::filesystem::file_stamp(sourcePath, currentStamp) || currentStamp != sourceStamp){
+      return boost::none;
+    }
+    if (!openstudio::filesystem::file_stamp_is_settled(sourceStamp, static_cast<time_t>(stampTakenAt))){
+      LOG(Debug, "'" << toString(sourcePath) << "' was read too soon after it was written for the cache '" << toString(cachePath) << "' to be trusted.");
+      return boost::none;
+    }
+
+    std::uint32_t M = 0;
+    std::uint32_t N = 0;
+    std::uint32_t T = 0;
+    std::uint8_t hasIlluminance = 0;
+    if (!readValue(file, M) || !readValue(file, N) || !readValue(file, T) || !readValue(file, hasIlluminance)){
+      return boost::none;
+    }
+
+    AnnualIlluminanceMap result;
+    result.m_path = sourcePath;
+    result.m_sourceStamp = sourceStamp;
+    result.m_sourceStampTakenAt = stampTakenAt;
+    result.m_xVector.resize(M);
+    result.m_yVector.resize(N);
+    if (!readValues(file, result.m_xVector.data().begin(), M) || !readValues(file, result.m_yVector.data().begin(), N)){
+      return boost::none;
+    }
+
+    if (!readValue(file, result.m_thresholds.daylightAutonomy) ||
+        !readValue(file, result.m_thresholds.usefulDaylightLower) ||
+        !readValue(file, result.m_thresholds.usefulDaylightUpper)){
+      return boost::none;
+    }
+
+    result.m_dateTimes.reserve(T);
+    for (std::uint32_t t = 0; t < T; ++t){
+      std::uint32_t month = 0;
+      std::uint32_t day = 0;
+      double fracDays = 0;
+      if (!readValue(file, month) || !readValue(file, day) || !readValue(file, fracDays)){
+        return boost::none;
+      }
+      DateTime dateTime(Date(monthOfYear(month), day), Time(fracDays));
+      result.m_dateTimeIndex[dateTime] = result.m_dateTimes.size();
+      result.m_dateTimes.push_back(dateTime);
+    }
+
+    result.m_daylightAutonomyCounts.resize(M*N);
+    result.m_usefulDaylightCounts.resize(M*N);
+    if (!readValues(file, result.m_daylightAutonomyCounts.data(), M*N) || !readValues(file, result.m_usefulDaylightCounts.data(), M*N)){
+      return boost::none;
+    }
+
+    if (hasIlluminance){
+      result.m_illuminance.resize(static_cast<size_t>(T)*M*N);
+      if (!readValues(file, result.m_illuminance.data(), result.m_illuminance.size())){
+        return boost::none;
+      }
+    }
+
+    return result;
+  }
+
+  bool AnnualIlluminanceMap::saveCache(const openstudio::path& cachePath) const
+  {
+    if (m_path.empty() || !m_sourceStamp){
+      LOG(Error, "Cannot cache an illuminance map that was not read from a file.");
+      return false;
+    }
+
+    openstudio::filesystem::ofstream file(cachePath, std::ios_base::binary | std::ios_base::trunc);
+    if (!file.is_open()){
+      LOG(Error, "Cannot open file '" << toString(cachePath) << "' for writing");
+      return false;
+    }
+
+    std::uint32_t M = m_xVector.size();
+    std::uint32_t N = m_yVector.size();
+    std::uint32_t T = m_dateTimes.size();
+
+    writeValues(file, cacheMagic, 8);
+    writeValue(file, m_sourceStamp->size);
+    writeValue(file, m_sourceStamp->lastWriteSeconds);
+    writeValue(file, m_sourceStamp->lastWriteNanoseconds);
+    writeValue(file, m_sourceStamp->fileId);
+    writeValue(file, m_sourceStampTakenAt);
+    writeValue(file, M);
+    writeValue(file, N);
+    writeValue(file, T);
+    writeValue(file, static_cast<std::uint8_t>(hasIlluminance() ? 1 : 0));
+    writeValues(file, m_xVector.data().begin(), M);
+    writeValues(file, m_yVector.data().begin(), N);
+    writeValue(file, m_thresholds.daylightAutonomy);
+    writeValue(file, m_thresholds.usefulDaylightLower);
+    writeValue(file, m_thresholds.usefulDaylightUpper);
+
+    for (const DateTime& dateTime : m_dateTimes){
+      writeValue(file, static_cast<std::uint32_t>(openstudio::month(dateTime.date().monthOfYear())));
+      writeValue(file, static_cast<std::uint32_t>(dateTime.date().dayOfMonth()));
+      writeValue(file, dateTime.time().totalDays());
+    }
+
+    writeValues(file, m_daylightAutonomyCounts.data(), m_daylightAutonomyCounts.size());
+    writeValues(file, m_usefulDaylightCounts.data(), m_usefulDaylightCounts.size());
+
+    if (hasIlluminance()){
+      writeValues(file, m_illuminance.data(), m_illuminance.size());
+    }
+
+    return file.good();
+  }
+
   /// get the illuminance map in lux corresponding to date and time
   openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const
   {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()){
-      return it->second;
+    auto it = m_dateTimeIndex.find(dateTime);
+    if (it != m_dateTimeIndex.end() && hasIlluminance()){
+      size_t M = m_xVector.size();
+      size_t N = m_yVector.size();
+      const float* values = m_illuminance.data() + it->second*M*N;
+
+      Matrix result(M,N);
+      for (size_t j = 0; j < N; ++j){
+        for (size_t i = 0; i < M; ++i){
+          result(i,j) = values[j*M + i];
+        }
+      }
+      return result;
     }
 
     return m_nullIlluminanceMap;
   }
 
+  bool AnnualIlluminanceMap::hasIlluminance() const
+  {
+    return !m_dateTimes.empty() && (m_illuminance.size() == m_dateTimes.size()*m_xVector.size()*m_yVector.size());
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::daylightAutonomy() const
+  {
+    return fractionOfTimesteps(m_daylightAutonomyCounts);
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::usefulDaylightIlluminance() const
+  {
+    return fractionOfTimesteps(m_usefulDaylightCounts);
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::fractionOfTimesteps(const std::vector<unsigned>& counts) const
+  {
+    size_t M = m_xVector.size();
+    size_t N = m_yVector.size();
+
+    Matrix result = boost::numeric::ublas::zero_matrix<double>(M,N);
+    if (m_dateTimes.empty() || counts.size() != M*N){
+      return result;
+    }
+
+    double numTimesteps = m_dateTimes.size();
+    for (size_t j = 0; j < N; ++j){
+      for (size_t i = 0; i < M; ++i){
+        result(i,j) = counts[j*M + i] / numTimesteps;
+      }
+    }
+    return result;
+  }
+
 
 } // radiance
 } // openstudio
@@ -37,21 +37,44 @@
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
+#include "../utilities/core/FilesystemHelpers.hpp"
+
+#include <boost/optional.hpp>
+
+#include <map>
+#include <vector>
 
 namespace openstudio{
 namespace radiance{
 
+  /** DaylightMetricThresholds holds the illuminance thresholds in lux used to accumulate daylight
+  *   autonomy and useful daylight illuminance while an AnnualIlluminanceMap is read.
+  */
+  struct RADIANCE_API DaylightMetricThresholds
+  {
+    /// defaults to 300 lux for daylight autonomy and 100 to 2000 lux for useful daylight illuminance
+    DaylightMetricThresholds();
+
+    DaylightMetricThresholds(double daylightAutonomy, double usefulDaylightLower, double usefulDaylightUpper);
+
+    double daylightAutonomy;
+    double usefulDaylightLower;
+    double usefulDaylightUpper;
+  };
+
   /** AnnualIlluminanceMap represents illuminance map for an entire year.
   *   We assume that the output files is from SPOT, with length in meters and illuminance
   *   values in footcandles.  All illuminance values are converted to lux.
+  *
+  *   Illuminance is stored in one contiguous timestep x point array of floats, with the point index
+  *   j*M + i for column i and row j. Each value is the footcandle value converted to lux in double
+  *   precision and then rounded to float, so it carries about 7 significant digits. The binary cache
+  *   stores the same floats, a cached map is identical to the map it was saved from. Daylight metrics
+  *   are accumulated from the float values while the file is streamed in, so the illuminance values
+  *   need not be kept when only the metrics are wanted.
   */
   class RADIANCE_API AnnualIlluminanceMap
   {
-    private:
-
-      // map of DateTime to Matrix (illuminance map)
-      typedef std::map<openstudio::DateTime, openstudio::Matrix> DateTimeIlluminanceMap;
-
     public:
 
       /// default constructor
@@ -60,9 +83,20 @@ namespace radiance{
       /// constructor with path
       AnnualIlluminanceMap(const openstudio::path& path);
 
+      /// constructor with path and daylight metric thresholds, if keepIlluminance is false only the metrics are kept
+      AnnualIlluminanceMap(const openstudio::path& path, const DaylightMetricThresholds& thresholds, bool keepIlluminance = true);
+
       /// virtual destructor
       virtual ~AnnualIlluminanceMap () {}
 
+      /// load a map previously written with saveCache, returns an empty optional if the cache
+      /// cannot be read, sourcePath has changed since the map was read, or the map was read less than
+      /// two seconds after sourcePath was last written
+      static boost::optional<AnnualIlluminanceMap> loadCache(const openstudio::path& cachePath, const openstudio::path& sourcePath);
+
+      /// write a binary cache of this map for fast reloads, the cache is tied to the file this map was read from
+      bool saveCache(const openstudio::path& cachePath) const;
+
       /// get the dates and times for which illuminance maps are available
       openstudio::DateTimeVector dateTimes() {return m_dateTimes;}
       //openstudio::DateTime::ConstVec dateTimes() const {return openstudio::DateTime::ConstVec(m_dateTimes.begin(), m_dateTimes.end());}
@@ -76,17 +110,41 @@ namespace radiance{
       /// get the illuminance map in lux corresponding to date and time
       openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
+      /// true if the illuminance values were kept when the map was read
+      bool hasIlluminance() const;
+
+      /// get all illuminance values in lux, timestep x point
+      const std::vector<float>& illuminance() const {return m_illuminance;}
+
+      /// get the thresholds used for the daylight metrics
+      DaylightMetricThresholds thresholds() const {return m_thresholds;}
+
+      /// get the fraction of timesteps at or above the daylight autonomy threshold at each point
+      openstudio::Matrix daylightAutonomy() const;
+
+      /// get the fraction of timesteps within the useful daylight illuminance range at each point
+      openstudio::Matrix usefulDaylightIlluminance() const;
+
     private:
 
       REGISTER_LOGGER("radiance.AnnualIlluminanceMap");
 
-      void init(const openstudio::path& path);
+      void init(const openstudio::path& path, bool keepIlluminance);
+
+      openstudio::Matrix fractionOfTimesteps(const std::vector<unsigned>& counts) const;
 
+      openstudio::path m_path;
+      boost::optional<openstudio::filesystem::FileStamp> m_sourceStamp; // m_path when it was read
+      std::int64_t m_sourceStampTakenAt;
       openstudio::DateTimeVector m_dateTimes;
       openstudio::Vector m_xVector;
       openstudio::Vector m_yVector;
       openstudio::Matrix m_nullIlluminanceMap; // used when there is no data
-      DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+      std::map<openstudio::DateTime, size_t> m_dateTimeIndex;
+      std::vector<float> m_illuminance;
+      DaylightMetricThresholds m_thresholds;
+      std::vector<unsigned> m_daylightAutonomyCounts;
+      std::vector<unsigned> m_usefulDaylightCounts;
   };
 
 } // radiance
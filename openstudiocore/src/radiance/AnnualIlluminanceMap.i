@@ -21,6 +21,8 @@
 %template(AnnualIlluminanceMapVector) std::vector< std::shared_ptr<openstudio::radiance::AnnualIlluminanceMap> >;
 
 %ignore openstudio::radiance::AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::Path&);
+%ignore openstudio::radiance::AnnualIlluminanceMap::loadCache;
+%ignore openstudio::radiance::AnnualIlluminanceMap::illuminance;
 
 %include <radiance/AnnualIlluminanceMap.hpp>
 
@@ -89,6 +89,7 @@
 #include <QDir>
 #include <QDateTime>
 #include <QThread>
+#include <QtConcurrent>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string/regex.hpp>
@@ -172,6 +173,119 @@ namespace radiance {
     return boost::lexical_cast<std::string>(t);
   }
 
+  namespace {
+
+    // surface geometry copied out of the model so that polygon clipping can run off the calling thread
+    struct SurfacePolygonJob
+    {
+      openstudio::Handle handle;
+      openstudio::Transformation transformation;
+      openstudio::Point3dVector vertices;
+      std::vector<openstudio::Point3dVector> subSurfaceVertices;
+    };
+
+    struct SurfacePolygon
+    {
+      openstudio::Handle handle;
+      openstudio::Point3dVector polygon;
+      // polygon vertices formatted as they are written to the space geometry file
+      std::string vertexText;
+      // vertices found off the surface plane, true for sub surface vertices, logged by the caller
+      std::vector<std::pair<bool, double> > outOfPlane;
+    };
+
+    SurfacePolygonJob surfacePolygonJob(const openstudio::model::Surface& surface, const openstudio::Transformation& buildingTransformation)
+    {
+      SurfacePolygonJob result;
+      result.handle = surface.handle();
+
+      openstudio::Transformation spaceTransformation;
+      openstudio::model::OptionalSpace space = surface.space();
+      if (space){
+        spaceTransformation = space->transformation();
+      }
+      result.transformation = buildingTransformation*spaceTransformation;
+
+      result.vertices = surface.vertices();
+      for (const openstudio::model::SubSurface& subSurface : surface.subSurfaces()){
+        result.subSurfaceVertices.push_back(subSurface.vertices());
+      }
+
+      return result;
+    }
+
+    // does not touch the model, safe to call from the thread pool
+    SurfacePolygon clipSurfacePolygon(const SurfacePolygonJob& job)
+    {
+      SurfacePolygon result;
+      result.handle = job.handle;
+
+      // transformation from space coordinates to face coordinates
+      openstudio::Transformation alignFace = openstudio::Transformation::alignFace(job.vertices);
+      openstudio::Transformation alignFaceInverse = alignFace.inverse();
+
+      // get the current vertices and convert to face coordinates
+      openstudio::Point3dVector surfaceFaceVertices = alignFaceInverse*job.vertices;
+
+      // subtract sub surface polygons from surface polygon
+      QPolygonF outer;
+      for (const openstudio::Point3d& point : surfaceFaceVertices){
+        if (std::abs(point.z()) > 0.001){
+          result.outOfPlane.push_back(std::make_pair(false, point.z()));
+        }
+        outer << QPointF(point.x(),point.y());
+      }
+
+      for (const openstudio::Point3dVector& subSurfaceVertices : job.subSurfaceVertices){
+        openstudio::Point3dVector subsurfaceFaceVertices = alignFaceInverse*subSurfaceVertices;
+        QPolygonF inner;
+        for (const openstudio::Point3d& point : subsurfaceFaceVertices){
+          if (std::abs(point.z()) > 0.001){
+            result.outOfPlane.push_back(std::make_pair(true, point.z()));
+          }
+          inner << QPointF(point.x(),point.y());
+        }
+        outer = outer.subtracted(inner);
+      }
+
+      openstudio::Point3dVector facePolygon;
+      for (const QPointF& point : outer){
+        facePolygon.push_back(openstudio::Point3d(point.x(),point.y(), 0));
+      }
+
+      result.polygon = job.transformation*alignFace*facePolygon;
+
+      return result;
+    }
+
+    // clip and format a space surface for the thread pool in ForwardTranslator::buildingSpaces
+    SurfacePolygon formatSurfacePolygon(const SurfacePolygonJob& job)
+    {
+      SurfacePolygon result = clipSurfacePolygon(job);
+
+      for (const auto & vertex : result.polygon)
+      {
+        result.vertexText += formatString(vertex.x()) + " "
+          + formatString(vertex.y()) + " "
+          + formatString(vertex.z()) + "\n";
+      }
+
+      return result;
+    }
+
+    void logOutOfPlane(const SurfacePolygon& surfacePolygon)
+    {
+      for (const auto & z : surfacePolygon.outOfPlane){
+        if (z.first){
+          LOG_FREE(Warn, "openstudio.radiance.ForwardTranslator", "Subsurface point z not on plane, z =" << z.second);
+        }else{
+          LOG_FREE(Warn, "openstudio.radiance.ForwardTranslator", "Surface point z not on plane, z =" << z.second);
+        }
+      }
+    }
+
+  }
+
   // basic constructor
   ForwardTranslator::ForwardTranslator()
     : m_windowGroupId(1) // m_windowGroupId is reserved for uncontrolled
@@ -498,53 +612,16 @@ namespace radiance {
 
   openstudio::Point3dVector ForwardTranslator::getPolygon(const openstudio::model::Surface& surface)
   {
-    openstudio::Point3dVector result;
-
     Transformation buildingTransformation;
     OptionalBuilding building = surface.model().getOptionalUniqueModelObject<Building>();
     if (building){
       buildingTransformation = building->transformation();
     }
 
-    Transformation spaceTransformation;
-    OptionalSpace space = surface.space();
-    if (space){
-      spaceTransformation = space->transformation();
-    }
-
-    // transformation from space coordinates to face coordinates
-    Transformation alignFace = Transformation::alignFace(surface.vertices());
-
-    // get the current vertices and convert to face coordinates
-    Point3dVector surfaceFaceVertices = alignFace.inverse()*surface.vertices();
-
-    // subtract sub surface polygons from surface polygon
-    QPolygonF outer;
-    for (const Point3d& point : surfaceFaceVertices){
-      if (std::abs(point.z()) > 0.001){
-        LOG(Warn, "Surface point z not on plane, z =" << point.z());
-      }
-      outer << QPointF(point.x(),point.y());
-    }
-
-    for (const SubSurface& subSurface : surface.subSurfaces()){
-      Point3dVector subsurfaceFaceVertices = alignFace.inverse()*subSurface.vertices();
-      QPolygonF inner;
-      for (const Point3d& point : subsurfaceFaceVertices){
-        if (std::abs(point.z()) > 0.001){
-          LOG(Warn, "Subsurface point z not on plane, z =" << point.z());
-        }
-        inner << QPointF(point.x(),point.y());
-      }
-      outer = outer.subtracted(inner);
-
-    }
-
-    for (const QPointF& point : outer){
-      result.push_back(openstudio::Point3d(point.x(),point.y(), 0));
-    }
+    SurfacePolygon result = clipSurfacePolygon(surfacePolygonJob(surface, buildingTransformation));
+    logOutOfPlane(result);
 
-    return buildingTransformation*spaceTransformation*alignFace*result;
+    return result.polygon;
   }
 
   openstudio::Point3dVector ForwardTranslator::getPolygon(const openstudio::model::SubSurface& subSurface)
@@ -1078,6 +1155,38 @@ namespace radiance {
   {
     std::vector<std::string> space_names;
 
+    // clipping sub surfaces out of their base surfaces is the most expensive part of the export,
+    // gather the geometry here and clip every space surface on the thread pool before writing anything
+    Transformation buildingTransformation;
+    OptionalBuilding building = m_model.getOptionalUniqueModelObject<Building>();
+    if (building){
+      buildingTransformation = building->transformation();
+    }
+
+    std::vector<SurfacePolygonJob> surfacePolygonJobs;
+    for (const auto & space : t_spaces)
+    {
+      for (const auto & surface : space.surfaces())
+      {
+        if (!surface.isAirWall()){
+          surfacePolygonJobs.push_back(surfacePolygonJob(surface, buildingTransformation));
+        }
+      }
+    }
+
+    std::vector<SurfacePolygon> surfacePolygons;
+    if (surfacePolygonJobs.size() < 2){
+      for (const auto & job : surfacePolygonJobs){
+        surfacePolygons.push_back(formatSurfacePolygon(job));
+      }
+    }else{
+      surfacePolygons = QtConcurrent::blockingMapped<std::vector<SurfacePolygon> >(surfacePolygonJobs, &formatSurfacePolygon);
+    }
+
+    std::map<openstudio::Handle, size_t> surfacePolygonIndex;
+    for (size_t i = 0; i < surfacePolygons.size(); ++i){
+      surfacePolygonIndex[surfacePolygons[i].handle] = i;
+    }
 
     for (const auto & space : t_spaces)
     {
@@ -1087,7 +1196,8 @@ namespace radiance {
       LOG(Debug, "Processing space: " << space_name);
 
       // split model into zone-based Radiance .rad files
-      m_radSpaces[space_name] = "#\n# geometry file for space: " + space_name + "\n#\n\n";
+      std::string& spaceGeometry = m_radSpaces[space_name];
+      spaceGeometry = "#\n# geometry file for space: " + space_name + "\n#\n\n";
 
       // loop over surfaces in space
 
@@ -1104,11 +1214,11 @@ namespace radiance {
         std::string surface_name = cleanName(surface.name().get());
 
         // add surface to space geometry
-        m_radSpaces[space_name] += "# surface: " + surface_name + "\n";
+        spaceGeometry += "# surface: " + surface_name + "\n";
 
         // set construction of surface
         std::string constructionName = surface.getString(2).get();
-        m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+        spaceGeometry += "# construction: " + constructionName + "\n";
 
         // get reflectances
         double interiorVisibleReflectance = 0.5; // default for space surfaces
@@ -1123,14 +1233,16 @@ namespace radiance {
         }
 
         // create polygon object
-        openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(surface);
+        const SurfacePolygon& surfacePolygon = surfacePolygons[surfacePolygonIndex.at(surface.handle())];
+        logOutOfPlane(surfacePolygon);
+        openstudio::Point3dVector polygon = surfacePolygon.polygon;
 
 
         if (!surface.adjacentSurface()){
           // 2-sided material
 
           // header
-          m_radSpaces[space_name] += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3) + \
+          spaceGeometry += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3) + \
           "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
 
           // material definition
@@ -1152,14 +1264,14 @@ namespace radiance {
               "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
           // polygon reference
-          m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
+          spaceGeometry += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
               "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + " polygon " + \
               surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
         }else{
           // interior-only material
 
           // header
-          m_radSpaces[space_name] += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+          spaceGeometry += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
           // material definition
           m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3)
@@ -1168,20 +1280,15 @@ namespace radiance {
             + " " + formatString(interiorVisibleReflectance, 3) + " 0 0\n");
 
           // polygon reference
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3)
+          spaceGeometry += "refl_" + formatString(interiorVisibleReflectance, 3)
           + " polygon " + surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
         };
 
 
         // add polygon vertices
-        for (const auto & vertex : polygon)
-        {
-          m_radSpaces[space_name] += formatString(vertex.x()) + " "
-            + formatString(vertex.y()) + " "
-            + formatString(vertex.z()) + "\n";
-        }
-        m_radSpaces[space_name] += "\n";
+        spaceGeometry += surfacePolygon.vertexText;
+        spaceGeometry += "\n";
 
         // end(surface)
 
@@ -1429,20 +1536,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                         formatString(exteriorVisibleReflectance, 3) + " " + \
                                         formatString(exteriorVisibleReflectance, 3) + " " + \
                                         formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(exteriorVisibleReflectance, 3) + " polygon outside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  spaceGeometry += "refl_" + formatString(exteriorVisibleReflectance, 3) + " polygon outside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
+                  spaceGeometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                  spaceGeometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
 
                 // make interior sill/reveal surfaces
@@ -1459,20 +1566,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  spaceGeometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_reveal_" + subSurface_name + formatString(i, 0) + "\n";
+                  spaceGeometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                  spaceGeometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
 
                 if (insideSillDepth && (*insideSillDepth > 0.0)){
@@ -1488,20 +1595,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  spaceGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " " + \
                                         formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_sill_" + subSurface_name + formatString(i, 0) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  spaceGeometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_sill_" + subSurface_name + formatString(i, 0) + "\n";
+                  spaceGeometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                  spaceGeometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  spaceGeometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
               }
             }
@@ -1763,20 +1870,20 @@ namespace radiance {
             double interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
             double exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
             //polygon header
-            m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-            m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+            spaceGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+            spaceGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
             // write material
             m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
               formatString(interiorVisibleReflectance, 3) + " " + \
               formatString(interiorVisibleReflectance, 3) + " " + \
               formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
             // write polygon
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
-            m_radSpaces[space_name] += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
+            spaceGeometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
+            spaceGeometry += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
 
             for (const auto & vertex : polygon)
             {
-              m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+              spaceGeometry += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
             }
 
           } else if (subSurfaceUpCase == "TUBULARDAYLIGHTDOME") {
@@ -1804,11 +1911,11 @@ namespace radiance {
           std::string shadingSurface_name = cleanName(shadingSurface.name().get());
 
           // add surface to zone geometry
-          m_radSpaces[space_name] += "# surface: " + shadingSurface_name + "\n";
+          spaceGeometry += "# surface: " + shadingSurface_name + "\n";
 
           // set construction of space shadingSurface
           std::string constructionName = shadingSurface.getString(2).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+          spaceGeometry += "# construction: " + constructionName + "\n";
 
           // get reflectance
           double interiorVisibleReflectance = 0.25; // default for space shading surfaces
@@ -1840,21 +1947,21 @@ namespace radiance {
               "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
           // polygon header
-          m_radSpaces[space_name] += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+          spaceGeometry += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
+          spaceGeometry += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
           // get / write surface polygon
 
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
-          m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
+          spaceGeometry += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
               "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + " polygon " + \
           shadingSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
           for (const auto & vertex : polygon)
           {
-            m_radSpaces[space_name] += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+            spaceGeometry += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
           }
-          m_radSpaces[space_name] += "\n";
+          spaceGeometry += "\n";
 
         }
       } // end shading surfaces
@@ -1883,11 +1990,11 @@ namespace radiance {
 
           // add surface to zone geometry
 
-          m_radSpaces[space_name] += "# surface: " + interiorPartitionSurface_name + "\n";
+          spaceGeometry += "# surface: " + interiorPartitionSurface_name + "\n";
 
           // set construction of interiorPartitionSurface
           std::string constructionName = interiorPartitionSurface.getString(1).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+          spaceGeometry += "# construction: " + constructionName + "\n";
 
          // get reflectance
           double interiorVisibleReflectance = 0.5; // set some default
@@ -1908,16 +2015,16 @@ namespace radiance {
             formatString(interiorVisibleReflectance, 3) + " " + \
             formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
           // polygon header
-          m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+          spaceGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+          spaceGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
           // get / write surface polygon
 
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(interiorPartitionSurface);
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
+          spaceGeometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
           interiorPartitionSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
           for (const auto & vertex : polygon)
           {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+            spaceGeometry += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
           }
         }
       } // end interior partitions
@@ -2111,11 +2218,15 @@ namespace radiance {
       if (file.is_open()){
         t_outfiles.push_back(filename);
         m_radSceneFiles.push_back(filename);
-        file << m_radSpaces[space_name];
+        file << spaceGeometry;
       } else{
         LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
       }
+    }
 
+    // window groups and materials accumulate across spaces, write them once all spaces are done
+    if (!t_spaces.empty())
+    {
       for (const auto & windowGroup : m_windowGroups)
       {
         std::string windowGroup_name = windowGroup.name();
@@ -31,6 +31,13 @@
 
 #include "../AnnualIlluminanceMap.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/FilesystemHelpers.hpp"
+
+#include <ctime>
+#include <fstream>
+#include <limits>
+
 #include <resources.hxx>
 
 
@@ -80,3 +87,130 @@ TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap)
 
 }
 
+namespace {
+
+  // 3 x 2 point map with three timesteps, illuminance in footcandles
+  openstudio::path writeIlluminanceMap(const std::string& name, bool extraTimestep)
+  {
+    openstudio::path path = toPath(name);
+    std::ofstream file(openstudio::toString(path).c_str());
+    file << "0 0 0 2 0 0 0 1 0\n";
+    file << "1 1 0\n";
+    file << "1 1 8.5 0 10 100 5 10 20 30 40 50\n";
+    file << "1 1 12 0 45 800 100 150 200 250 300 350\n";
+    file << "6 21 16.25 0 30 400\t0 1 2 3 4 5\r\n";
+    if (extraTimestep){
+      file << "6 21 17 0 20 300 0 0 0 0 0 0\n";
+    }
+    return path;
+  }
+
+}
+
+TEST(Radiance, AnnualIlluminanceMap_Stream)
+{
+  openstudio::path path = writeIlluminanceMap("AnnualIlluminanceMap_Stream.ill", false);
+
+  AnnualIlluminanceMap map(path, DaylightMetricThresholds(300.0, 100.0, 2000.0));
+  ASSERT_EQ(3u, map.xVector().size());
+  ASSERT_EQ(2u, map.yVector().size());
+  ASSERT_EQ(3u, map.dateTimes().size());
+  ASSERT_TRUE(map.hasIlluminance());
+  EXPECT_EQ(18u, map.illuminance().size());
+
+  openstudio::DateTime noon(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0.5));
+  EXPECT_EQ(noon, map.dateTimes()[1]);
+  openstudio::Matrix illuminance = map.illuminanceMap(noon);
+  ASSERT_EQ(3u, illuminance.size1());
+  ASSERT_EQ(2u, illuminance.size2());
+  EXPECT_NEAR(10.76*100, illuminance(0,0), 1.0e-3);
+  EXPECT_NEAR(10.76*200, illuminance(2,0), 1.0e-3);
+  EXPECT_NEAR(10.76*250, illuminance(0,1), 1.0e-3);
+  EXPECT_NEAR(10.76*350, illuminance(2,1), 1.0e-3);
+
+  // daylight autonomy, 300 lux is about 27.9 fc
+  openstudio::Matrix da = map.daylightAutonomy();
+  EXPECT_DOUBLE_EQ(1.0/3.0, da(0,0));
+  EXPECT_DOUBLE_EQ(2.0/3.0, da(0,1));
+
+  // useful daylight, 100 to 2000 lux is about 9.3 to 185.9 fc
+  openstudio::Matrix udi = map.usefulDaylightIlluminance();
+  EXPECT_DOUBLE_EQ(1.0/3.0, udi(0,0));
+  EXPECT_DOUBLE_EQ(2.0/3.0, udi(1,0));
+  EXPECT_DOUBLE_EQ(1.0/3.0, udi(2,1));
+
+  // metrics only
+  AnnualIlluminanceMap metrics(path, DaylightMetricThresholds(300.0, 100.0, 2000.0), false);
+  EXPECT_FALSE(metrics.hasIlluminance());
+  EXPECT_EQ(0u, metrics.illuminanceMap(noon).size1());
+  EXPECT_EQ(3u, metrics.dateTimes().size());
+  openstudio::Matrix metricsDa = metrics.daylightAutonomy();
+  for (unsigned i = 0; i < 3; ++i){
+    for (unsigned j = 0; j < 2; ++j){
+      EXPECT_EQ(da(i,j), metricsDa(i,j));
+    }
+  }
+}
+
+TEST(Radiance, AnnualIlluminanceMap_Cache)
+{
+  openstudio::path path = writeIlluminanceMap("AnnualIlluminanceMap_Cache.ill", false);
+  openstudio::path cachePath = toPath("AnnualIlluminanceMap_Cache.bin");
+  openstudio::filesystem::remove(cachePath);
+
+  // a map read right after its source was written cannot be cached reliably
+  {
+    AnnualIlluminanceMap map(path);
+    ASSERT_TRUE(map.saveCache(cachePath));
+    EXPECT_FALSE(AnnualIlluminanceMap::loadCache(cachePath, path));
+    openstudio::filesystem::remove(cachePath);
+  }
+
+  // move the source out of the modification time resolution
+  openstudio::filesystem::last_write_time(path, std::time(nullptr) - 10);
+
+  AnnualIlluminanceMap map(path);
+  EXPECT_FALSE(AnnualIlluminanceMap::loadCache(cachePath, path));
+  ASSERT_TRUE(map.saveCache(cachePath));
+
+  boost::optional<AnnualIlluminanceMap> cached = AnnualIlluminanceMap::loadCache(cachePath, path);
+  ASSERT_TRUE(cached);
+  EXPECT_EQ(map.dateTimes(), cached->dateTimes());
+  EXPECT_EQ(map.illuminance(), cached->illuminance());
+  EXPECT_EQ(map.xVector().size(), cached->xVector().size());
+  EXPECT_EQ(map.yVector().size(), cached->yVector().size());
+  for (const openstudio::DateTime& dateTime : map.dateTimes()){
+    openstudio::Matrix expected = map.illuminanceMap(dateTime);
+    openstudio::Matrix actual = cached->illuminanceMap(dateTime);
+    ASSERT_EQ(expected.size1(), actual.size1());
+    ASSERT_EQ(expected.size2(), actual.size2());
+    for (unsigned i = 0; i < expected.size1(); ++i){
+      for (unsigned j = 0; j < expected.size2(); ++j){
+        EXPECT_EQ(expected(i,j), actual(i,j));
+      }
+    }
+  }
+
+  // values are kept as floats, within float rounding of the footcandle values in lux
+  openstudio::DateTime noon(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0.5));
+  openstudio::Matrix illuminance = cached->illuminanceMap(noon);
+  ASSERT_EQ(3u, illuminance.size1());
+  EXPECT_EQ(static_cast<float>(10.76*150), cached->illuminance()[6 + 1]);
+  EXPECT_EQ(static_cast<double>(static_cast<float>(10.76*150)), illuminance(1,0));
+  EXPECT_NEAR(10.76*150, illuminance(1,0), 10.76*150*std::numeric_limits<float>::epsilon());
+
+  // the cache is stale once the source is rewritten, even with the same size
+  std::string contents = openstudio::filesystem::read_as_string(path);
+  std::string::size_type pos = contents.find(" 150 ");
+  ASSERT_NE(std::string::npos, pos);
+  contents.replace(pos, 5, " 151 ");
+  {
+    std::ofstream file(openstudio::toString(path).c_str(), std::ios_base::trunc);
+    file << contents;
+  }
+  EXPECT_EQ(contents.size(), openstudio::filesystem::file_size(path));
+  EXPECT_FALSE(AnnualIlluminanceMap::loadCache(cachePath, path));
+
+  writeIlluminanceMap("AnnualIlluminanceMap_Cache.ill", true);
+  EXPECT_FALSE(AnnualIlluminanceMap::loadCache(cachePath, path));
+}
@@ -52,9 +52,12 @@
 
 #include "../../utilities/geometry/Point3d.hpp"
 #include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/FilesystemHelpers.hpp"
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/FenestrationSurface_Detailed_FieldEnums.hxx>
 
+#include <QThreadPool>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::radiance;
@@ -202,6 +205,97 @@ TEST(Radiance, ForwardTranslator_ExampleModel)
 }
 
 
+TEST(Radiance, ForwardTranslator_ExampleModel_SpaceGeometry)
+{
+  Model model = exampleModel();
+
+  openstudio::path outpath = toPath("./ForwardTranslator_ExampleModel_SpaceGeometry");
+  openstudio::filesystem::remove_all(outpath);
+  ASSERT_FALSE(openstudio::filesystem::exists(outpath));
+
+  ForwardTranslator ft;
+  std::vector<path> outpaths = ft.translateModel(outpath, model);
+  ASSERT_FALSE(outpaths.empty());
+
+  // shared scene and material files are written once, after all spaces
+  EXPECT_EQ(1, std::count(outpaths.begin(), outpaths.end(), outpath / toPath("model.rad"))) << printPaths(outpaths);
+  EXPECT_EQ(1, std::count(outpaths.begin(), outpaths.end(), outpath / toPath("materials/materials.rad"))) << printPaths(outpaths);
+
+  // surfaces clipped on the thread pool match the serial polygons
+  for (const Space& space : model.getConcreteModelObjects<Space>()){
+    openstudio::path spacePath = outpath / toPath("scene") / toPath(cleanName(space.name().get()) + ".rad");
+    ASSERT_TRUE(openstudio::filesystem::exists(spacePath));
+    std::string spaceGeometry = openstudio::filesystem::read_as_string(spacePath);
+
+    for (const Surface& surface : space.surfaces()){
+      if (surface.isAirWall()){
+        continue;
+      }
+
+      std::string vertices;
+      for (const Point3d& vertex : ForwardTranslator::getPolygon(surface)){
+        vertices += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+      }
+      EXPECT_NE(std::string::npos, spaceGeometry.find(" polygon " + cleanName(surface.name().get()) + "\n")) << surface.nameString();
+      EXPECT_NE(std::string::npos, spaceGeometry.find(vertices)) << surface.nameString();
+    }
+  }
+}
+
+
+TEST(Radiance, ForwardTranslator_ExampleModel_SerialParallel)
+{
+  Model model = exampleModel();
+
+  // translate once with a single pool thread and once with the default pool
+  QThreadPool* threadPool = QThreadPool::globalInstance();
+  int maxThreadCount = threadPool->maxThreadCount();
+
+  openstudio::path serialPath = toPath("./ForwardTranslator_ExampleModel_Serial");
+  openstudio::filesystem::remove_all(serialPath);
+  threadPool->setMaxThreadCount(1);
+  ForwardTranslator serialTranslator;
+  std::vector<path> serialPaths = serialTranslator.translateModel(serialPath, model);
+  threadPool->setMaxThreadCount(maxThreadCount);
+
+  openstudio::path parallelPath = toPath("./ForwardTranslator_ExampleModel_Parallel");
+  openstudio::filesystem::remove_all(parallelPath);
+  ForwardTranslator parallelTranslator;
+  std::vector<path> parallelPaths = parallelTranslator.translateModel(parallelPath, model);
+
+  // the same files are returned in the same order
+  ASSERT_FALSE(serialPaths.empty());
+  ASSERT_EQ(serialPaths.size(), parallelPaths.size()) << printPaths(serialPaths) << printPaths(parallelPaths);
+  std::string serialRoot = toString(serialPath);
+  std::string parallelRoot = toString(parallelPath);
+  for (size_t i = 0; i < serialPaths.size(); ++i){
+    EXPECT_EQ(toString(serialPaths[i]).substr(serialRoot.size()), toString(parallelPaths[i]).substr(parallelRoot.size()));
+  }
+
+  // and every file written is byte for byte identical
+  unsigned numFiles = 0;
+  for (openstudio::filesystem::recursive_directory_iterator it(serialPath), end; it != end; ++it){
+    if (!openstudio::filesystem::is_regular_file(it->path())){
+      continue;
+    }
+    ++numFiles;
+    std::string relativePath = toString(it->path()).substr(serialRoot.size());
+    openstudio::path parallelFile = toPath(parallelRoot + relativePath);
+    ASSERT_TRUE(openstudio::filesystem::exists(parallelFile)) << relativePath;
+    EXPECT_EQ(openstudio::filesystem::read_as_string(it->path()), openstudio::filesystem::read_as_string(parallelFile)) << relativePath;
+  }
+  EXPECT_LT(0u, numFiles);
+
+  unsigned numParallelFiles = 0;
+  for (openstudio::filesystem::recursive_directory_iterator it(parallelPath), end; it != end; ++it){
+    if (openstudio::filesystem::is_regular_file(it->path())){
+      ++numParallelFiles;
+    }
+  }
+  EXPECT_EQ(numFiles, numParallelFiles);
+}
+
+
 TEST(Radiance, ForwardTranslator_ExampleModelWithShadingControl)
 {
   Model model = exampleModel();
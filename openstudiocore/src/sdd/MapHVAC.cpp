@@ -5176,28 +5176,19 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const Q
 
       QDomElement zoneServedElement = trmlUnitElement.firstChildElement("ZnServedRef");
 
-      QDomNodeList thrmlZnElements = trmlUnitElement.parentNode().parentNode().parentNode().toElement().elementsByTagName("ThrmlZn");
+      QDomElement thrmlZnElement = findElementByName("ThrmlZn",zoneServedElement.text());
 
-      for( int j = 0; j < thrmlZnElements.count(); j++ )
+      if( ! thrmlZnElement.isNull() )
       {
-        QDomElement thrmlZnElement = thrmlZnElements.at(j).toElement();
+        QDomElement htgDsgnMaxFlowFracElement = thrmlZnElement.firstChildElement("HtgDsgnMaxFlowFrac");
 
-        QDomElement thrmlZnNameElement = thrmlZnElement.firstChildElement("Name");
+        value = htgDsgnMaxFlowFracElement.text().toDouble(&ok);
 
-        if(istringEqual(thrmlZnNameElement.text().toStdString(),zoneServedElement.text().toStdString()))
+        if( ok )
         {
-          QDomElement htgDsgnMaxFlowFracElement = thrmlZnElement.firstChildElement("HtgDsgnMaxFlowFrac");
-
-          value = htgDsgnMaxFlowFracElement.text().toDouble(&ok);
-
-          if( ok )
-          {
-            terminal.setMaximumFlowFractionDuringReheat(value);
-
-            found = true;
-          }
+          terminal.setMaximumFlowFractionDuringReheat(value);
 
-          break;
+          found = true;
         }
       }
 
@@ -9293,41 +9284,15 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCrvM
 
 QDomElement ReverseTranslator::findZnSysElement(const QString & znSysName,const QDomDocument & doc)
 {
-  QDomNodeList znSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("ZnSys");
-
-  for (int i = 0; i < znSysElements.count(); i++)
-  {
-    QDomElement znSysElement = znSysElements.at(i).toElement();
-
-    QDomElement znSysNameElement = znSysElement.firstChildElement("Name");
-
-    if( znSysNameElement.text() == znSysName )
-    {
-      return znSysElement;
-    }
-  }
-
-  return QDomElement();
+  return findElementByName("ZnSys",znSysName,Qt::CaseSensitive);
 }
 
 QDomElement ReverseTranslator::findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc)
 {
-  QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
-
-  for( int i = 0; i < airSystemElements.count(); i++ )
+  auto it = m_zoneNameToTrmlUnitElementMap.find(zoneName.toLower());
+  if( it != m_zoneNameToTrmlUnitElementMap.end() )
   {
-    QDomElement airSystemElement = airSystemElements.at(i).toElement();
-    QDomNodeList terminalElements = airSystemElement.elementsByTagName("TrmlUnit");
-    for( int j = 0; j < terminalElements.count(); j++ )
-    {
-      QDomElement terminalElement = terminalElements.at(j).toElement();
-      QDomElement zoneServedElement = terminalElement.firstChildElement("ZnServedRef");
-
-      if(zoneName.compare(zoneServedElement.text(),Qt::CaseInsensitive) == 0)
-      {
-        return terminalElement;
-      }
-    }
+    return it->second;
   }
 
   return QDomElement();
@@ -9335,20 +9300,7 @@ QDomElement ReverseTranslator::findTrmlUnitElementForZone(const QString & zoneNa
 
 QDomElement ReverseTranslator::findAirSysElement(const QString & airSysName,const QDomDocument & doc)
 {
-  QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
-
-  for( int i = 0; i < airSystemElements.count(); i++ )
-  {
-    QDomElement airSystemElement = airSystemElements.at(i).toElement();
-    QDomElement airSystemNameElement = airSystemElement.firstChildElement("Name");
-
-    if(airSysName.compare(airSystemNameElement.text(),Qt::CaseInsensitive) == 0)
-    {
-      return airSystemElement;
-    }
-  }
-
-  return QDomElement();
+  return findElementByName("AirSys",airSysName);
 }
 
 boost::optional<QDomElement> ForwardTranslator::translateAirLoopHVAC(const model::AirLoopHVAC& airLoop, QDomDocument& doc)
@@ -228,7 +228,71 @@ namespace sdd {
 
   boost::optional<model::Model> ReverseTranslator::convert(const QDomDocument& doc)
   {
-    return translateSDD(doc.documentElement(), doc);
+    indexDocument(doc);
+
+    boost::optional<model::Model> result = translateSDD(doc.documentElement(), doc);
+
+    clearDocumentIndex();
+
+    return result;
+  }
+
+  void ReverseTranslator::indexDocument(const QDomDocument& doc)
+  {
+    clearDocumentIndex();
+
+    // visit every element once in document order, without recursion
+    QDomElement element = doc.documentElement();
+    while (!element.isNull()){
+
+      QString tagName = element.tagName();
+
+      QDomElement nameElement = element.firstChildElement("Name");
+      if (!nameElement.isNull()){
+        m_nameToElementsMap[std::make_pair(tagName, nameElement.text().toLower())].push_back(element);
+      }
+
+      if (tagName == "TrmlUnit"){
+        QDomNode parent = element.parentNode();
+        while (!parent.isNull() && (parent.toElement().tagName() != "AirSys")){
+          parent = parent.parentNode();
+        }
+        if (!parent.isNull()){
+          QString zoneName = element.firstChildElement("ZnServedRef").text().toLower();
+          // keep the first terminal found for each zone
+          m_zoneNameToTrmlUnitElementMap.insert(std::make_pair(zoneName, element));
+        }
+      }
+
+      // next is the first child, else the next sibling of this element or of its nearest ancestor
+      QDomElement next = element.firstChildElement();
+      QDomNode node = element;
+      while (next.isNull() && !node.isNull()){
+        next = node.nextSiblingElement();
+        node = node.parentNode();
+      }
+      element = next;
+    }
+  }
+
+  void ReverseTranslator::clearDocumentIndex()
+  {
+    m_nameToElementsMap.clear();
+    m_zoneNameToTrmlUnitElementMap.clear();
+  }
+
+  QDomElement ReverseTranslator::findElementByName(const QString& tagName, const QString& name, Qt::CaseSensitivity cs) const
+  {
+    auto it = m_nameToElementsMap.find(std::make_pair(tagName, name.toLower()));
+    if (it != m_nameToElementsMap.end()){
+      for (const auto& element : it->second){
+        if (name.compare(element.firstChildElement("Name").text(), cs) == 0){
+          return element;
+        }
+      }
+    }
+
+    return QDomElement();
   }
 
   boost::optional<model::Model> ReverseTranslator::translateSDD(const QDomElement& element, const QDomDocument& doc)
@@ -2056,21 +2120,13 @@ namespace sdd {
 
 QDomElement ReverseTranslator::supplySegment(const QString & fluidSegmentName, const QDomDocument& doc)
 {
-  QDomNodeList fluidSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("FluidSys");
-
-  for (int i = 0; i < fluidSysElements.count(); i++) {
-    QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
-    QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
-
-    for (int i = 0; i < fluidSegmentElements.count(); i++) {
-      QDomElement fluidSegmentElement = fluidSegmentElements.at(i).toElement();
-
-      QDomElement nameElement = fluidSegmentElement.firstChildElement("Name");
+  auto it = m_nameToElementsMap.find(std::make_pair(QString("FluidSeg"), fluidSegmentName.toLower()));
+  if( it != m_nameToElementsMap.end() ) {
+    for( const auto & fluidSegmentElement : it->second ) {
       QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
 
-      if( (typeElement.text().toLower() == "secondarysupply" ||
-           typeElement.text().toLower() == "primarysupply" ) &&
-           nameElement.text().toLower() == fluidSegmentName.toLower() ) {
+      if( typeElement.text().toLower() == "secondarysupply" ||
+          typeElement.text().toLower() == "primarysupply" ) {
         return fluidSegmentElement;
       }
     }
@@ -2092,43 +2148,39 @@ boost::optional<model::PlantLoop> ReverseTranslator::serviceHotWaterLoopForSuppl
 {
   boost::optional<model::PlantLoop> result;
 
-  QDomNodeList fluidSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("FluidSys");
+  auto it = m_nameToElementsMap.find(std::make_pair(QString("FluidSeg"), fluidSegmentName.toLower()));
+  if( it == m_nameToElementsMap.end() )
+  {
+    return result;
+  }
 
-  for (int i = 0; i < fluidSysElements.count(); i++)
+  for( const auto & fluidSegmentElement : it->second )
   {
-    QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
+    QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
+
+    if( typeElement.text().toLower() != "secondarysupply" &&
+        typeElement.text().toLower() != "primarysupply" )
+    {
+      continue;
+    }
+
+    QDomElement fluidSysElement = fluidSegmentElement.parentNode().toElement();
 
     QDomElement fluidSysNameElement = fluidSysElement.firstChildElement("Name");
 
     QDomElement fluidSysTypeElement = fluidSysElement.firstChildElement("Type");
 
-    if( fluidSysTypeElement.text().toLower() == "servicehotwater" )
+    if( fluidSysElement.tagName() == "FluidSys" && fluidSysTypeElement.text().toLower() == "servicehotwater" )
     {
-      QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
-
-      for (int i = 0; i < fluidSegmentElements.count(); i++)
+      if( boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().toStdString()) )
       {
-        QDomElement fluidSegmentElement = fluidSegmentElements.at(i).toElement();
-
-        QDomElement nameElement = fluidSegmentElement.firstChildElement("Name");
-        QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
-
-        if( (typeElement.text().toLower() == "secondarysupply" ||
-             typeElement.text().toLower() == "primarysupply" ) &&
-            nameElement.text().toLower() == fluidSegmentName.toLower()
-          )
+        return loop;
+      }
+      else
+      {
+        if( boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement,doc,model) )
         {
-          if( boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().toStdString()) )
-          {
-            return loop;
-          }
-          else
-          {
-            if( boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement,doc,model) )
-            {
-              return mo->optionalCast<model::PlantLoop>();
-            }
-          }
+          return mo->optionalCast<model::PlantLoop>();
         }
       }
     }
@@ -43,8 +43,10 @@
 #include "../model/ConstructionBase.hpp"
 #include "../model/AirConditionerVariableRefrigerantFlow.hpp"
 
+#include <QDomElement>
+#include <QString>
+
 class QDomDocument;
-class QDomElement;
 class QDomNodeList;
 
 namespace openstudio {
@@ -138,6 +140,16 @@ namespace sdd {
     boost::optional<openstudio::model::ModelObject> translateVRFSys(const QDomElement& vrfSysElement, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateZnSys(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
 
+    // Builds the element indexes below for doc, called once per document before translation.
+    // The Map* translators use these in place of document wide searches so that resolving
+    // references between SDD objects does not grow with the size of the document.
+    void indexDocument(const QDomDocument& doc);
+
+    void clearDocumentIndex();
+
+    // Return the first element in document order with tag name tagName and a "Name" child equal to name
+    QDomElement findElementByName(const QString& tagName, const QString& name, Qt::CaseSensitivity cs = Qt::CaseInsensitive) const;
+
     // Looks for a loop in the SDD instance with a segment named fluidSegmentName
     // If found then looks for a model::Loop with that name and returns it
     // This is useful for hooking water coils up to their plant and maybe other things.
@@ -211,6 +223,12 @@ namespace sdd {
     // Map from vrf system to master control zone name
     std::map<std::string,model::AirConditionerVariableRefrigerantFlow> m_vrfSystemControlZones;
 
+    // Elements with a "Name" child keyed by tag name and lower case name, in document order
+    std::map<std::pair<QString, QString>, std::vector<QDomElement> > m_nameToElementsMap;
+
+    // First "TrmlUnit" element of an air system serving each zone, keyed by lower case zone name
+    std::map<QString, QDomElement> m_zoneNameToTrmlUnitElementMap;
+
     REGISTER_LOGGER("openstudio.sdd.ReverseTranslator");
   };
 
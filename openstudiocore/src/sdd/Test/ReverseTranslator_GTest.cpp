@@ -44,6 +44,8 @@
 #include "../../model/ThermalZone_Impl.hpp"
 #include "../../model/Space.hpp"
 #include "../../model/Space_Impl.hpp"
+#include "../../model/BuildingStory.hpp"
+#include "../../model/BuildingStory_Impl.hpp"
 #include "../../model/Surface.hpp"
 #include "../../model/Surface_Impl.hpp"
 #include "../../model/SimulationControl.hpp"
@@ -59,11 +61,79 @@
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/core/Optional.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
+
 #include <resources.hxx>
 
 #include <sstream>
+#include <chrono>
 
 using namespace openstudio::model;
 using namespace openstudio;
 
+// Translates a generated simulation SDD with many zones and spaces.  Each space looks up its
+// service hot water segment by name, so translation time grows quadratically with the number
+// of spaces if that lookup scans the document.
+TEST_F(SDDFixture, ReverseTranslator_LargeSimSDD)
+{
+  const unsigned numStories = 10;
+  const unsigned numZonesPerStory = 100;
+
+  std::stringstream ss;
+  ss << "<SDDXML>" << std::endl;
+  ss << "<Proj>" << std::endl;
+  ss << "<Name>Large Project</Name>" << std::endl;
+  ss << "<SimFlag>1</SimFlag>" << std::endl;
+  ss << "<Bldg>" << std::endl;
+  ss << "<Name>Large Building</Name>" << std::endl;
+  for (unsigned i = 0; i < numStories; ++i){
+    ss << "<Story>" << std::endl;
+    ss << "<Name>Story " << i << "</Name>" << std::endl;
+    for (unsigned j = 0; j < numZonesPerStory; ++j){
+      ss << "<Spc>" << std::endl;
+      ss << "<Name>Space " << i << " " << j << "</Name>" << std::endl;
+      ss << "<ThrmlZnRef>Zone " << i << " " << j << "</ThrmlZnRef>" << std::endl;
+      ss << "<SHWFluidSegRef>SHW Supply</SHWFluidSegRef>" << std::endl;
+      ss << "</Spc>" << std::endl;
+    }
+    ss << "</Story>" << std::endl;
+  }
+  for (unsigned i = 0; i < numStories; ++i){
+    for (unsigned j = 0; j < numZonesPerStory; ++j){
+      ss << "<ThrmlZn>" << std::endl;
+      ss << "<Name>Zone " << i << " " << j << "</Name>" << std::endl;
+      ss << "<Type>Unconditioned</Type>" << std::endl;
+      ss << "</ThrmlZn>" << std::endl;
+    }
+  }
+  ss << "</Bldg>" << std::endl;
+  ss << "</Proj>" << std::endl;
+  ss << "</SDDXML>" << std::endl;
+
+  // generated input goes to the test's working directory, not the resources tree
+  path p = openstudio::toPath("./ReverseTranslator_LargeSimSDD.xml");
+  {
+    openstudio::filesystem::ofstream file(p);
+    ASSERT_TRUE(file.is_open());
+    file << ss.str();
+  }
+
+  sdd::ReverseTranslator reverseTranslator;
+
+  auto start = std::chrono::steady_clock::now();
+  boost::optional<Model> model = reverseTranslator.loadModel(p);
+  auto end = std::chrono::steady_clock::now();
+  openstudio::filesystem::remove(p);
+
+  LOG(Info, "Translated " << numStories * numZonesPerStory << " zones in "
+    << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms");
 
+  ASSERT_TRUE(model);
+  EXPECT_EQ(numStories * numZonesPerStory, model->getModelObjects<ThermalZone>().size());
+  std::vector<Space> spaces = model->getModelObjects<Space>();
+  ASSERT_EQ(numStories * numZonesPerStory, spaces.size());
+  for (const Space& space : spaces){
+    EXPECT_TRUE(space.thermalZone());
+    EXPECT_TRUE(space.buildingStory());
+  }
+}
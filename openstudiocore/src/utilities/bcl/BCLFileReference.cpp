@@ -194,7 +194,7 @@ namespace openstudio{
 
   bool BCLFileReference::checkForUpdate()
   {
-    std::string newChecksum = openstudio::checksum(this->path());
+    std::string newChecksum = openstudio::cachedChecksum(this->path());
     if (m_checksum != newChecksum){
       m_checksum = newChecksum;
       return true;
@@ -35,6 +35,7 @@
 #include "../core/StringHelpers.hpp"
 #include "../core/FileReference.hpp"
 #include "../core/Assert.hpp"
+#include "../core/Checksum.hpp"
 
 #include <OpenStudio.hxx>
 
@@ -1061,7 +1062,8 @@ namespace openstudio{
 
     std::vector<BCLFileReference> filesToRemove;
     std::vector<BCLFileReference> filesToAdd;
-    for (BCLFileReference file : m_bclXML.files()) {
+    std::vector<BCLFileReference> filesToCheck;
+    for (const BCLFileReference& file : m_bclXML.files()) {
       std::string filename = file.fileName();
       if (!exists(file.path())){
         result = true;
@@ -1074,9 +1076,23 @@ namespace openstudio{
           result = true;
           filesToRemove.push_back(file);
         }
-      }else if (file.checkForUpdate()){
+      }else{
+        filesToCheck.push_back(file);
+      }
+    }
+
+    // checksum all existing files at once so they are read in parallel
+    std::vector<openstudio::path> pathsToCheck;
+    for (const BCLFileReference& file : filesToCheck) {
+      pathsToCheck.push_back(file.path());
+    }
+    std::vector<std::string> checksums = cachedChecksums(pathsToCheck);
+    OS_ASSERT(checksums.size() == filesToCheck.size());
+    for (unsigned i = 0; i < filesToCheck.size(); ++i) {
+      if (filesToCheck[i].checksum() != checksums[i]){
+        filesToCheck[i].setChecksum(checksums[i]);
         result = true;
-        filesToAdd.push_back(file);
+        filesToAdd.push_back(filesToCheck[i]);
       }
     }
 
@@ -0,0 +1,330 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "AsyncFileLogSink.hpp"
+#include "AsyncFileLogSink_Impl.hpp"
+
+#include "Assert.hpp"
+
+#include <QReadWriteLock>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+
+namespace openstudio{
+
+  namespace detail{
+
+    /// Output stream handed to the boost log backend.  The synchronous sink frontend serializes
+    /// all writes to the backend, so there is a single producer at any time and the ring buffer
+    /// between the producer and the writer thread needs no lock.  A mutex is only taken to wake
+    /// the writer thread when it has gone idle.
+    class AsyncLogStream : public std::ostream
+    {
+      public:
+
+      AsyncLogStream(const openstudio::path& path, unsigned queueSize, bool blockOnOverflow)
+        : std::ostream(nullptr),
+          m_buf(*this),
+          m_ofs(path),
+          m_slots(std::max(queueSize, 1u)),
+          m_blockOnOverflow(blockOnOverflow),
+          m_head(0),
+          m_tail(0),
+          m_written(0),
+          m_dropped(0),
+          m_writerWaiting(false),
+          m_stop(false)
+      {
+        this->rdbuf(&m_buf);
+        m_thread = std::thread(&AsyncLogStream::run, this);
+      }
+
+      virtual ~AsyncLogStream()
+      {
+        close();
+      }
+
+      unsigned queueSize() const
+      {
+        return static_cast<unsigned>(m_slots.size());
+      }
+
+      bool blockOnOverflow() const
+      {
+        return m_blockOnOverflow;
+      }
+
+      unsigned long long droppedMessages() const
+      {
+        return m_dropped.load();
+      }
+
+      // wait until everything pushed so far is written and flushed to the file
+      void waitForWriter()
+      {
+        size_t head = m_head.load();
+        while (m_written.load() < head){
+          wakeWriter();
+          std::this_thread::yield();
+        }
+      }
+
+      // stop the writer thread after writing all pending messages
+      void close()
+      {
+        if (m_thread.joinable()){
+          {
+            std::lock_guard<std::mutex> l(m_waitMutex);
+            m_stop = true;
+          }
+          m_waitCondition.notify_one();
+          m_thread.join();
+        }
+      }
+
+      private:
+
+      /// collects the characters of one record, the backend flushes after each record
+      class Buf : public std::streambuf
+      {
+        public:
+
+        explicit Buf(AsyncLogStream& stream)
+          : m_stream(stream)
+        {}
+
+        protected:
+
+        virtual int_type overflow(int_type c) override
+        {
+          if (!traits_type::eq_int_type(c, traits_type::eof())){
+            m_pending.push_back(traits_type::to_char_type(c));
+          }
+          return traits_type::not_eof(c);
+        }
+
+        virtual std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+          m_pending.append(s, static_cast<size_t>(n));
+          return n;
+        }
+
+        virtual int sync() override
+        {
+          if (!m_pending.empty()){
+            m_stream.push(m_pending);
+            m_pending.clear();
+          }
+          return 0;
+        }
+
+        private:
+
+        AsyncLogStream& m_stream;
+        std::string m_pending;
+      };
+
+      void push(std::string& message)
+      {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        while (head - m_tail.load(std::memory_order_acquire) >= m_slots.size()){
+          if (!m_blockOnOverflow || m_stop){
+            ++m_dropped;
+            return;
+          }
+          wakeWriter();
+          std::this_thread::yield();
+        }
+
+        m_slots[head % m_slots.size()].swap(message);
+        m_head.store(head + 1);
+
+        if (m_writerWaiting.load()){
+          wakeWriter();
+        }
+      }
+
+      void wakeWriter()
+      {
+        std::lock_guard<std::mutex> l(m_waitMutex);
+        m_waitCondition.notify_one();
+      }
+
+      void run()
+      {
+        while (true){
+          size_t tail = m_tail.load(std::memory_order_relaxed);
+          size_t head = m_head.load(std::memory_order_acquire);
+
+          if (tail == head){
+            m_ofs.flush();
+            m_written.store(tail);
+
+            std::unique_lock<std::mutex> l(m_waitMutex);
+            if (m_stop){
+              break;
+            }
+            m_writerWaiting.store(true);
+            if (m_head.load() == tail){
+              // timeout guards against a wakeup missed between the check and the wait
+              m_waitCondition.wait_for(l, std::chrono::milliseconds(100));
+            }
+            m_writerWaiting.store(false);
+            continue;
+          }
+
+          for (; tail != head; ++tail){
+            std::string& message = m_slots[tail % m_slots.size()];
+            m_ofs.write(message.data(), message.size());
+            message.clear();
+            m_tail.store(tail + 1, std::memory_order_release);
+          }
+        }
+      }
+
+      Buf m_buf;
+      openstudio::filesystem::ofstream m_ofs;
+      std::vector<std::string> m_slots;
+      bool m_blockOnOverflow;
+
+      // monotonically increasing positions, slot index is position modulo queue size
+      std::atomic<size_t> m_head;
+      std::atomic<size_t> m_tail;
+      std::atomic<size_t> m_written;
+      std::atomic<unsigned long long> m_dropped;
+
+      std::atomic<bool> m_writerWaiting;
+      std::atomic<bool> m_stop;
+      std::mutex m_waitMutex;
+      std::condition_variable m_waitCondition;
+      std::thread m_thread;
+    };
+
+    AsyncFileLogSink_Impl::AsyncFileLogSink_Impl(const openstudio::path& path, unsigned queueSize, bool blockOnOverflow)
+      : m_path(path)
+    {
+      m_stream = boost::shared_ptr<AsyncLogStream>(new AsyncLogStream(path, queueSize, blockOnOverflow));
+      this->setStream(m_stream);
+      this->enable();
+    }
+
+    AsyncFileLogSink_Impl::~AsyncFileLogSink_Impl()
+    {
+      this->disable();
+
+      m_stream->close();
+    }
+
+    openstudio::path AsyncFileLogSink_Impl::path() const
+    {
+      QReadLocker l(m_mutex);
+
+      return m_path;
+    }
+
+    unsigned AsyncFileLogSink_Impl::queueSize() const
+    {
+      return m_stream->queueSize();
+    }
+
+    bool AsyncFileLogSink_Impl::blockOnOverflow() const
+    {
+      return m_stream->blockOnOverflow();
+    }
+
+    unsigned long long AsyncFileLogSink_Impl::droppedMessages() const
+    {
+      return m_stream->droppedMessages();
+    }
+
+    void AsyncFileLogSink_Impl::flush()
+    {
+      // push any record still held by the backend, then wait for the writer
+      this->sink()->flush();
+      m_stream->waitForWriter();
+    }
+
+    std::vector<LogMessage> AsyncFileLogSink_Impl::logMessages()
+    {
+      this->flush();
+
+      openstudio::filesystem::ifstream ifs(m_path);
+      std::string line;
+      std::string text;
+      while(std::getline(ifs, line)){
+        text += line + "\n";
+      }
+      return LogMessage::parseLogText(text);
+    }
+
+  } // detail
+
+  AsyncFileLogSink::AsyncFileLogSink(const openstudio::path& path, unsigned queueSize, bool blockOnOverflow)
+    : LogSink(boost::shared_ptr<detail::AsyncFileLogSink_Impl>(new detail::AsyncFileLogSink_Impl(path, queueSize, blockOnOverflow)))
+  {
+    OS_ASSERT(getImpl<detail::AsyncFileLogSink_Impl>());
+  }
+
+  openstudio::path AsyncFileLogSink::path() const
+  {
+    return this->getImpl<detail::AsyncFileLogSink_Impl>()->path();
+  }
+
+  unsigned AsyncFileLogSink::queueSize() const
+  {
+    return this->getImpl<detail::AsyncFileLogSink_Impl>()->queueSize();
+  }
+
+  bool AsyncFileLogSink::blockOnOverflow() const
+  {
+    return this->getImpl<detail::AsyncFileLogSink_Impl>()->blockOnOverflow();
+  }
+
+  unsigned long long AsyncFileLogSink::droppedMessages() const
+  {
+    return this->getImpl<detail::AsyncFileLogSink_Impl>()->droppedMessages();
+  }
+
+  void AsyncFileLogSink::flush()
+  {
+    this->getImpl<detail::AsyncFileLogSink_Impl>()->flush();
+  }
+
+  std::vector<LogMessage> AsyncFileLogSink::logMessages()
+  {
+    return this->getImpl<detail::AsyncFileLogSink_Impl>()->logMessages();
+  }
+
+} // openstudio
@@ -0,0 +1,74 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_ASYNCFILELOGSINK_HPP
+#define UTILITIES_CORE_ASYNCFILELOGSINK_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "LogSink.hpp"
+#include "Path.hpp"
+
+namespace openstudio{
+
+  /** AsyncFileLogSink writes log messages to a file from a background thread.  Formatted messages
+   *  are placed in a bounded ring buffer so threads that log never wait on file I/O.  When the
+   *  buffer is full messages are either dropped or the logging thread waits for space, depending
+   *  on blockOnOverflow. */
+  class UTILITIES_API AsyncFileLogSink : public LogSink
+  {
+    public:
+
+    /// constructor takes path of file, opens in write mode positioned at file beginning
+    /// and registers in the global logger, queueSize is the maximum number of pending messages
+    AsyncFileLogSink(const openstudio::path& path, unsigned queueSize = 8192, bool blockOnOverflow = false);
+
+    /// returns the path that log messages are written to
+    openstudio::path path() const;
+
+    /// returns the maximum number of pending messages
+    unsigned queueSize() const;
+
+    /// returns true if logging threads wait for space when the queue is full
+    bool blockOnOverflow() const;
+
+    /// returns the number of messages dropped because the queue was full
+    unsigned long long droppedMessages() const;
+
+    /// blocks until all pending messages have been written to the file
+    void flush();
+
+    /// get messages out of the file content, pending messages are flushed first
+    std::vector<LogMessage> logMessages();
+
+  };
+
+} // openstudio
+
+#endif // UTILITIES_CORE_ASYNCFILELOGSINK_HPP
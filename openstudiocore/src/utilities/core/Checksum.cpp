@@ -28,11 +28,17 @@
 ***********************************************************************************************************************/
 
 #include "Checksum.hpp"
-
-#include <sstream>
+#include "FilesystemHelpers.hpp"
 
 #include <boost/crc.hpp>
 
+#include <QtConcurrent>
+
+#include <cstdio>
+#include <ctime>
+#include <map>
+#include <mutex>
+
 
 namespace openstudio {
 
@@ -48,41 +54,67 @@ namespace openstudio {
 
       return result;
     }
+
+    // process the bytes in [begin, end) skipping ignored characters, runs between
+    // ignored characters are passed to the crc directly rather than copied
+    void checksumProcessBytes(boost::crc_32_type& crc, const char* begin, const char* end)
+    {
+      const char* runBegin = begin;
+      for (const char* it = begin; it != end; ++it){
+        if (checksumIgnore(*it)){
+          crc.process_bytes(runBegin, it - runBegin);
+          runBegin = it + 1;
+        }
+      }
+      crc.process_bytes(runBegin, end - runBegin);
+    }
+
+    std::string checksumToString(const boost::crc_32_type& crc)
+    {
+      char result[9];
+      std::snprintf(result, sizeof(result), "%08X", static_cast<unsigned>(crc.checksum()));
+      return std::string(result, 8);
+    }
+
+    struct ChecksumCacheEntry
+    {
+      openstudio::filesystem::FileStamp stamp;
+      std::string checksum;
+    };
+
+    std::mutex& checksumCacheMutex()
+    {
+      static std::mutex result;
+      return result;
+    }
+
+    std::map<openstudio::path, ChecksumCacheEntry>& checksumCache()
+    {
+      static std::map<openstudio::path, ChecksumCacheEntry> result;
+      return result;
+    }
   }
 
   /// return 8 character hex checksum of string
   std::string checksum(const std::string& s)
   {
-    std::stringstream ss(s);
-    return checksum(ss);
+    boost::crc_32_type crc;
+    openstudio::detail::checksumProcessBytes(crc, s.data(), s.data() + s.size());
+    return openstudio::detail::checksumToString(crc);
   }
 
   /// return 8 character hex checksum of istream
   std::string checksum(std::istream& is)
   {
-    boost::crc_32_type  crc;
+    boost::crc_32_type crc;
+    std::vector<char> buffer(1 << 16);
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
-      is.read(buffer, n);
+      is.read(buffer.data(), buffer.size());
       std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-
-      crc.process_bytes(str.c_str(), stringSize);
+      openstudio::detail::checksumProcessBytes(crc, buffer.data(), buffer.data() + readSize);
     } while ( is );
 
-    std::stringstream ss;
-    ss << std::hex << std::uppercase << crc.checksum();
-    std::string result = "00000000";
-    std::string checksum = ss.str();
-    result.replace(8-checksum.size(), checksum.size(), checksum);
-
-    return result;
+    return openstudio::detail::checksumToString(crc);
   }
 
   /// return 8 character hex checksum of file contents
@@ -99,4 +131,47 @@ namespace openstudio {
     return result;
   }
 
+  std::string cachedChecksum(const path& p)
+  {
+    openstudio::filesystem::FileStamp stamp;
+    if (!openstudio::filesystem::file_stamp(p, stamp)){
+      return checksum(p);
+    }
+
+    {
+      std::lock_guard<std::mutex> l(openstudio::detail::checksumCacheMutex());
+      auto it = openstudio::detail::checksumCache().find(p);
+      if (it != openstudio::detail::checksumCache().end()){
+        if (it->second.stamp == stamp){
+          return it->second.checksum;
+        }
+      }
+    }
+
+    std::time_t takenAt = std::time(nullptr);
+    std::string result = checksum(p);
+
+    // a file written in the last couple of seconds could be rewritten without changing its stamp
+    if (openstudio::filesystem::file_stamp_is_settled(stamp, takenAt)){
+      std::lock_guard<std::mutex> l(openstudio::detail::checksumCacheMutex());
+      openstudio::detail::ChecksumCacheEntry entry = {stamp, result};
+      openstudio::detail::checksumCache()[p] = entry;
+    }
+
+    return result;
+  }
+
+  std::vector<std::string> cachedChecksums(const std::vector<path>& paths)
+  {
+    if (paths.size() < 2){
+      std::vector<std::string> result;
+      for (const path& p : paths){
+        result.push_back(cachedChecksum(p));
+      }
+      return result;
+    }
+
+    return QtConcurrent::blockingMapped<std::vector<std::string> >(paths, &cachedChecksum);
+  }
+
 } // openstudio
@@ -35,6 +35,7 @@
 
 #include <string>
 #include <ostream>
+#include <vector>
 
 namespace openstudio {
 
@@ -47,6 +48,13 @@ namespace openstudio {
   /// return 8 character hex checksum of file contents
   UTILITIES_API std::string checksum(const path& p);
 
+  /// return 8 character hex checksum of file contents, the result of a previous call is reused
+  /// if the file's size and last write time are unchanged
+  UTILITIES_API std::string cachedChecksum(const path& p);
+
+  /// return cachedChecksum of each file, files are read in parallel
+  UTILITIES_API std::vector<std::string> cachedChecksums(const std::vector<path>& paths);
+
 } // openstudio
 
 
@@ -31,6 +31,10 @@
 #include "Path.hpp"
 #include "Assert.hpp"
 
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
 namespace openstudio {
   namespace filesystem {
     std::vector<char> read(openstudio::filesystem::ifstream &t_file)
@@ -172,5 +176,55 @@ namespace openstudio {
     {
       return to_time_t(openstudio::filesystem::last_write_time(t_path));
     }
+
+    bool FileStamp::operator==(const FileStamp &t_other) const
+    {
+      return (size == t_other.size) && (lastWriteSeconds == t_other.lastWriteSeconds) &&
+             (lastWriteNanoseconds == t_other.lastWriteNanoseconds) && (fileId == t_other.fileId);
+    }
+
+    bool FileStamp::operator!=(const FileStamp &t_other) const
+    {
+      return !(*this == t_other);
+    }
+
+    bool file_stamp(const openstudio::path &t_path, FileStamp &t_stamp)
+    {
+#ifdef _WIN32
+      boost::system::error_code ec;
+      boost::uintmax_t size = openstudio::filesystem::file_size(t_path, ec);
+      if (ec) {
+        return false;
+      }
+      std::time_t lastWriteTime = openstudio::filesystem::last_write_time(t_path, ec);
+      if (ec) {
+        return false;
+      }
+      t_stamp.size = size;
+      t_stamp.lastWriteSeconds = lastWriteTime;
+      t_stamp.lastWriteNanoseconds = 0;
+      t_stamp.fileId = 0;
+#else
+      struct stat st;
+      if ((::stat(t_path.c_str(), &st) != 0) || !S_ISREG(st.st_mode)) {
+        return false;
+      }
+      t_stamp.size = st.st_size;
+      t_stamp.lastWriteSeconds = st.st_mtime;
+#ifdef __APPLE__
+      t_stamp.lastWriteNanoseconds = st.st_mtimespec.tv_nsec;
+#else
+      t_stamp.lastWriteNanoseconds = st.st_mtim.tv_nsec;
+#endif
+      t_stamp.fileId = st.st_ino;
+#endif
+      return true;
+    }
+
+    bool file_stamp_is_settled(const FileStamp &t_stamp, time_t t_takenAt)
+    {
+      // some file systems only keep whole (or even two) seconds
+      return (static_cast<std::int64_t>(t_takenAt) - t_stamp.lastWriteSeconds) >= 2;
+    }
   }
 }
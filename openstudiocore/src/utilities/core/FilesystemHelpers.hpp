@@ -33,6 +33,9 @@
 #include "Filesystem.hpp"
 #include <QByteArray>
 
+#include <cstdint>
+#include <ctime>
+
 namespace openstudio {
   namespace filesystem {
     /// reads entire file from the current read position until the end of file
@@ -70,6 +73,25 @@ namespace openstudio {
     UTILITIES_API void write(openstudio::filesystem::ofstream &t_file, const QString &);
 
     UTILITIES_API time_t last_write_time_as_time_t(const openstudio::path &t_path);
+
+    /// identifies one version of a file on disk, used to tell whether results computed from the file are stale
+    /// lastWriteNanoseconds and fileId are 0 on platforms and file systems that do not provide them
+    struct UTILITIES_API FileStamp {
+      std::uint64_t size;
+      std::int64_t lastWriteSeconds;
+      std::int64_t lastWriteNanoseconds;
+      std::uint64_t fileId;
+
+      bool operator==(const FileStamp &t_other) const;
+      bool operator!=(const FileStamp &t_other) const;
+    };
+
+    /// gets the stamp of the file at t_path, returns false if the file cannot be stat'ed
+    UTILITIES_API bool file_stamp(const openstudio::path &t_path, FileStamp &t_stamp);
+
+    /// true if t_stamp was taken at least two seconds after the file was last written, rewrites of the file
+    /// within the resolution of its modification time can then no longer go unnoticed
+    UTILITIES_API bool file_stamp_is_settled(const FileStamp &t_stamp, time_t t_takenAt);
   }
 }
 
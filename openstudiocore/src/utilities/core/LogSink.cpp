@@ -63,7 +63,7 @@ namespace openstudio{
 
     void LogSink_Impl::enable()
     {
-      Logger::instance().addSink(m_sink);
+      Logger::instance().addSink(m_sink, this->filterLogLevel());
     }
 
     void LogSink_Impl::disable()
@@ -96,6 +96,16 @@ namespace openstudio{
       this->updateFilter(l);
     }
 
+    LogLevel LogSink_Impl::filterLogLevel() const
+    {
+      QReadLocker l(m_mutex);
+
+      if (m_logLevel){
+        return *m_logLevel;
+      }
+      return Trace;
+    }
+
     boost::optional<boost::regex> LogSink_Impl::channelRegex() const
     {
       QReadLocker l(m_mutex);
@@ -261,11 +271,13 @@ namespace openstudio{
   void LogSink::setLogLevel(LogLevel logLevel)
   {
     m_impl->setLogLevel(logLevel);
+    Logger::instance().setSinkLogLevel(m_impl->sink(), m_impl->filterLogLevel());
   }
 
   void LogSink::resetLogLevel()
   {
     m_impl->resetLogLevel();
+    Logger::instance().setSinkLogLevel(m_impl->sink(), m_impl->filterLogLevel());
   }
 
   boost::optional<boost::regex> LogSink::channelRegex() const
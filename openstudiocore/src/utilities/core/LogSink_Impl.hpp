@@ -72,6 +72,9 @@ namespace openstudio{
       /// reset the core logging level
       void resetLogLevel();
 
+      /// get the lowest level accepted by the sink, Trace if no logging level is set
+      LogLevel filterLogLevel() const;
+
       /// get the regular expression to match log channels
       boost::optional<boost::regex> channelRegex() const;
 
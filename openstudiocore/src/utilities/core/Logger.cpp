@@ -28,12 +28,14 @@
 ***********************************************************************************************************************/
 
 #include "Logger.hpp"
+#include "LogSink_Impl.hpp"
 
 #include <boost/log/common.hpp>
 #include <boost/log/attributes/function.hpp>
 
 #include <boost/utility/empty_deleter.hpp>
 
+#include <algorithm>
 
 #include <QReadWriteLock>
 #include <QThread>
@@ -76,25 +78,29 @@ namespace openstudio{
   /// convenience function for SWIG, prefer macros in C++
   void logFree(LogLevel level, const std::string& channel, const std::string& message)
   {
+    if (!openstudio::Logger::instance().logLevelEnabled(level)){
+      return;
+    }
     BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
   }
 
   LoggerSingleton::LoggerSingleton()
-    : m_mutex(new QReadWriteLock())
+    : m_mutex(new QReadWriteLock()), m_logLevel(Fatal + 1)
   {
     // Make QThread attribute available to logging
     boost::log::core::get()->add_global_attribute("QThread", boost::log::attributes::make_function(&QThread::currentThread));
 
     // We have to provide an empty deleter to avoid destroying the global stream
     boost::shared_ptr<std::ostream> stdOut(&std::cout, boost::empty_deleter());
+    // Set the level on the impl directly, LogSink::setLogLevel would call back into the Logger
     m_standardOutLogger.setStream(stdOut);
-    m_standardOutLogger.setLogLevel(Warn);
-    this->addSink(m_standardOutLogger.sink());
+    m_standardOutLogger.m_impl->setLogLevel(Warn);
+    this->addSink(m_standardOutLogger.sink(), Warn);
 
     // We have to provide an empty deleter to avoid destroying the global stream
     boost::shared_ptr<std::ostream> stdErr(&std::cerr, boost::empty_deleter());
     m_standardErrLogger.setStream(stdErr);
-    m_standardErrLogger.setLogLevel(Warn);
+    m_standardErrLogger.m_impl->setLogLevel(Warn);
     //this->addSink(m_standardErrLogger.sink());
 
     // register Qt message handler
@@ -157,7 +163,7 @@ namespace openstudio{
     return (it != m_sinks.end());
   }
 
-  void LoggerSingleton::addSink(boost::shared_ptr<LogSinkBackend> sink)
+  void LoggerSingleton::addSink(boost::shared_ptr<LogSinkBackend> sink, LogLevel logLevel)
   {
     QWriteLocker l(m_mutex);
 
@@ -169,7 +175,9 @@ namespace openstudio{
       l.unlock();
       QWriteLocker l2(m_mutex);
 
-      m_sinks.insert(sink);
+      m_sinks.insert(std::make_pair(sink, logLevel));
+
+      updateLogLevel();
 
       // Register the sink in the logging core
       boost::log::core::get()->add_sink(sink);
@@ -190,9 +198,33 @@ namespace openstudio{
 
       m_sinks.erase(it);
 
+      updateLogLevel();
+
       // Register the sink in the logging core
       boost::log::core::get()->remove_sink(sink);
     }
   }
 
+  void LoggerSingleton::setSinkLogLevel(boost::shared_ptr<LogSinkBackend> sink, LogLevel logLevel)
+  {
+    QWriteLocker l(m_mutex);
+
+    auto it = m_sinks.find(sink);
+    if (it != m_sinks.end()){
+      it->second = logLevel;
+
+      updateLogLevel();
+    }
+  }
+
+  void LoggerSingleton::updateLogLevel()
+  {
+    // no enabled sinks means no message is accepted
+    int logLevel = Fatal + 1;
+    for (const auto& p : m_sinks){
+      logLevel = std::min(logLevel, static_cast<int>(p.second));
+    }
+    m_logLevel.store(logLevel);
+  }
+
 } // openstudio
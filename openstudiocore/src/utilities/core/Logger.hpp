@@ -40,8 +40,8 @@
 #include <boost/shared_ptr.hpp>
 
 #include <sstream>
-#include <set>
 #include <map>
+#include <atomic>
 
 class QReadWriteLock;
 class QWriteLocker;
@@ -58,12 +58,15 @@ class QWriteLocker;
 #define LOG_AND_THROW(__message__) \
   LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
+/// log a message from outside a registered class, the message is only formatted
+/// if at least one enabled sink accepts messages at this level
 #define LOG_FREE(__level__, __channel__, __message__) \
   { \
-    std::stringstream _ss1; \
-    _ss1 << __message__; \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    if (openstudio::Logger::instance().logLevelEnabled(__level__)){ \
+      std::stringstream _ss1; \
+      _ss1 << __message__; \
+      openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    } \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -102,26 +105,45 @@ namespace openstudio{
     /// exist a new logger will be set up at the default level
     LoggerType& loggerFromChannel(const LogChannel& logChannel);
 
+    /// returns true if at least one enabled sink may accept messages at logLevel,
+    /// channel and thread filters are not considered so this may return true for a
+    /// message that is later rejected, it never returns false for an accepted message
+    bool logLevelEnabled(LogLevel logLevel) const
+    {
+      return static_cast<int>(logLevel) >= m_logLevel.load(std::memory_order_relaxed);
+    }
+
    protected:
 
+    friend class LogSink;
     friend class detail::LogSink_Impl;
 
     /// is the sink found in the logging core
     bool findSink(boost::shared_ptr<LogSinkBackend> sink);
 
     /// adds a sink to the logging core, equivalent to logSink.enable()
-    void addSink(boost::shared_ptr<LogSinkBackend> sink);
+    /// logLevel is the lowest level the sink accepts
+    void addSink(boost::shared_ptr<LogSinkBackend> sink, LogLevel logLevel);
 
     /// removes a sink to the logging core, equivalent to logSink.disable()
     void removeSink(boost::shared_ptr<LogSinkBackend> sink);
 
+    /// updates the lowest level accepted by a sink, does nothing if sink is not in the logging core
+    void setSinkLogLevel(boost::shared_ptr<LogSinkBackend> sink, LogLevel logLevel);
+
    private:
 
     /// private constructor
     LoggerSingleton();
 
+    /// recompute m_logLevel from m_sinks, must be called with write lock held
+    void updateLogLevel();
+
     mutable QReadWriteLock* m_mutex;
 
+    /// lowest level accepted by any enabled sink, read without locking by LOG macros
+    std::atomic<int> m_logLevel;
+
     /// standard out logger
     LogSink m_standardOutLogger;
 
@@ -132,9 +154,9 @@ namespace openstudio{
     typedef std::map<std::string, LoggerType, openstudio::IstringCompare> LoggerMapType;
     LoggerMapType m_loggerMap;
 
-    /// current sinks, kept here so don't destruct when LogSink wrapper goes out of scope
-    typedef std::set<boost::shared_ptr<LogSinkBackend> > SinkSetType;
-    SinkSetType m_sinks;
+    /// current sinks and their lowest accepted level, kept here so don't destruct when LogSink wrapper goes out of scope
+    typedef std::map<boost::shared_ptr<LogSinkBackend>, LogLevel> SinkMapType;
+    SinkMapType m_sinks;
   };
 
 #if _WIN32 || _MSC_VER
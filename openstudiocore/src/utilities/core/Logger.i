@@ -5,6 +5,7 @@
   #include <utilities/core/LogMessage.hpp>
   #include <utilities/core/LogSink.hpp>
   #include <utilities/core/FileLogSink.hpp>
+  #include <utilities/core/AsyncFileLogSink.hpp>
   #include <utilities/core/StringStreamLogSink.hpp>
   #include <utilities/core/Logger.hpp>
 %}
@@ -24,6 +25,7 @@
 %include <utilities/core/LogMessage.hpp>
 %include <utilities/core/LogSink.hpp>
 %include <utilities/core/FileLogSink.hpp>
+%include <utilities/core/AsyncFileLogSink.hpp>
 %include <utilities/core/StringStreamLogSink.hpp>
 %include <utilities/core/Logger.hpp>
 
@@ -38,6 +38,8 @@
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
+using openstudio::cachedChecksum;
+using openstudio::cachedChecksums;
 using openstudio::createUUID;
 using openstudio::StringVector;
 using openstudio::toString;
@@ -113,6 +115,65 @@ TEST(Checksum, Paths)
   EXPECT_EQ("00000000", checksum(p));
 }
 
+TEST(Checksum, CachedPaths)
+{
+  std::vector<path> paths;
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/Checksum.txt"));
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/Checksum2.txt"));
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/"));
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/NotAFile.txt"));
+
+  StringVector checksums = cachedChecksums(paths);
+  ASSERT_EQ(4u, checksums.size());
+  EXPECT_EQ("1AD514BA", checksums[0]);
+  EXPECT_EQ("17B88D3A", checksums[1]);
+  EXPECT_EQ("00000000", checksums[2]);
+  EXPECT_EQ("00000000", checksums[3]);
+
+  // cached result is not reused once the file changes
+  path p = toPath("./CachedChecksum.txt");
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  EXPECT_EQ("1AD514BA", cachedChecksum(p));
+  EXPECT_EQ("1AD514BA", cachedChecksum(p));
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there\r\nGoodbye";
+  }
+  EXPECT_EQ("17B88D3A", cachedChecksum(p));
+
+  // same size rewrite within the same second
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "HI there";
+  }
+  EXPECT_EQ("D5682D26", cachedChecksum(p));
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  EXPECT_EQ("1AD514BA", cachedChecksum(p));
+
+  openstudio::filesystem::remove(p);
+  EXPECT_EQ("00000000", cachedChecksum(p));
+}
+
+TEST(Checksum, LargeStrings)
+{
+  // carriage returns straddling read buffer boundaries are ignored
+  std::string withCR;
+  std::string withoutCR;
+  for (unsigned i = 0; i < 100000; ++i) {
+    withCR += "line " + std::to_string(i) + "\r\n";
+    withoutCR += "line " + std::to_string(i) + "\n";
+  }
+  stringstream ss(withCR);
+  EXPECT_EQ(checksum(withoutCR), checksum(ss));
+  EXPECT_EQ(checksum(withoutCR), checksum(withCR));
+}
+
 TEST(Checksum, UUIDs) {
   StringVector checksums;
   for (unsigned i = 0, n = 1000; i < n; ++i) {
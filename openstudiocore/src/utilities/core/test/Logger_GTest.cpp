@@ -32,6 +32,7 @@
 #include "../Logger.hpp"
 #include "../FileLogSink.hpp"
 #include "../StringStreamLogSink.hpp"
+#include "../AsyncFileLogSink.hpp"
 
 #include <sstream>
 
@@ -39,6 +40,7 @@ using openstudio::toPath;
 using openstudio::Logger;
 using openstudio::FileLogSink;
 using openstudio::StringStreamLogSink;
+using openstudio::AsyncFileLogSink;
 using openstudio::LogMessage;
 
 namespace
@@ -343,4 +345,71 @@ namespace
 
     EXPECT_NO_THROW(openstudio::filesystem::remove(path));
   }
+
+  TEST(LoggerTest, logLevelEnabled)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    StringStreamLogSink sink;
+    sink.setLogLevel(Error);
+    EXPECT_FALSE(openstudio::Logger::instance().logLevelEnabled(Debug));
+    EXPECT_TRUE(openstudio::Logger::instance().logLevelEnabled(Error));
+    EXPECT_TRUE(openstudio::Logger::instance().logLevelEnabled(Fatal));
+
+    // message is not formatted when level is filtered
+    int formatted = 0;
+    LOG_FREE(Debug, "free.channel", "Free Debug " << ++formatted);
+    EXPECT_EQ(0, formatted);
+    LOG_FREE(Error, "free.channel", "Free Error " << ++formatted);
+    EXPECT_EQ(1, formatted);
+    ASSERT_EQ(1u, sink.logMessages().size());
+    EXPECT_EQ("Free Error 1", sink.logMessages()[0].logMessage());
+
+    sink.resetLogLevel();
+    EXPECT_TRUE(openstudio::Logger::instance().logLevelEnabled(Debug));
+
+    sink.setLogLevel(Warn);
+    {
+      StringStreamLogSink sink2;
+      sink2.setLogLevel(Debug);
+      EXPECT_TRUE(openstudio::Logger::instance().logLevelEnabled(Debug));
+    }
+    EXPECT_FALSE(openstudio::Logger::instance().logLevelEnabled(Debug));
+  }
+
+  TEST(LoggerTest, async_file_logger)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    openstudio::path path = toPath("./async_file_logger.log");
+    openstudio::filesystem::remove(path);
+    ASSERT_FALSE(openstudio::filesystem::exists(path));
+
+    {
+      AsyncFileLogSink sink(path, 16, true);
+      EXPECT_EQ(16u, sink.queueSize());
+      EXPECT_TRUE(sink.blockOnOverflow());
+      sink.setLogLevel(Error);
+      sink.setChannelRegex(boost::regex("hello\\..*"));
+      ASSERT_TRUE(openstudio::filesystem::exists(path));
+
+      freeLogging();
+      classLogging();
+
+      std::vector<LogMessage> logMessages = sink.logMessages();
+      ASSERT_EQ(1u, logMessages.size());
+      EXPECT_EQ(Error, logMessages[0].logLevel());
+      EXPECT_EQ("hello.channel", logMessages[0].logChannel());
+      EXPECT_EQ("Hello Error", logMessages[0].logMessage());
+
+      // blocking sink never drops messages
+      for (unsigned i = 0; i < 1000; ++i){
+        classLogging();
+      }
+      EXPECT_EQ(1001u, sink.logMessages().size());
+      EXPECT_EQ(0u, sink.droppedMessages());
+    }
+
+    EXPECT_NO_THROW(openstudio::filesystem::remove(path));
+  }
 }
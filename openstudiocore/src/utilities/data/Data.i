@@ -35,6 +35,10 @@
 %template(OptionalEndUseType) boost::optional<openstudio::EndUseType>;
 %template(BuildingSectorVector) std::vector<openstudio::BuildingSector>;
 %template(OptionalBuildingSector) boost::optional<openstudio::BuildingSector>;
+%template(AggregationPeriodVector) std::vector<openstudio::AggregationPeriod>;
+%template(OptionalAggregationPeriod) boost::optional<openstudio::AggregationPeriod>;
+%template(AggregationMethodVector) std::vector<openstudio::AggregationMethod>;
+%template(OptionalAggregationMethod) boost::optional<openstudio::AggregationMethod>;
 
 %ignore std::vector<openstudio::Tag>::vector(size_type);
 %ignore std::vector<openstudio::Tag>::resize(size_type);
@@ -215,6 +215,34 @@ OPENSTUDIO_ENUM(BuildingSector,
   ((Commercial)(NonResidential))
   ((Residential)));
 
+/** \class AggregationPeriod
+ *  \brief Reporting period of an aggregated TimeSeries.
+ *  \details See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual macro call is:
+ *  \code
+OPENSTUDIO_ENUM(AggregationPeriod,
+  ((Hourly))
+  ((Daily))
+  ((Monthly)));
+ *  \endcode */
+OPENSTUDIO_ENUM(AggregationPeriod,
+  ((Hourly))
+  ((Daily))
+  ((Monthly)));
+
+/** \class AggregationMethod
+ *  \brief How the values reported in each period of an aggregated TimeSeries are combined.
+ *  \details See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual macro call is:
+ *  \code
+OPENSTUDIO_ENUM(AggregationMethod,
+  ((Sum))
+  ((Mean))
+  ((Peak)));
+ *  \endcode */
+OPENSTUDIO_ENUM(AggregationMethod,
+  ((Sum))
+  ((Mean))
+  ((Peak)));
+
 } // openstudio
 
 #endif // UTILITIES_DATA_DATAENUMS_HPP
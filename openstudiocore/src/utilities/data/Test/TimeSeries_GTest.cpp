@@ -1184,6 +1184,129 @@ TEST_F(DataFixture, TimeSeries_Multiply8760)
 
 }
 
+TEST_F(DataFixture, TimeSeries_AddSubtractOffset)
+{
+  std::string units = "W";
+
+  Vector values = linspace(1, 48, 48);
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 0, 0));
+  DateTime offsetReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 30, 0));
+
+  TimeSeries hourly(firstReportDateTime, Time(0, 1), values, units);
+  TimeSeries offset(offsetReportDateTime, Time(0, 1), values, units);
+
+  // result reports at the union of both reporting times
+  TimeSeries sum = hourly + offset;
+  TimeSeries difference = offset - hourly;
+  ASSERT_EQ(96u, sum.values().size());
+  ASSERT_EQ(96u, difference.values().size());
+  EXPECT_EQ(firstReportDateTime, sum.firstReportDateTime());
+  EXPECT_FALSE(sum.intervalLength());
+
+  DateTimeVector dateTimes = sum.dateTimes();
+  for (unsigned i = 0; i < dateTimes.size(); ++i) {
+    EXPECT_EQ(hourly.value(dateTimes[i]) + offset.value(dateTimes[i]), sum.values()[i]);
+    EXPECT_EQ(offset.value(dateTimes[i]) - hourly.value(dateTimes[i]), difference.values()[i]);
+  }
+
+  // series reporting at the same times are summed in one pass
+  std::vector<TimeSeries> series(100, hourly);
+  TimeSeries total = openstudio::sum(series);
+  ASSERT_EQ(48u, total.values().size());
+  EXPECT_EQ(firstReportDateTime, total.firstReportDateTime());
+  for (unsigned i = 0; i < 48; ++i) {
+    EXPECT_DOUBLE_EQ(100 * values[i], total.values()[i]);
+  }
+}
+
+TEST_F(DataFixture, TimeSeries_Aggregate)
+{
+  // hourly values for a full year, 1 to 24 each day
+  Vector values(8760);
+  for (unsigned i = 0; i < 8760; ++i) {
+    values[i] = 1.0 + (i % 24);
+  }
+  TimeSeries hourly(Date(MonthOfYear(MonthOfYear::Jan), 1, 2011), Time(0, 1), values, "J");
+
+  // value reported at midnight belongs to the preceding day
+  TimeSeries dailySum = hourly.aggregate(AggregationPeriod::Daily, AggregationMethod::Sum);
+  ASSERT_EQ(365u, dailySum.values().size());
+  ASSERT_TRUE(dailySum.intervalLength());
+  EXPECT_EQ(Time(1), dailySum.intervalLength().get());
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 2, 2011)), dailySum.firstReportDateTime());
+  EXPECT_DOUBLE_EQ(300.0, dailySum.values()[0]);
+  EXPECT_DOUBLE_EQ(300.0, dailySum.values()[364]);
+
+  TimeSeries dailyPeak = hourly.aggregate(AggregationPeriod::Daily, AggregationMethod::Peak);
+  ASSERT_EQ(365u, dailyPeak.values().size());
+  EXPECT_DOUBLE_EQ(24.0, dailyPeak.values()[100]);
+
+  TimeSeries hourlySum = hourly.aggregate(AggregationPeriod::Hourly, AggregationMethod::Sum);
+  ASSERT_EQ(8760u, hourlySum.values().size());
+  EXPECT_EQ(hourly.firstReportDateTime(), hourlySum.firstReportDateTime());
+  EXPECT_TRUE(values == hourlySum.values());
+
+  // months have different lengths
+  TimeSeries monthlySum = hourly.aggregate(AggregationPeriod::Monthly, AggregationMethod::Sum);
+  ASSERT_EQ(12u, monthlySum.values().size());
+  EXPECT_FALSE(monthlySum.intervalLength());
+  EXPECT_DOUBLE_EQ(31 * 300.0, monthlySum.values()[0]);
+  EXPECT_DOUBLE_EQ(28 * 300.0, monthlySum.values()[1]);
+  DateTimeVector monthEnds = monthlySum.dateTimes();
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Feb), 1, 2011)), monthEnds[0]);
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Mar), 1, 2011)), monthEnds[1]);
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 1, 2012)), monthEnds[11]);
+
+  TimeSeries monthlyMean = hourly.aggregate(AggregationPeriod::Monthly, AggregationMethod::Mean);
+  ASSERT_EQ(12u, monthlyMean.values().size());
+  EXPECT_DOUBLE_EQ(12.5, monthlyMean.values()[6]);
+
+  // partial periods at the start and end of the series
+  Vector quarterHours = linspace(1, 8, 8);
+  TimeSeries fifteenMinute(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 1, 2011), Time(0, 0, 45)), Time(0, 0, 15), quarterHours, "W");
+  TimeSeries hourlyMean = fifteenMinute.aggregate(AggregationPeriod::Hourly, AggregationMethod::Mean);
+  ASSERT_EQ(3u, hourlyMean.values().size());
+  EXPECT_DOUBLE_EQ(1.5, hourlyMean.values()[0]);
+  EXPECT_DOUBLE_EQ(4.5, hourlyMean.values()[1]);
+  EXPECT_DOUBLE_EQ(7.5, hourlyMean.values()[2]);
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 1, 2011), Time(0, 1)), hourlyMean.firstReportDateTime());
+
+  EXPECT_TRUE(TimeSeries().aggregate(AggregationPeriod::Daily, AggregationMethod::Sum).values().empty());
+}
+
+TEST_F(DataFixture, TimeSeries_OneMinuteYear)
+{
+  // a year of one minute data, reporting times are computed rather than stored
+  unsigned numValues = 525600;
+  Vector values = linspace(1, numValues, numValues);
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1, 2011), Time(0, 0, 1));
+  TimeSeries minutely(firstReportDateTime, Time(0, 0, 1), values, "W");
+
+  EXPECT_EQ(firstReportDateTime, minutely.dateTimes(0));
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 1, 2012)), minutely.dateTimes(numValues - 1));
+  EXPECT_EQ(60 * 60, minutely.secondsFromFirstReport(60));
+  EXPECT_EQ(DateTime(), minutely.dateTimes(numValues));
+
+  // slicing is inclusive of both ends
+  Vector july = minutely.values(DateTime(Date(MonthOfYear(MonthOfYear::Jul), 1, 2011)), DateTime(Date(MonthOfYear(MonthOfYear::Aug), 1, 2011)));
+  ASSERT_EQ(31u * 24 * 60 + 1, july.size());
+  EXPECT_DOUBLE_EQ(181 * 24 * 60, july[0]);
+  EXPECT_DOUBLE_EQ(212 * 24 * 60, july[july.size() - 1]);
+
+  // same slice from a detailed series
+  std::vector<long> secondsFromFirstReport = minutely.secondsFromFirstReport();
+  ASSERT_EQ(numValues, secondsFromFirstReport.size());
+  secondsFromFirstReport[0] = 60;
+  for (unsigned i = 1; i < numValues; ++i) {
+    secondsFromFirstReport[i] = secondsFromFirstReport[i - 1] + 60;
+  }
+  TimeSeries detailed(firstReportDateTime, secondsFromFirstReport, values, "W");
+  EXPECT_FALSE(detailed.intervalLength());
+  EXPECT_TRUE(july == detailed.values(DateTime(Date(MonthOfYear(MonthOfYear::Jul), 1, 2011)), DateTime(Date(MonthOfYear(MonthOfYear::Aug), 1, 2011))));
+  EXPECT_DOUBLE_EQ(minutely.integrate(), detailed.integrate());
+  EXPECT_DOUBLE_EQ(minutely.averageValue(), detailed.averageValue());
+}
+
 TEST_F(DataFixture, TimeSeries_Yearly)
 {
   std::string units = "W";
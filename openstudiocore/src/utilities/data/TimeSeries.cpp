@@ -30,6 +30,8 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+
 
 using namespace std;
 using namespace boost;
@@ -38,11 +40,11 @@ namespace openstudio{
 
 namespace detail{
 
-TimeSeries_Impl::TimeSeries_Impl() :m_outOfRangeValue(0.0)
+TimeSeries_Impl::TimeSeries_Impl() :m_firstIntervalSeconds(0), m_outOfRangeValue(0.0)
 {}
 
 TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLength, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_firstIntervalSeconds(intervalLength.totalSeconds()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (values.empty()) {
     LOG(Warn, "Creating empty timeseries");
@@ -57,15 +59,10 @@ TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLeng
 
   m_startDateTime = DateTime(startDate, Time(0));
 
-  for (unsigned i = 0; i < values.size(); ++i) {
-    m_secondsFromFirstReport[i] = i*secondsPerInterval;
-    m_secondsFromStart[i] = (i + 1)*secondsPerInterval;
-  }
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
+  // reporting times are computed from the interval length rather than stored
   long durationSeconds = 0;
-  if (!m_secondsFromFirstReport.empty()) {
-    durationSeconds = m_secondsFromFirstReport.back();
+  if (!values.empty()) {
+    durationSeconds = (values.size() - 1) * secondsPerInterval;
   }
 
   // check for wrap around
@@ -80,7 +77,7 @@ TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLeng
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_firstIntervalSeconds(intervalLength.totalSeconds()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (values.empty()) {
     LOG(Warn, "Creating empty timeseries");
@@ -94,15 +91,10 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time
 
   m_startDateTime = m_firstReportDateTime - intervalLength;
 
-  for (unsigned i = 0; i < values.size(); ++i) {
-    m_secondsFromFirstReport[i] = i*secondsPerInterval;
-    m_secondsFromStart[i] = (i + 1)*secondsPerInterval;
-  }
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
+  // reporting times are computed from the interval length rather than stored
   long durationSeconds = 0;
-  if (!m_secondsFromFirstReport.empty()) {
-    durationSeconds = m_secondsFromFirstReport.back();
+  if (!values.empty()) {
+    durationSeconds = (values.size() - 1) * secondsPerInterval;
   }
 
   // check for wrap around
@@ -117,7 +109,7 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(values.size()), m_firstIntervalSeconds(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (timeInDays.size() != values.size()) {
     LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
@@ -141,10 +133,10 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vect
       }
       LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
       m_startDateTime = DateTime(m_firstReportDateTime.date());
+      m_firstIntervalSeconds = firstIntervalSeconds;
 
       for (unsigned i = 0; i < values.size(); ++i) {
         m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
         if (i > 0) {
           if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
             LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -153,9 +145,9 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vect
       }
     } else { // This is the new way
       m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+      m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
       for (unsigned i = 0; i < values.size(); ++i) {
-        m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+        m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
         if (i > 0) {
           if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
             LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -164,8 +156,6 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vect
       }
     }
 
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
     long durationSeconds = 0;
     if (!m_secondsFromFirstReport.empty()) {
       durationSeconds = m_secondsFromFirstReport.back();
@@ -184,7 +174,7 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vect
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays, const std::vector<double>& values, const std::string& units)
-  : m_secondsFromFirstReport(timeInDays.size()), m_secondsFromStart(values.size()), m_values(values.size()), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(timeInDays.size()), m_firstIntervalSeconds(0), m_values(values.size()), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
 
   if (timeInDays.size() != values.size()) {
@@ -209,10 +199,10 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
       }
       LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
       m_startDateTime = DateTime(m_firstReportDateTime.date());
+      m_firstIntervalSeconds = firstIntervalSeconds;
 
       for (unsigned i = 0; i < values.size(); ++i) {
         m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
         if (i > 0) {
           if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
             LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -221,9 +211,9 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
       }
     } else { // This is the new way
       m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+      m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
       for (unsigned i = 0; i < values.size(); ++i) {
-        m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+        m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
         if (i > 0) {
           if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
             LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -232,8 +222,6 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
       }
     }
 
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
     long durationSeconds = 0;
     if (!m_secondsFromFirstReport.empty()) {
       durationSeconds = m_secondsFromFirstReport.back();
@@ -252,7 +240,7 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(values.size()), m_firstIntervalSeconds(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   // DLM: this seems to be a pretty fragile constructor with a lot going on
 
@@ -291,7 +279,6 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector
     // Compute the seconds from first report
     if (m_wrapAround) {
       m_secondsFromFirstReport[0] = 0;
-      m_secondsFromStart[0] = 0;
       int delta = 0;
       DateTime firstReportDateTimeWithYear = DateTime(Date(m_firstReportDateTime.date().monthOfYear(),
         m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()), m_firstReportDateTime.time());
@@ -304,19 +291,16 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector
             m_firstReportDateTime.date().year() + delta), dateTimes[i].time());
         }
         m_secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
-        m_secondsFromStart[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
       }
     } else {
       m_secondsFromFirstReport[0] = 0;
-      m_secondsFromStart[0] = 0;
       for (unsigned i = 1; i < dateTimes.size(); i++) {
         m_secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
-        m_secondsFromStart[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
       }
     }
 
     for (unsigned i = 1; i < dateTimes.size(); i++) {
-      if (m_secondsFromStart[i] < m_secondsFromStart[i - 1]) {
+      if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
         LOG_AND_THROW("Dates from first report must be monotonically increasing");
       }
     }
@@ -325,12 +309,12 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector
     if (!extraTime) {
       int delta;
       bool foundInterval = false;
-      if (m_secondsFromStart.size() > 1) {
+      if (m_secondsFromFirstReport.size() > 1) {
         // check if all data is reported at a constant interval
-        delta = m_secondsFromStart[1] - m_secondsFromStart[0];
+        delta = m_secondsFromFirstReport[1] - m_secondsFromFirstReport[0];
         foundInterval = true;
-        for (unsigned i = 2; i < m_secondsFromStart.size(); i++) {
-          if (delta != m_secondsFromStart[i] - m_secondsFromStart[i - 1])
+        for (unsigned i = 2; i < m_secondsFromFirstReport.size(); i++) {
+          if (delta != m_secondsFromFirstReport[i] - m_secondsFromFirstReport[i - 1])
             foundInterval = false;
           break;
         }
@@ -349,20 +333,12 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector
       }
     }
 
-    int firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
-
-    // Compute the seconds from start
-    m_secondsFromStart[0] = firstIntervalSeconds;
-    for (unsigned i = 1; i < dateTimes.size(); i++) {
-      m_secondsFromStart[i] = m_secondsFromStart[i] + firstIntervalSeconds;
-    }
-
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
+    m_firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
   }
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(values.size()), m_firstIntervalSeconds(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (timeInSeconds.size() != values.size()) {
     LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInSeconds.size() << ")");
@@ -386,17 +362,13 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
       LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
       m_startDateTime = DateTime(firstReportDateTime.date());
       m_firstReportDateTime = firstReportDateTime;
-      int firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
-      m_secondsFromStart = timeInSeconds;
-      for (unsigned i = 0; i < m_secondsFromStart.size(); i++) {
-        m_secondsFromStart[i] += firstIntervalSeconds;
-      }
+      m_firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
       m_secondsFromFirstReport = timeInSeconds;
 
     } else { // This is the new behavior
       m_startDateTime = firstReportDateTime - Time(0, 0, 0, timeInSeconds[0]);
       m_firstReportDateTime = firstReportDateTime;
-      m_secondsFromStart = timeInSeconds;
+      m_firstIntervalSeconds = timeInSeconds[0];
 
       // Get rid of this later
       m_secondsFromFirstReport[0] = 0;
@@ -406,8 +378,6 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
     }
   }
 
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
   long durationSeconds = 0;
   if (!m_secondsFromFirstReport.empty()) {
     durationSeconds = m_secondsFromFirstReport.back();
@@ -432,19 +402,28 @@ OptionalTime TimeSeries_Impl::intervalLength() const
 
 DateTimeVector TimeSeries_Impl::dateTimes() const
 {
-  DateTimeVector dateTimeObjs(m_secondsFromFirstReport.size());
-  for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-    dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, m_secondsFromFirstReport[i]);
+  DateTimeVector dateTimeObjs(m_values.size());
+  for (unsigned i = 0; i < m_values.size(); i++) {
+    dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, reportSeconds(i));
   }
   return dateTimeObjs;
 }
 
+/// date and time of the report at index i
+DateTime TimeSeries_Impl::dateTimes(const unsigned& i) const
+{
+  if (i < m_values.size()) {
+    return m_firstReportDateTime + openstudio::Time(0, 0, 0, reportSeconds(i));
+  }
+  return DateTime();
+}
+
 /// time in days from end of the first reporting interval
 Vector TimeSeries_Impl::daysFromFirstReport() const
 {
-  Vector daysFromFirstReport(m_secondsFromFirstReport.size());
-  for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-    daysFromFirstReport[i] = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+  Vector daysFromFirstReport(m_values.size());
+  for (unsigned i = 0; i < m_values.size(); i++) {
+    daysFromFirstReport[i] = Time(0, 0, 0, reportSeconds(i)).totalDays();
   }
   return daysFromFirstReport;
 }
@@ -453,8 +432,8 @@ Vector TimeSeries_Impl::daysFromFirstReport() const
 double TimeSeries_Impl::daysFromFirstReport(const unsigned& i) const
 {
   double value = m_outOfRangeValue;
-  if (i < m_secondsFromFirstReport.size()) {
-    value = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+  if (i < m_values.size()) {
+    value = Time(0, 0, 0, reportSeconds(i)).totalDays();
   }
   return value;
 }
@@ -462,6 +441,13 @@ double TimeSeries_Impl::daysFromFirstReport(const unsigned& i) const
 /// time in seconds from end of the first reporting interval
 std::vector<long> TimeSeries_Impl::secondsFromFirstReport() const
 {
+  if (m_intervalLength) {
+    std::vector<long> result(m_values.size());
+    for (unsigned i = 0; i < m_values.size(); i++) {
+      result[i] = reportSeconds(i);
+    }
+    return result;
+  }
   return m_secondsFromFirstReport;
 }
 
@@ -470,8 +456,8 @@ long TimeSeries_Impl::secondsFromFirstReport(const unsigned& i) const
 {
   //double value = m_outOfRangeValue; // JWD: Shouldn't the out of range value be for values only?
   long value = 0;
-  if (i < m_secondsFromFirstReport.size()) {
-    value = m_secondsFromFirstReport[i];
+  if (i < m_values.size()) {
+    value = reportSeconds(i);
   }
   return value;
 }
@@ -509,12 +495,12 @@ double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstRepor
 {
   double result = m_outOfRangeValue;
 
-  if (m_secondsFromFirstReport.empty()) {
+  if (m_values.empty()) {
     LOG(Debug, "Cannot compute value because timeseries is empty");
     return result;
   }
 
-  long duration = m_secondsFromFirstReport.back();
+  long duration = reportSeconds(m_values.size() - 1);
 
   if (m_intervalLength) {
 
@@ -556,8 +542,12 @@ double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstRepor
       // after end of time series
       LOG(Debug, "Cannot compute value " << secondsFromFirstReport << " seconds after first reporting time when duration is " << duration << " seconds");
     } else {
-      // normal interpolation
-      result = interp(m_secondsFromFirstReportAsVector, m_values, secondsFromFirstReport, HoldNextInterp, NoneExtrap);
+      // hold the value of the next report, the last one if several share the final reporting time
+      size_t index = countReportsBefore(secondsFromFirstReport, false);
+      if ((secondsFromFirstReport == duration) && (secondsFromFirstReport != reportSeconds(0))) {
+        index = m_values.size() - 1;
+      }
+      result = m_values(index);
     }
   }
 
@@ -659,20 +649,14 @@ Vector TimeSeries_Impl::values(const DateTime& startDateTime, const DateTime& en
   double startSecondsFromFirstReport = (startDateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
   double endSecondsFromFirstReport = (endDateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
 
-  unsigned numValues = m_values.size();
-  OS_ASSERT(numValues == m_secondsFromFirstReport.size());
+  // reporting times are sorted, so the selected values are one contiguous range
+  size_t begin = countReportsBefore(startSecondsFromFirstReport, false);
+  size_t end = countReportsBefore(endSecondsFromFirstReport, true);
+  unsigned resultSize = (end > begin) ? (end - begin) : 0;
 
-  Vector result(numValues);
-  unsigned resultSize = 0;
-  for (unsigned i = 0; i < numValues; ++i) {
-    if ((m_secondsFromFirstReport[i] >= startSecondsFromFirstReport) &&
-      (m_secondsFromFirstReport[i] <= endSecondsFromFirstReport)) {
-      result[resultSize] = m_values[i];
-      ++resultSize;
-    }
-  }
+  Vector result(resultSize);
+  std::copy(m_values.begin() + begin, m_values.begin() + begin + resultSize, result.begin());
 
-  result.resize(resultSize, true);
   // Warn if empty
   if (resultSize == 0) {
     LOG(Warn, "The combination of start and end DateTimes you passed resulted in zero values");
@@ -701,6 +685,17 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Imp
   // if same units
   if (m_units == other.units()) {
 
+    // same reporting times, operate on the value vectors directly
+    if (hasSameReportingTimes(other)) {
+      return fromReportingTimes(m_firstReportDateTime + Time(0, 0, 0, 0), secondsFromFirstReport(), m_values + other.m_values, m_units);
+    }
+
+    // otherwise merge both reporting times in one pass, unless the dates need wrap around handling
+    std::shared_ptr<TimeSeries_Impl> combined = combine(other, false);
+    if (combined) {
+      return combined;
+    }
+
     // make unique, ordered set of all date times
     std::set<DateTime> dateTimesSet;
     DateTimeVector dateTimes1 = dateTimes();
@@ -740,6 +735,17 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Imp
   // if same units
   if (m_units == other.units()) {
 
+    // same reporting times, operate on the value vectors directly
+    if (hasSameReportingTimes(other)) {
+      return fromReportingTimes(m_firstReportDateTime + Time(0, 0, 0, 0), secondsFromFirstReport(), m_values - other.m_values, m_units);
+    }
+
+    // otherwise merge both reporting times in one pass, unless the dates need wrap around handling
+    std::shared_ptr<TimeSeries_Impl> combined = combine(other, true);
+    if (combined) {
+      return combined;
+    }
+
     // make unique, ordered set of all date times
     std::set<DateTime> dateTimesSet;
     DateTimeVector dateTimes1 = dateTimes();
@@ -771,6 +777,140 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Imp
   return result;
 }
 
+long TimeSeries_Impl::reportSeconds(size_t i) const
+{
+  if (m_intervalLength) {
+    return i * m_firstIntervalSeconds;
+  }
+  return m_secondsFromFirstReport[i];
+}
+
+size_t TimeSeries_Impl::countReportsBefore(double secondsFromFirstReport, bool inclusive) const
+{
+  // binary search on the sorted reporting times
+  size_t lower = 0;
+  size_t upper = m_values.size();
+  while (lower < upper) {
+    size_t middle = lower + (upper - lower) / 2;
+    long t = reportSeconds(middle);
+    if ((t < secondsFromFirstReport) || (inclusive && (t == secondsFromFirstReport))) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  return lower;
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::fromReportingTimes(const DateTime& firstReportDateTime, const std::vector<long>& secondsFromFirstReport,
+                                                                     const Vector& values, const std::string& units)
+{
+  std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
+  result->m_firstReportDateTime = firstReportDateTime;
+  result->m_secondsFromFirstReport = secondsFromFirstReport;
+  result->m_values = values;
+  result->m_units = units;
+  result->m_wrapAround = false;
+
+  // the DateTimeVector constructor only compares the first two intervals when looking for a constant interval
+  size_t n = secondsFromFirstReport.size();
+  if ((n > 1) && ((n == 2) || (secondsFromFirstReport[2] - secondsFromFirstReport[1] == secondsFromFirstReport[1]))) {
+    result->m_startDateTime = firstReportDateTime - Time(0, 0, 0, secondsFromFirstReport[1]);
+  } else {
+    if (firstReportDateTime.time().totalSeconds() == 0) {
+      LOG_AND_THROW("Cannot calculate the series start date for first report at the beginning of a day");
+    }
+    LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
+    result->m_startDateTime = DateTime(firstReportDateTime.date());
+  }
+
+  result->m_firstIntervalSeconds = (firstReportDateTime - result->m_startDateTime).totalSeconds();
+
+  return result;
+}
+
+bool TimeSeries_Impl::hasSameReportingTimes(const TimeSeries_Impl& other) const
+{
+  if (m_values.empty() || m_wrapAround || other.m_wrapAround) {
+    return false;
+  }
+
+  if ((m_firstReportDateTime != other.m_firstReportDateTime) ||
+      (m_firstReportDateTime.utcOffset() != other.m_firstReportDateTime.utcOffset()) ||
+      (m_firstReportDateTime.date().baseYear().is_initialized() != other.m_firstReportDateTime.date().baseYear().is_initialized())) {
+    return false;
+  }
+
+  if (m_values.size() != other.m_values.size()) {
+    return false;
+  }
+
+  // repeated times collapse into one reporting time when combined
+  for (size_t i = 0; i < m_values.size(); ++i) {
+    long t = reportSeconds(i);
+    if ((t != other.reportSeconds(i)) || ((i > 0) && (t <= reportSeconds(i - 1)))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::combine(const TimeSeries_Impl& other, bool subtract) const
+{
+  std::shared_ptr<TimeSeries_Impl> result;
+
+  // value(const DateTime&) treats wrap around dates and mixed calendar years specially, leave those to it
+  if (m_values.empty() || other.m_values.empty() || m_wrapAround || other.m_wrapAround) {
+    return result;
+  }
+  if ((m_firstReportDateTime.utcOffset() != other.m_firstReportDateTime.utcOffset()) ||
+      (m_firstReportDateTime.date().baseYear().is_initialized() != other.m_firstReportDateTime.date().baseYear().is_initialized())) {
+    return result;
+  }
+
+  // reporting times of other in seconds from the first report of this series
+  long offset = (other.m_firstReportDateTime - m_firstReportDateTime).totalSeconds();
+
+  // merge both sorted reporting times, dropping duplicates
+  size_t n1 = m_values.size();
+  size_t n2 = other.m_values.size();
+  std::vector<long> seconds;
+  seconds.reserve(n1 + n2);
+  size_t i = 0;
+  size_t j = 0;
+  while ((i < n1) || (j < n2)) {
+    long t;
+    if ((j == n2) || ((i < n1) && (reportSeconds(i) <= other.reportSeconds(j) + offset))) {
+      t = reportSeconds(i++);
+    } else {
+      t = other.reportSeconds(j++) + offset;
+    }
+    if (seconds.empty() || (t != seconds.back())) {
+      seconds.push_back(t);
+    }
+  }
+
+  Vector values(seconds.size());
+  for (size_t k = 0; k < seconds.size(); ++k) {
+    double value1 = valueAtSecondsFromFirstReport(seconds[k]);
+    double value2 = other.valueAtSecondsFromFirstReport(seconds[k] - offset);
+    values[k] = subtract ? value1 - value2 : value1 + value2;
+  }
+
+  // the earliest reporting time becomes the first report, this series wins ties
+  DateTime firstReportDateTime = m_firstReportDateTime + Time(0, 0, 0, 0);
+  long firstSeconds = seconds.front();
+  if (firstSeconds != 0) {
+    firstReportDateTime = other.m_firstReportDateTime + Time(0, 0, 0, 0);
+    for (long& t : seconds) {
+      t -= firstSeconds;
+    }
+  }
+
+  return fromReportingTimes(firstReportDateTime, seconds, values, m_units);
+}
+
 std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator*(double d) const {
   if (m_intervalLength) {
     return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime,
@@ -797,8 +937,9 @@ double TimeSeries_Impl::integrate() const
     double lastTime = 0;
     // Use a Riemann sum to integrate under the curve
     for (unsigned i = 0; i < m_values.size(); i++) {
-      result += (m_secondsFromStart[i] - lastTime) * m_values[i];
-      lastTime = m_secondsFromStart[i];
+      long secondsFromStart = m_firstIntervalSeconds + reportSeconds(i);
+      result += (secondsFromStart - lastTime) * m_values[i];
+      lastTime = secondsFromStart;
     }
   }
   return result;
@@ -806,12 +947,108 @@ double TimeSeries_Impl::integrate() const
 
 double TimeSeries_Impl::averageValue() const
 {
-  if (m_secondsFromStart.size() > 0) {
-    return integrate() / m_secondsFromStart.back();
+  if (m_values.size() > 0) {
+    return integrate() / (m_firstIntervalSeconds + reportSeconds(m_values.size() - 1));
   }
   return 0;
 }
 
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::aggregate(const AggregationPeriod& period, const AggregationMethod& method) const
+{
+  if (m_values.empty()) {
+    LOG(Warn, "Aggregating an empty timeseries returns an empty timeseries");
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  // periods are located in seconds from midnight of the first report date, calendar dates are only needed for month lengths
+  Date firstDate = m_firstReportDateTime.date();
+  long firstReportSeconds = m_firstReportDateTime.time().totalSeconds();
+  long periodSeconds = (period == AggregationPeriod::Hourly) ? 3600 : 86400;
+
+  std::vector<long> periodStarts;
+  std::vector<long> periodEnds;
+  std::vector<double> results;
+  std::vector<unsigned> counts;
+
+  for (unsigned i = 0; i < m_values.size(); ++i) {
+    // one second before the report so a value reported at the end of a period belongs to that period
+    long t = firstReportSeconds + reportSeconds(i) - 1;
+    double value = m_values[i];
+
+    if (periodEnds.empty() || (t >= periodEnds.back())) {
+      long index = t / periodSeconds;
+      if ((t % periodSeconds) < 0) {
+        --index;
+      }
+
+      long start = index * periodSeconds;
+      long end = start + periodSeconds;
+      if (period == AggregationPeriod::Monthly) {
+        Date date = firstDate + Time(index, 0, 0, 0);
+        long firstDayOfMonth = index - (date.dayOfMonth() - 1);
+        long daysInMonth = boost::gregorian::gregorian_calendar::end_of_month_day(date.year(), date.monthOfYear().value());
+        start = firstDayOfMonth * periodSeconds;
+        end = (firstDayOfMonth + daysInMonth) * periodSeconds;
+      }
+
+      periodStarts.push_back(start);
+      periodEnds.push_back(end);
+      results.push_back(value);
+      counts.push_back(1);
+    } else {
+      if (method == AggregationMethod::Peak) {
+        results.back() = std::max(results.back(), value);
+      } else {
+        results.back() += value;
+      }
+      ++counts.back();
+    }
+  }
+
+  if (method == AggregationMethod::Mean) {
+    for (size_t k = 0; k < results.size(); ++k) {
+      results[k] /= counts[k];
+    }
+  }
+
+  DateTime firstReportDateTime(firstDate, Time(0, 0, 0, periodEnds.front()), m_firstReportDateTime.utcOffset());
+
+  bool constantInterval = (period != AggregationPeriod::Monthly);
+  for (size_t k = 1; constantInterval && (k < periodEnds.size()); ++k) {
+    constantInterval = (periodEnds[k] - periodEnds[k - 1] == periodSeconds);
+  }
+
+  if (constantInterval) {
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(firstReportDateTime, Time(0, 0, 0, periodSeconds), createVector(results), m_units));
+  }
+
+  // report at the end of each period, the first period starts the series
+  std::vector<long> timeInSeconds(periodEnds.size());
+  for (size_t k = 0; k < periodEnds.size(); ++k) {
+    timeInSeconds[k] = periodEnds[k] - periodStarts.front();
+  }
+  return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(firstReportDateTime, timeInSeconds, createVector(results), m_units));
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::sumSameReportingTimes(const std::vector<std::shared_ptr<TimeSeries_Impl> >& others) const
+{
+  std::shared_ptr<TimeSeries_Impl> result;
+
+  for (const std::shared_ptr<TimeSeries_Impl>& other : others) {
+    if ((m_units != other->m_units) || !hasSameReportingTimes(*other)) {
+      return result;
+    }
+  }
+
+  // accumulate in one buffer, in the same order as repeated addition
+  Vector values(m_values);
+  for (const std::shared_ptr<TimeSeries_Impl>& other : others) {
+    values += other->m_values;
+  }
+
+  return fromReportingTimes(m_firstReportDateTime + Time(0, 0, 0, 0), secondsFromFirstReport(), values, m_units);
+}
+
 } // detail
 
 TimeSeries::TimeSeries() :
@@ -852,6 +1089,11 @@ openstudio::DateTimeVector TimeSeries::dateTimes() const
   return m_impl->dateTimes();
 }
 
+DateTime TimeSeries::dateTimes(const unsigned& i) const
+{
+  return m_impl->dateTimes(i);
+}
+
 openstudio::DateTime TimeSeries::firstReportDateTime() const
 {
   return m_impl->firstReportDateTime();
@@ -956,6 +1198,12 @@ double TimeSeries::averageValue() const
   return m_impl->averageValue();
 }
 
+TimeSeries TimeSeries::aggregate(const AggregationPeriod& period, const AggregationMethod& method) const
+{
+  std::shared_ptr<detail::TimeSeries_Impl> impl = m_impl->aggregate(period, method);
+  return TimeSeries(impl);
+}
+
 TimeSeries::TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl)
   : m_impl(impl)
 {}
@@ -967,6 +1215,18 @@ TimeSeries operator*(double d, const TimeSeries& series)
 
 TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector)
 {
+  if (timeSeriesVector.size() > 1) {
+    // series reporting at the same times are added in a single pass
+    std::vector<std::shared_ptr<detail::TimeSeries_Impl> > others;
+    for (auto it = timeSeriesVector.begin() + 1; it != timeSeriesVector.end(); ++it) {
+      others.push_back(it->m_impl);
+    }
+    std::shared_ptr<detail::TimeSeries_Impl> impl = timeSeriesVector.front().m_impl->sumSameReportingTimes(others);
+    if (impl) {
+      return TimeSeries(impl);
+    }
+  }
+
   TimeSeries result;
   bool first = true;
   for (const TimeSeries& ts : timeSeriesVector) {
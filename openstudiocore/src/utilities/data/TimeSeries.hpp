@@ -33,6 +33,7 @@
 #include "../UtilitiesAPI.hpp"
 
 #include "Vector.hpp"
+#include "DataEnums.hpp"
 #include "../time/Date.hpp"
 #include "../time/Time.hpp"
 #include "../time/DateTime.hpp"
@@ -72,6 +73,8 @@ public:
 
   DateTimeVector dateTimes() const;
 
+  openstudio::DateTime dateTimes(const unsigned& i) const;
+
   openstudio::Vector daysFromFirstReport() const;
 
   double daysFromFirstReport(const unsigned& i) const;
@@ -110,8 +113,30 @@ public:
 
   double averageValue() const;
 
+  std::shared_ptr<TimeSeries_Impl> aggregate(const AggregationPeriod& period, const AggregationMethod& method) const;
+
+  // returns a null pointer unless all series report at the same times as this one and are in the same units
+  std::shared_ptr<TimeSeries_Impl> sumSameReportingTimes(const std::vector<std::shared_ptr<TimeSeries_Impl> >& others) const;
+
 private:
 
+  // same result as the DateTimeVector constructor for firstReportDateTime + secondsFromFirstReport[i],
+  // secondsFromFirstReport must start at 0 and be strictly increasing
+  static std::shared_ptr<TimeSeries_Impl> fromReportingTimes(const DateTime& firstReportDateTime, const std::vector<long>& secondsFromFirstReport,
+                                                             const Vector& values, const std::string& units);
+
+  // true if other reports at exactly the same, strictly increasing, times as this series
+  bool hasSameReportingTimes(const TimeSeries_Impl& other) const;
+
+  // values at the union of both reporting times computed in one merge pass, null if this requires date arithmetic
+  std::shared_ptr<TimeSeries_Impl> combine(const TimeSeries_Impl& other, bool subtract) const;
+
+  // seconds from first report of the report at index i
+  long reportSeconds(size_t i) const;
+
+  // number of reports before secondsFromFirstReport, or at or before it if inclusive
+  size_t countReportsBefore(double secondsFromFirstReport, bool inclusive) const;
+
   REGISTER_LOGGER("utilities.TimeSeries_Impl");
   // fully qualified first report date
   DateTime m_firstReportDateTime;
@@ -119,10 +144,11 @@ private:
   // start date and time of time series
   DateTime m_startDateTime;
 
-  // integer seconds from first report date time, used for quick interpolation
+  // integer seconds from first report date time, not stored when the interval length is known
   std::vector<long> m_secondsFromFirstReport;
-  Vector m_secondsFromFirstReportAsVector; // same as m_secondsFromFirstReport but stored as Vector
-  std::vector<long> m_secondsFromStart;
+
+  // seconds from start to first report, seconds from start of each report are offset by this
+  long m_firstIntervalSeconds;
 
   // values reported at m_dateTimes
   Vector m_values;
@@ -227,6 +253,9 @@ public:
   /// Returns the date and times at which values are reported, these are the end of each reporting interval
   openstudio::DateTimeVector dateTimes() const;
 
+  /// Returns the date and time at index i to prevent implicit vector copy for single value
+  openstudio::DateTime dateTimes(const unsigned& i) const;
+
   /// Returns the date and time of first report value
   openstudio::DateTime firstReportDateTime() const;
 
@@ -299,9 +328,16 @@ public:
   /** Compute the time series average value */
   double averageValue() const;
 
+  /** Aggregate the values into hourly, daily, or calendar month periods.
+   *  Each value is assigned to the period containing the end of its reporting interval, so a value reported
+   *  at midnight belongs to the preceding day. The result reports at the end of each period containing data. */
+  TimeSeries aggregate(const AggregationPeriod& period, const AggregationMethod& method) const;
+
   //@}
 private:
 
+  friend UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
+
   REGISTER_LOGGER("utilities.TimeSeries");
   // constructor from impl
   TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl);
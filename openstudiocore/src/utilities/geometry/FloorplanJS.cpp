@@ -31,12 +31,17 @@
 #include "ThreeJS.hpp"
 #include "Vector3d.hpp"
 #include "Geometry.hpp"
+#include "PointHashGrid.hpp"
 #include "Intersection.hpp"
 
 #include "../core/Assert.hpp"
 //#include "../core/Path.hpp"
 #include "../core/Json.hpp"
 
+#include <QtConcurrent>
+
+#include <exception>
+
 
 
 namespace openstudio{
@@ -288,21 +293,10 @@ namespace openstudio{
     return result;
   }
 
-  size_t getVertexIndex(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001)
-  {
-    size_t n = allPoints.size();
-    for (size_t i = 0; i < n; ++i){
-      if (std::sqrt(std::pow(point3d.x()-allPoints[i].x(), 2) + std::pow(point3d.y()-allPoints[i].y(), 2) + std::pow(point3d.z()-allPoints[i].z(), 2)) < tol){
-        return i;
-      }
-    }
-    allPoints.push_back(point3d);
-    return (allPoints.size() - 1);
-  }
-
   std::string FloorplanJS::makeSurface(const Json::Value& story, const Json::Value& spaceOrShading, const std::string& parentSurfaceName, const std::string& parentSubSurfaceName,
     bool belowFloorPlenum, bool aboveCeilingPlenum, const std::string& surfaceType, const Point3dVectorVector& finalFaceVertices, size_t faceFormat,
-    std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, double illuminanceSetpoint, bool airWall) const
+    std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, double illuminanceSetpoint, bool airWall,
+    std::set<std::string>& plenumThermalZoneNames) const
   {
     std::string finalSurfaceType = surfaceType;
 
@@ -333,19 +327,19 @@ namespace openstudio{
     std::string geometryId = std::string("Geometry ") + std::to_string(geometries.size());
     std::string faceId = std::string("Face ") + std::to_string(geometries.size());
 
-    Point3dVector allVertices;
+    PointHashGrid allVertices;
     std::vector<size_t> faceIndices;
     for (const auto& finalFaceVerts : finalFaceVertices) {
       faceIndices.push_back(faceFormat);
       for (const auto& vert: finalFaceVerts){
-        faceIndices.push_back(getVertexIndex(vert, allVertices));
+        faceIndices.push_back(allVertices.pointIndex(vert));
       }
     }
 
     {
       std::string uuid = geometryId;
       std::string type = "Geometry";
-      ThreeGeometryData data(toThreeVector(allVertices), faceIndices);
+      ThreeGeometryData data(toThreeVector(allVertices.points()), faceIndices);
       ThreeGeometry geometry(uuid, type, data);
       geometries.push_back(geometry);
     }
@@ -427,7 +421,7 @@ namespace openstudio{
 
           if (plenum){
             // DLM: we do not have this plenum thermal zone in the floorplan so user can't edit its properties
-            m_plenumThermalZoneNames.insert(thermalZoneName);
+            plenumThermalZoneNames.insert(thermalZoneName);
 
             // reset to ThermalZone_Plenum in makeStandardThreeMaterials
             userData.setThermalZoneMaterialName(getObjectThreeMaterialName("OS:ThermalZone", "Plenum"));
@@ -500,7 +494,8 @@ namespace openstudio{
   void FloorplanJS::makeGeometries(const Json::Value& story, const Json::Value& spaceOrShading,
     bool belowFloorPlenum, bool aboveCeilingPlenum, double lengthToMeters, double minZ, double maxZ,
     const Json::Value& vertices, const Json::Value& edges, const Json::Value& faces, const std::string& faceId,
-    bool openstudioFormat, std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, bool openToBelow) const
+    bool openstudioFormat, std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, bool openToBelow,
+    BoundingBox& boundingBox, std::set<std::string>& plenumThermalZoneNames) const
   {
     std::vector<Point3d> faceVertices;
     std::vector<Point3d> windowCenterVertices;
@@ -686,15 +681,15 @@ namespace openstudio{
         Point3d ceilVert(v.x(), v.y(), maxZ);
         finalfloorVertices.push_back(floorVert);
         finalRoofCeilingVertices.push_back(ceilVert);
-        m_boundingBox.addPoint(floorVert);
-        m_boundingBox.addPoint(ceilVert);
+        boundingBox.addPoint(floorVert);
+        boundingBox.addPoint(ceilVert);
       }
       std::reverse(finalRoofCeilingVertices.begin(), finalRoofCeilingVertices.end());
       allFinalfloorVertices.push_back(finalfloorVertices);
       allFinalRoofCeilingVertices.push_back(finalRoofCeilingVertices);
     }
-    makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "Floor", allFinalfloorVertices, roofCeilingFaceFormat, geometries, sceneChildren, 0, openToBelow);
-    makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "RoofCeiling", allFinalRoofCeilingVertices, roofCeilingFaceFormat, geometries, sceneChildren, 0, false);
+    makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "Floor", allFinalfloorVertices, roofCeilingFaceFormat, geometries, sceneChildren, 0, openToBelow, plenumThermalZoneNames);
+    makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "RoofCeiling", allFinalRoofCeilingVertices, roofCeilingFaceFormat, geometries, sceneChildren, 0, false, plenumThermalZoneNames);
 
     // create each wall
     std::set<unsigned> mappedWindows;
@@ -953,14 +948,14 @@ namespace openstudio{
       }
 
       std::string parentSurfaceName;
-      parentSurfaceName = makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "Wall", allFinalWallVertices, finalWallFaceFormat, geometries, sceneChildren, 0, false);
+      parentSurfaceName = makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "Wall", allFinalWallVertices, finalWallFaceFormat, geometries, sceneChildren, 0, false, plenumThermalZoneNames);
 
       std::vector<std::string> parentSubSurfaceNames;
       size_t finalWindowN = allFinalWindowVertices.size();
       OS_ASSERT(finalWindowN == allFinalWindowTypes.size());
       for (size_t finalWindowIdx = 0; finalWindowIdx < finalWindowN; ++finalWindowIdx){
         const auto& finalWindowVertices = allFinalWindowVertices[finalWindowIdx];
-        std::string parentSubSurfaceName = makeSurface(story, spaceOrShading, parentSurfaceName, "", belowFloorPlenum, aboveCeilingPlenum, allFinalWindowTypes[finalWindowIdx], Point3dVectorVector(1,finalWindowVertices), wallFaceFormat, geometries, sceneChildren, 0, false);
+        std::string parentSubSurfaceName = makeSurface(story, spaceOrShading, parentSurfaceName, "", belowFloorPlenum, aboveCeilingPlenum, allFinalWindowTypes[finalWindowIdx], Point3dVectorVector(1,finalWindowVertices), wallFaceFormat, geometries, sceneChildren, 0, false, plenumThermalZoneNames);
         parentSubSurfaceNames.push_back(parentSubSurfaceName);
       }
 
@@ -968,7 +963,7 @@ namespace openstudio{
       OS_ASSERT(finalDoorN == allFinalDoorTypes.size());
       for (size_t finalDoorIdx = 0; finalDoorIdx < finalDoorN; ++finalDoorIdx){
         const auto& finalDoorVertices = allFinalDoorVertices[finalDoorIdx];
-        std::string parentSubSurfaceName = makeSurface(story, spaceOrShading, parentSurfaceName, "", belowFloorPlenum, aboveCeilingPlenum, allFinalDoorTypes[finalDoorIdx], Point3dVectorVector(1,finalDoorVertices), wallFaceFormat, geometries, sceneChildren, 0, false);
+        std::string parentSubSurfaceName = makeSurface(story, spaceOrShading, parentSurfaceName, "", belowFloorPlenum, aboveCeilingPlenum, allFinalDoorTypes[finalDoorIdx], Point3dVectorVector(1,finalDoorVertices), wallFaceFormat, geometries, sceneChildren, 0, false, plenumThermalZoneNames);
         parentSubSurfaceNames.push_back(parentSubSurfaceName);
       }
 
@@ -976,7 +971,7 @@ namespace openstudio{
       OS_ASSERT(shadeN == allFinalShadeParentSubSurfaceIndices.size());
       for (size_t shadeIdx = 0; shadeIdx < shadeN; ++shadeIdx){
         std::string parentSubSurfaceName = parentSubSurfaceNames[allFinalShadeParentSubSurfaceIndices[shadeIdx]];
-        makeSurface(story, spaceOrShading, "", parentSubSurfaceName, belowFloorPlenum, aboveCeilingPlenum, "SpaceShading", Point3dVectorVector(1,allFinalShadeVertices[shadeIdx]), wallFaceFormat, geometries, sceneChildren, 0, false);
+        makeSurface(story, spaceOrShading, "", parentSubSurfaceName, belowFloorPlenum, aboveCeilingPlenum, "SpaceShading", Point3dVectorVector(1,allFinalShadeVertices[shadeIdx]), wallFaceFormat, geometries, sceneChildren, 0, false, plenumThermalZoneNames);
       }
     }
 
@@ -1008,7 +1003,7 @@ namespace openstudio{
           dcVertices.push_back(Point3d(lengthToMeters * vertex->get("x", 0.0).asDouble() + 0.1, lengthToMeters * vertex->get("y", 0.0).asDouble() - 0.1, height));
           dcVertices.push_back(Point3d(lengthToMeters * vertex->get("x", 0.0).asDouble() - 0.1, lengthToMeters * vertex->get("y", 0.0).asDouble() - 0.1, height));
 
-          makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "DaylightingControl", Point3dVectorVector(1,dcVertices), wallFaceFormat, geometries, sceneChildren, illuminanceSetpoint, false);
+          makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "DaylightingControl", Point3dVectorVector(1,dcVertices), wallFaceFormat, geometries, sceneChildren, illuminanceSetpoint, false, plenumThermalZoneNames);
         }
       }
     }
@@ -1051,13 +1046,75 @@ namespace openstudio{
     return result;
   }
 
-  ThreeScene FloorplanJS::toThreeScene(bool openstudioFormat) const
+  struct FloorplanJS::StoryGeometries
   {
-    m_plenumThermalZoneNames.clear();
-    m_boundingBox = BoundingBox();
+    // arguments to makeGeometries for one space or shading
+    struct Job
+    {
+      std::string key;
+      Json::ArrayIndex index;
+      bool belowFloorPlenum;
+      bool aboveCeilingPlenum;
+      double minZ;
+      double maxZ;
+      std::string faceId;
+      bool openToBelow;
+    };
+
+    void addJob(const std::string& key, Json::ArrayIndex index, bool belowFloorPlenum, bool aboveCeilingPlenum, double minZ, double maxZ, const std::string& faceId, bool openToBelow)
+    {
+      Job job;
+      job.key = key;
+      job.index = index;
+      job.belowFloorPlenum = belowFloorPlenum;
+      job.aboveCeilingPlenum = aboveCeilingPlenum;
+      job.minZ = minZ;
+      job.maxZ = maxZ;
+      job.faceId = faceId;
+      job.openToBelow = openToBelow;
+      jobs.push_back(job);
+    }
+
+    const FloorplanJS* floorplan;
+    const Json::Value* story;
+    double lengthToMeters;
+    bool openstudioFormat;
+    std::vector<Job> jobs;
+
+    // results, geometry and face ids are numbered from zero for each story
+    std::vector<ThreeGeometry> geometries;
+    std::vector<ThreeSceneChild> children;
+    BoundingBox boundingBox;
+    std::set<std::string> plenumThermalZoneNames;
+    std::exception_ptr exception;
+  };
 
+  void FloorplanJS::makeStoryGeometries(StoryGeometries& storyGeometries)
+  {
+    // rethrown in the calling thread
+    try{
+      const Json::Value& story = *storyGeometries.story;
+      Json::Value geometry = story.get("geometry", Json::arrayValue);
+      Json::Value vertices = geometry.get("vertices", Json::arrayValue);
+      Json::Value edges = geometry.get("edges", Json::arrayValue);
+      Json::Value faces = geometry.get("faces", Json::arrayValue);
+
+      for (const auto& job : storyGeometries.jobs){
+        const Json::Value& spaceOrShading = story[job.key][job.index];
+        storyGeometries.floorplan->makeGeometries(story, spaceOrShading, job.belowFloorPlenum, job.aboveCeilingPlenum, storyGeometries.lengthToMeters,
+          job.minZ, job.maxZ, vertices, edges, faces, job.faceId, storyGeometries.openstudioFormat,
+          storyGeometries.geometries, storyGeometries.children, job.openToBelow, storyGeometries.boundingBox, storyGeometries.plenumThermalZoneNames);
+      }
+    } catch (...){
+      storyGeometries.exception = std::current_exception();
+    }
+  }
+
+  ThreeScene FloorplanJS::toThreeScene(bool openstudioFormat) const
+  {
     std::vector<ThreeGeometry> geometries;
     std::vector<ThreeSceneChild> children;
+    std::vector<StoryGeometries> allStoryGeometries;
     std::vector<std::string> buildingStoryNames;
     std::vector<ThreeModelObjectMetadata> modelObjectMetadata;
 
@@ -1164,12 +1221,14 @@ namespace openstudio{
       // DLM: TODO need to get the intersection and matching code in utilities, move stories after intersecting and matching
       //currentStoryZ += 0.5*(storyMultiplier - 1)*(storyBelowFloorPlenumHeight + storyFloorToCeilingHeight + storyAboveCeilingPlenumHeight);
 
-      // get the geometry
+      // get the geometry, geometry is made after all stories have been read
       assertKeyAndType(stories[storyIdx], "geometry", Json::objectValue);
-      Json::Value geometry = stories[storyIdx].get("geometry", Json::arrayValue);
-      Json::Value vertices = geometry.get("vertices", Json::arrayValue);
-      Json::Value edges = geometry.get("edges", Json::arrayValue);
-      Json::Value faces = geometry.get("faces", Json::arrayValue);
+      allStoryGeometries.push_back(StoryGeometries());
+      StoryGeometries& storyGeometries = allStoryGeometries.back();
+      storyGeometries.floorplan = this;
+      storyGeometries.story = &stories[storyIdx];
+      storyGeometries.lengthToMeters = lengthToMeters;
+      storyGeometries.openstudioFormat = openstudioFormat;
 
       // loop over spaces
       Json::Value spaces = stories[storyIdx].get("spaces", Json::arrayValue);
@@ -1229,7 +1288,7 @@ namespace openstudio{
             spaceMetadata.setMultiplier(spaceMultiplier);
             spaceMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(spaceMetadata);
-            makeGeometries(stories[storyIdx], spaces[spaceIdx], true, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            storyGeometries.addJob("spaces", spaceIdx, true, false, minZ, maxZ, faceId, openToBelow);
             openToBelow = false; // no longer open
           }
 
@@ -1240,7 +1299,7 @@ namespace openstudio{
             spaceMetadata.setMultiplier(spaceMultiplier);
             spaceMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(spaceMetadata);
-            makeGeometries(stories[storyIdx], spaces[spaceIdx], false, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            storyGeometries.addJob("spaces", spaceIdx, false, false, minZ, maxZ, faceId, openToBelow);
             openToBelow = false; // no longer open
           }
 
@@ -1252,7 +1311,7 @@ namespace openstudio{
             spaceMetadata.setMultiplier(spaceMultiplier);
             spaceMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(spaceMetadata);
-            makeGeometries(stories[storyIdx], spaces[spaceIdx], false, true, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            storyGeometries.addJob("spaces", spaceIdx, false, true, minZ, maxZ, faceId, openToBelow);
             openToBelow = false; // no longer open
           }
         }
@@ -1317,7 +1376,7 @@ namespace openstudio{
             shadingMetadata.setMultiplier(shadingMultiplier);
             shadingMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(shadingMetadata);
-            makeGeometries(stories[storyIdx], shading[shadingdx], true, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            storyGeometries.addJob("shading", shadingdx, true, false, minZ, maxZ, faceId, openToBelow);
             openToBelow = false; // no longer open
           }
 
@@ -1328,7 +1387,7 @@ namespace openstudio{
             shadingMetadata.setMultiplier(shadingMultiplier);
             shadingMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(shadingMetadata);
-            makeGeometries(stories[storyIdx], shading[shadingdx], false, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            storyGeometries.addJob("shading", shadingdx, false, false, minZ, maxZ, faceId, openToBelow);
             openToBelow = false; // no longer open
           }
 
@@ -1340,7 +1399,7 @@ namespace openstudio{
             shadingMetadata.setMultiplier(shadingMultiplier);
             shadingMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(shadingMetadata);
-            makeGeometries(stories[storyIdx], shading[shadingdx], false, true, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            storyGeometries.addJob("shading", shadingdx, false, true, minZ, maxZ, faceId, openToBelow);
             openToBelow = false; // no longer open
           }
         }
@@ -1354,6 +1413,60 @@ namespace openstudio{
 
     } // stories
 
+    // stories do not share geometry, make each story in parallel
+    if (allStoryGeometries.size() > 1){
+      QtConcurrent::blockingMap(allStoryGeometries, &FloorplanJS::makeStoryGeometries);
+    }else{
+      for (auto& storyGeometries : allStoryGeometries){
+        makeStoryGeometries(storyGeometries);
+      }
+    }
+
+    for (const auto& storyGeometries : allStoryGeometries){
+      if (storyGeometries.exception){
+        std::rethrow_exception(storyGeometries.exception);
+      }
+    }
+
+    // renumber geometry and face ids as if stories were made in order
+    std::set<std::string> plenumThermalZoneNames;
+    BoundingBox allBoundingBox;
+    for (const auto& storyGeometries : allStoryGeometries){
+      size_t offset = geometries.size();
+      size_t n = storyGeometries.geometries.size();
+      OS_ASSERT(n == storyGeometries.children.size());
+
+      std::map<std::string, std::string> faceIdMap;
+      for (size_t i = 0; i < n; ++i){
+        faceIdMap[storyGeometries.children[i].uuid()] = std::string("Face ") + std::to_string(offset + i);
+      }
+
+      for (size_t i = 0; i < n; ++i){
+        const ThreeGeometry& geometry = storyGeometries.geometries[i];
+        const ThreeSceneChild& child = storyGeometries.children[i];
+
+        std::string geometryId = std::string("Geometry ") + std::to_string(offset + i);
+        std::string faceId = faceIdMap[child.uuid()];
+
+        ThreeUserData userData = child.userData();
+        userData.setName(faceId);
+        auto it = faceIdMap.find(userData.surfaceName());
+        if (it != faceIdMap.end()){
+          userData.setSurfaceName(it->second);
+        }
+        it = faceIdMap.find(userData.subSurfaceName());
+        if (it != faceIdMap.end()){
+          userData.setSubSurfaceName(it->second);
+        }
+
+        geometries.push_back(ThreeGeometry(geometryId, geometry.type(), geometry.data()));
+        children.push_back(ThreeSceneChild(faceId, faceId, child.type(), geometryId, child.material(), userData));
+      }
+
+      plenumThermalZoneNames.insert(storyGeometries.plenumThermalZoneNames.begin(), storyGeometries.plenumThermalZoneNames.end());
+      allBoundingBox.add(storyGeometries.boundingBox);
+    }
+
     // loop over building_units
     Json::Value buildingUnits = m_value.get("building_units", Json::arrayValue);
     Json::ArrayIndex n = buildingUnits.size();
@@ -1371,7 +1484,7 @@ namespace openstudio{
     }
 
     // DLM: how will we merge this plenum zone with existing plenum zones?
-    for (const auto& thermalZoneName : m_plenumThermalZoneNames){
+    for (const auto& thermalZoneName : plenumThermalZoneNames){
       ThreeModelObjectMetadata thermalZoneMetadata("OS:ThermalZone", "", thermalZoneName);
       modelObjectMetadata.push_back(thermalZoneMetadata);
       thermalZoneMetadata.setColor(PLENUMCOLOR); // already made in makeStandardThreeMaterials
@@ -1398,22 +1511,22 @@ namespace openstudio{
       //makeMaterial(constructionSets[i], "OS:DefaultConstructionSet", materials, materialMap);
     }
 
-    m_boundingBox.addPoint(Point3d(0, 0, 0));
+    allBoundingBox.addPoint(Point3d(0, 0, 0));
 
     double lookAtX = 0; // (boundingBox.minX().get() + boundingBox.maxX().get()) / 2.0
     double lookAtY = 0; // (boundingBox.minY().get() + boundingBox.maxY().get()) / 2.0
     double lookAtZ = 0; // (boundingBox.minZ().get() + boundingBox.maxZ().get()) / 2.0
-    double lookAtR =            sqrt(std::pow(m_boundingBox.maxX().get() / 2.0, 2) + std::pow(m_boundingBox.maxY().get() / 2.0, 2) + std::pow(m_boundingBox.maxZ().get() / 2.0, 2));
-    lookAtR = std::max(lookAtR, sqrt(std::pow(m_boundingBox.minX().get() / 2.0, 2) + std::pow(m_boundingBox.maxY().get() / 2.0, 2) + std::pow(m_boundingBox.maxZ().get() / 2.0, 2)));
-    lookAtR = std::max(lookAtR, sqrt(std::pow(m_boundingBox.maxX().get() / 2.0, 2) + std::pow(m_boundingBox.minY().get() / 2.0, 2) + std::pow(m_boundingBox.maxZ().get() / 2.0, 2)));
-    lookAtR = std::max(lookAtR, sqrt(std::pow(m_boundingBox.maxX().get() / 2.0, 2) + std::pow(m_boundingBox.maxY().get() / 2.0, 2) + std::pow(m_boundingBox.minZ().get() / 2.0, 2)));
-    lookAtR = std::max(lookAtR, sqrt(std::pow(m_boundingBox.minX().get() / 2.0, 2) + std::pow(m_boundingBox.minY().get() / 2.0, 2) + std::pow(m_boundingBox.maxZ().get() / 2.0, 2)));
-    lookAtR = std::max(lookAtR, sqrt(std::pow(m_boundingBox.minX().get() / 2.0, 2) + std::pow(m_boundingBox.maxY().get() / 2.0, 2) + std::pow(m_boundingBox.minZ().get() / 2.0, 2)));
-    lookAtR = std::max(lookAtR, sqrt(std::pow(m_boundingBox.maxX().get() / 2.0, 2) + std::pow(m_boundingBox.minY().get() / 2.0, 2) + std::pow(m_boundingBox.minZ().get() / 2.0, 2)));
-    lookAtR = std::max(lookAtR, sqrt(std::pow(m_boundingBox.minX().get() / 2.0, 2) + std::pow(m_boundingBox.minY().get() / 2.0, 2) + std::pow(m_boundingBox.minZ().get() / 2.0, 2)));
-
-    ThreeBoundingBox boundingBox(m_boundingBox.minX().get(),m_boundingBox.minY().get(),m_boundingBox.minZ().get(),
-                                 m_boundingBox.maxX().get(),m_boundingBox.maxY().get(),m_boundingBox.maxZ().get(),
+    double lookAtR =            sqrt(std::pow(allBoundingBox.maxX().get() / 2.0, 2) + std::pow(allBoundingBox.maxY().get() / 2.0, 2) + std::pow(allBoundingBox.maxZ().get() / 2.0, 2));
+    lookAtR = std::max(lookAtR, sqrt(std::pow(allBoundingBox.minX().get() / 2.0, 2) + std::pow(allBoundingBox.maxY().get() / 2.0, 2) + std::pow(allBoundingBox.maxZ().get() / 2.0, 2)));
+    lookAtR = std::max(lookAtR, sqrt(std::pow(allBoundingBox.maxX().get() / 2.0, 2) + std::pow(allBoundingBox.minY().get() / 2.0, 2) + std::pow(allBoundingBox.maxZ().get() / 2.0, 2)));
+    lookAtR = std::max(lookAtR, sqrt(std::pow(allBoundingBox.maxX().get() / 2.0, 2) + std::pow(allBoundingBox.maxY().get() / 2.0, 2) + std::pow(allBoundingBox.minZ().get() / 2.0, 2)));
+    lookAtR = std::max(lookAtR, sqrt(std::pow(allBoundingBox.minX().get() / 2.0, 2) + std::pow(allBoundingBox.minY().get() / 2.0, 2) + std::pow(allBoundingBox.maxZ().get() / 2.0, 2)));
+    lookAtR = std::max(lookAtR, sqrt(std::pow(allBoundingBox.minX().get() / 2.0, 2) + std::pow(allBoundingBox.maxY().get() / 2.0, 2) + std::pow(allBoundingBox.minZ().get() / 2.0, 2)));
+    lookAtR = std::max(lookAtR, sqrt(std::pow(allBoundingBox.maxX().get() / 2.0, 2) + std::pow(allBoundingBox.minY().get() / 2.0, 2) + std::pow(allBoundingBox.minZ().get() / 2.0, 2)));
+    lookAtR = std::max(lookAtR, sqrt(std::pow(allBoundingBox.minX().get() / 2.0, 2) + std::pow(allBoundingBox.minY().get() / 2.0, 2) + std::pow(allBoundingBox.minZ().get() / 2.0, 2)));
+
+    ThreeBoundingBox boundingBox(allBoundingBox.minX().get(),allBoundingBox.minY().get(),allBoundingBox.minZ().get(),
+                                 allBoundingBox.maxX().get(),allBoundingBox.maxY().get(),allBoundingBox.maxZ().get(),
                                  lookAtX, lookAtY, lookAtZ, lookAtR);
 
     ThreeSceneMetadata metadata(buildingStoryNames, boundingBox, modelObjectMetadata);
@@ -177,13 +177,20 @@ namespace openstudio{
 
     ThreeModelObjectMetadata makeModelObjectMetadata(const std::string& iddObjectType, const Json::Value& object) const;
 
+    // geometry for one story, stories are independent so these can be made in parallel
+    struct StoryGeometries;
+
+    static void makeStoryGeometries(StoryGeometries& storyGeometries);
+
     void makeGeometries(const Json::Value& story, const Json::Value& spaceOrShading, bool belowFloorPlenum, bool aboveCeilingPlenum,
       double lengthToMeters, double minZ, double maxZ, const Json::Value& vertices, const Json::Value& edges, const Json::Value& faces, const std::string& faceId,
-      bool openstudioFormat, std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, bool openToBelow) const;
+      bool openstudioFormat, std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, bool openToBelow,
+      BoundingBox& boundingBox, std::set<std::string>& plenumThermalZoneNames) const;
 
     std::string makeSurface(const Json::Value& story, const Json::Value& spaceOrShading, const std::string& parentSurfaceName, const std::string& parentSubSurfaceName,
       bool belowFloorPlenum, bool aboveCeilingPlenum, const std::string& surfaceType, const Point3dVectorVector& finalFaceVertices, size_t faceFormat,
-      std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, double illuminanceSetpoint, bool airWall) const;
+      std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, double illuminanceSetpoint, bool airWall,
+      std::set<std::string>& plenumThermalZoneNames) const;
 
     void makeMaterial(const Json::Value& object, const std::string& iddObjectType, std::vector<ThreeMaterial>& materials, std::map<std::string, std::string>& materialMap) const;
 
@@ -213,8 +220,6 @@ namespace openstudio{
     Json::Value m_value;
 
     unsigned m_lastId;
-    mutable std::set<std::string> m_plenumThermalZoneNames;
-    mutable BoundingBox m_boundingBox;
   };
 
   /// convienence method, converts a FloorplanJS JSON string to a ThreeJS JSON string
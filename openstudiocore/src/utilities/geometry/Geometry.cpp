@@ -29,6 +29,7 @@
 
 #include "Geometry.hpp"
 #include "Intersection.hpp"
+#include "PointHashGrid.hpp"
 #include "Transformation.hpp"
 #include "Vector3d.hpp"
 
@@ -482,7 +483,7 @@ namespace openstudio{
       }
     }
 
-    std::vector<Point3d> allPoints;
+    PointHashGrid allPoints(tol);
 
     // PolyPartition does not support holes which intersect the polygon or share an edge
     // if any hole is not fully contained we will use boost to remove all the holes
@@ -522,7 +523,7 @@ namespace openstudio{
         return result;
       }
 
-      Point3d point = getCombinedPoint(vertices[n-i-1], allPoints, tol);
+      Point3d point = allPoints.combinedPoint(vertices[n-i-1]);
       outerPoly[i].x = point.x();
       outerPoly[i].y = point.y();
     }
@@ -550,7 +551,7 @@ namespace openstudio{
           return result;
         }
 
-        Point3d point = getCombinedPoint(holeVertices[i], allPoints, tol);
+        Point3d point = allPoints.combinedPoint(holeVertices[i]);
         innerPoly[i].x = point.x();
         innerPoly[i].y = point.y();
       }
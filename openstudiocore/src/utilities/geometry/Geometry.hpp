@@ -88,6 +88,7 @@ namespace openstudio{
 
   /// if point3d is within tol of any existing points then returns existing point
   /// otherwise adds point3d to allPoints and returns point3d
+  /// searches allPoints linearly, use PointHashGrid when merging many points
   UTILITIES_API Point3d getCombinedPoint(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001);
 
   /// compute triangulation of vertices, holes are removed in the triangulation
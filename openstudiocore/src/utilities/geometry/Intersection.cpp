@@ -30,6 +30,7 @@
 #include "Geometry.hpp"
 #include "Vector3d.hpp"
 #include "Intersection.hpp"
+#include "PolygonClipping.hpp"
 #include "../data/Matrix.hpp"
 #include "../core/Assert.hpp"
 #include "../core/Logger.hpp"
@@ -861,6 +862,12 @@ namespace openstudio{
 
   boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
   {
+    // most building surfaces are convex, try the dedicated kernel first
+    boost::optional<IntersectionResult> convexResult;
+    if (convexIntersect(polygon1, polygon2, tol, convexResult)){
+      return convexResult;
+    }
+
     std::vector<Point3d> resultPolygon1;
     std::vector<Point3d> resultPolygon2;
     std::vector< std::vector<Point3d> > newPolygons1;
@@ -1029,6 +1036,11 @@ namespace openstudio{
   {
     std::vector<std::vector<Point3d> > result;
 
+    if (convexSubtract(polygon, holes, tol, result)){
+      return result;
+    }
+    result.clear();
+
     // convert vertices to boost rings
     std::vector<Point3d> allPoints;
 
@@ -1047,6 +1059,7 @@ namespace openstudio{
         return result;
       }
 
+      newBoostPolygons.clear();
       for (const BoostPolygon& boostPolygon : boostPolygons){
         std::vector<BoostPolygon> diffResult;
         boost::geometry::difference(boostPolygon, *boostHole, diffResult);
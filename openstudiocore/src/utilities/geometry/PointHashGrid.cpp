@@ -0,0 +1,163 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "PointHashGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace openstudio{
+
+  namespace {
+
+    // number of points before the grid is built
+    const size_t linearSearchLimit = 32;
+
+    // keeps cell indices of very distant points in range, clamping preserves neighboring cells
+    const double maxCellIndex = 1.0e15;
+
+    long long cellIndex(double value, double tol)
+    {
+      double result = std::floor(value / tol);
+      result = std::max(-maxCellIndex, std::min(maxCellIndex, result));
+      return static_cast<long long>(result);
+    }
+
+    unsigned long long cellKey(long long i, long long j, long long k)
+    {
+      // collisions only add candidates, each candidate is checked against the tolerance
+      return (static_cast<unsigned long long>(i) * 73856093ULL) ^
+             (static_cast<unsigned long long>(j) * 19349663ULL) ^
+             (static_cast<unsigned long long>(k) * 83492791ULL);
+    }
+
+    bool isFinite(const Point3d& point3d)
+    {
+      return std::isfinite(point3d.x()) && std::isfinite(point3d.y()) && std::isfinite(point3d.z());
+    }
+
+  }
+
+  PointHashGrid::PointHashGrid(double tol)
+    : m_tol(tol)
+  {}
+
+  Point3d PointHashGrid::combinedPoint(const Point3d& point3d)
+  {
+    return m_points[pointIndex(point3d)];
+  }
+
+  size_t PointHashGrid::pointIndex(const Point3d& point3d)
+  {
+    // same as the linear search in getCombinedPoint, nothing can be merged
+    if ((m_tol <= 0) || !isFinite(point3d)){
+      m_points.push_back(point3d);
+      return (m_points.size() - 1);
+    }
+
+    // a linear search is faster until there are enough points
+    if (m_points.size() < linearSearchLimit){
+      size_t n = m_points.size();
+      for (size_t i = 0; i < n; ++i){
+        if (withinTolerance(point3d, m_points[i])){
+          return i;
+        }
+      }
+      m_points.push_back(point3d);
+      if (m_points.size() == linearSearchLimit){
+        for (size_t i = 0; i < linearSearchLimit; ++i){
+          addToCell(i);
+        }
+      }
+      return (m_points.size() - 1);
+    }
+
+    long long i = cellIndex(point3d.x(), m_tol);
+    long long j = cellIndex(point3d.y(), m_tol);
+    long long k = cellIndex(point3d.z(), m_tol);
+
+    // find the first point added within tolerance, points within tolerance are at most one cell away
+    size_t result = std::numeric_limits<size_t>::max();
+    for (long long di = -1; di <= 1; ++di){
+      for (long long dj = -1; dj <= 1; ++dj){
+        for (long long dk = -1; dk <= 1; ++dk){
+          auto it = m_cells.find(cellKey(i + di, j + dj, k + dk));
+          if (it == m_cells.end()){
+            continue;
+          }
+          for (size_t index : it->second){
+            if ((index < result) && withinTolerance(point3d, m_points[index])){
+              result = index;
+            }
+          }
+        }
+      }
+    }
+
+    if (result != std::numeric_limits<size_t>::max()){
+      return result;
+    }
+
+    m_points.push_back(point3d);
+    result = m_points.size() - 1;
+    addToCell(result);
+    return result;
+  }
+
+  bool PointHashGrid::withinTolerance(const Point3d& point3d, const Point3d& otherPoint) const
+  {
+    return (std::sqrt(std::pow(point3d.x()-otherPoint.x(), 2) + std::pow(point3d.y()-otherPoint.y(), 2) + std::pow(point3d.z()-otherPoint.z(), 2)) < m_tol);
+  }
+
+  void PointHashGrid::addToCell(size_t index)
+  {
+    const Point3d& point3d = m_points[index];
+    if (isFinite(point3d)){
+      m_cells[cellKey(cellIndex(point3d.x(), m_tol), cellIndex(point3d.y(), m_tol), cellIndex(point3d.z(), m_tol))].push_back(index);
+    }
+  }
+
+  const std::vector<Point3d>& PointHashGrid::points() const
+  {
+    return m_points;
+  }
+
+  double PointHashGrid::tolerance() const
+  {
+    return m_tol;
+  }
+
+  void PointHashGrid::clear()
+  {
+    m_points.clear();
+    m_cells.clear();
+  }
+
+} // openstudio
@@ -0,0 +1,80 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_POINTHASHGRID_HPP
+#define UTILITIES_GEOMETRY_POINTHASHGRID_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "Point3d.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace openstudio{
+
+  /** PointHashGrid merges points which are within tolerance of each other.  Points are bucketed
+   *  in a uniform grid with cell size equal to the tolerance so only neighboring cells are searched,
+   *  results are identical to repeated calls to getCombinedPoint on the same list of points.
+   */
+  class UTILITIES_API PointHashGrid{
+  public:
+
+    /// constructor with merge tolerance
+    explicit PointHashGrid(double tol = 0.001);
+
+    /// if point3d is within tol of any existing point then returns the first such point
+    /// otherwise adds point3d and returns point3d
+    Point3d combinedPoint(const Point3d& point3d);
+
+    /// if point3d is within tol of any existing point then returns the index of the first such point
+    /// otherwise adds point3d and returns its index
+    size_t pointIndex(const Point3d& point3d);
+
+    /// all unique points in the order they were added
+    const std::vector<Point3d>& points() const;
+
+    double tolerance() const;
+
+    void clear();
+
+  private:
+
+    bool withinTolerance(const Point3d& point3d, const Point3d& otherPoint) const;
+
+    void addToCell(size_t index);
+
+    std::vector<Point3d> m_points;
+    std::unordered_map<unsigned long long, std::vector<size_t> > m_cells;
+    double m_tol;
+  };
+
+} // openstudio
+
+#endif //UTILITIES_GEOMETRY_POINTHASHGRID_HPP
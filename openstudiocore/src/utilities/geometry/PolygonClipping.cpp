@@ -0,0 +1,548 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "PolygonClipping.hpp"
+#include "Intersection.hpp"
+#include "Geometry.hpp"
+#include "../core/Logger.hpp"
+
+#include <cmath>
+
+namespace openstudio{
+
+  // Private implementation functions
+
+  namespace {
+
+    typedef long long GridCoord;
+
+    struct GridPoint {
+      GridCoord x;
+      GridCoord y;
+    };
+
+    typedef std::vector<GridPoint> GridPolygon;
+
+    // grid spacing as a fraction of tol
+    const double gridFraction = 0.001;
+
+    // largest grid coordinate, keeps cross products of coordinate differences within 64 bits
+    const GridCoord maxGridCoord = 1000000000LL;
+
+    // distance in grid units within which a vertex is considered to be on an edge, covers snapping of intersection points
+    const double onEdgeTol = 2.0;
+
+    bool operator==(const GridPoint& a, const GridPoint& b)
+    {
+      return (a.x == b.x) && (a.y == b.y);
+    }
+
+    bool operator!=(const GridPoint& a, const GridPoint& b)
+    {
+      return !(a == b);
+    }
+
+    // positive if o, a, b turn counter-clockwise, exact
+    GridCoord cross(const GridPoint& o, const GridPoint& a, const GridPoint& b)
+    {
+      return (a.x - o.x)*(b.y - o.y) - (a.y - o.y)*(b.x - o.x);
+    }
+
+    GridCoord dot(const GridPoint& o, const GridPoint& a, const GridPoint& b)
+    {
+      return (a.x - o.x)*(b.x - o.x) + (a.y - o.y)*(b.y - o.y);
+    }
+
+    // twice the signed area
+    long double doubleArea(const GridPolygon& polygon)
+    {
+      long double result = 0;
+      size_t n = polygon.size();
+      for (size_t i = 0; i < n; ++i){
+        const GridPoint& a = polygon[i];
+        const GridPoint& b = polygon[(i + 1) % n];
+        result += static_cast<long double>(a.x)*b.y - static_cast<long double>(b.x)*a.y;
+      }
+      return result;
+    }
+
+    // removes repeated and collinear vertices in place, returns false if the polygon doubles back on itself
+    bool removeCollinear(GridPolygon& polygon)
+    {
+      bool changed = true;
+      while (changed && (polygon.size() >= 3)){
+        changed = false;
+        size_t n = polygon.size();
+        for (size_t i = 0; i < n; ++i){
+          const GridPoint& prev = polygon[(i + n - 1) % n];
+          const GridPoint& current = polygon[i];
+          const GridPoint& next = polygon[(i + 1) % n];
+          if ((current == prev) || (current == next)){
+            polygon.erase(polygon.begin() + i);
+            changed = true;
+            break;
+          }
+          if (cross(prev, current, next) == 0){
+            if ((current.x - prev.x)*(next.x - current.x) + (current.y - prev.y)*(next.y - current.y) < 0){
+              // spike
+              return false;
+            }
+            polygon.erase(polygon.begin() + i);
+            changed = true;
+            break;
+          }
+        }
+      }
+      return true;
+    }
+
+    // snaps vertices in clockwise order on the z = 0 plane to a counter-clockwise polygon on the grid
+    // returns false if the polygon is not strictly convex
+    bool gridPolygonFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double grid, double tol, GridPolygon& result)
+    {
+      result.clear();
+      if (vertices.size() < 3){
+        return false;
+      }
+
+      std::vector<Point3d> combined;
+      combined.reserve(vertices.size());
+      for (const Point3d& vertex : vertices){
+        if (std::abs(vertex.z()) > tol){
+          return false;
+        }
+        // same combination of close points as the general path
+        combined.push_back(getCombinedPoint(vertex, allPoints, tol));
+      }
+
+      result.reserve(vertices.size());
+      for (auto it = combined.rbegin(); it != combined.rend(); ++it){
+        double x = std::round(it->x() / grid);
+        double y = std::round(it->y() / grid);
+        if ((std::abs(x) > maxGridCoord) || (std::abs(y) > maxGridCoord)){
+          return false;
+        }
+        GridPoint point = {static_cast<GridCoord>(x), static_cast<GridCoord>(y)};
+        result.push_back(point);
+      }
+
+      if (!removeCollinear(result) || (result.size() < 3)){
+        return false;
+      }
+
+      // all turns to the left and a single winding
+      size_t n = result.size();
+      double totalTurn = 0;
+      for (size_t i = 0; i < n; ++i){
+        const GridPoint& prev = result[(i + n - 1) % n];
+        const GridPoint& current = result[i];
+        const GridPoint& next = result[(i + 1) % n];
+        GridCoord c = cross(prev, current, next);
+        if (c <= 0){
+          return false;
+        }
+        double d = static_cast<double>((current.x - prev.x)*(next.x - current.x) + (current.y - prev.y)*(next.y - current.y));
+        totalTurn += std::atan2(static_cast<double>(c), d);
+      }
+      const double twoPi = 2.0 * 3.14159265358979323846;
+      return std::abs(totalTurn - twoPi) < 1.0;
+    }
+
+    bool isConvex(const GridPolygon& polygon)
+    {
+      size_t n = polygon.size();
+      if (n < 3){
+        return false;
+      }
+      for (size_t i = 0; i < n; ++i){
+        if (cross(polygon[(i + n - 1) % n], polygon[i], polygon[(i + 1) % n]) < 0){
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // clip subject by each edge of the convex polygon clip (Sutherland-Hodgman), buffer is scratch space
+    void clipConvex(const GridPolygon& subject, const GridPolygon& clip, GridPolygon& result, GridPolygon& buffer)
+    {
+      result = subject;
+      size_t m = clip.size();
+      for (size_t j = 0; (j < m) && !result.empty(); ++j){
+        const GridPoint& c0 = clip[j];
+        const GridPoint& c1 = clip[(j + 1) % m];
+
+        buffer.swap(result);
+        result.clear();
+
+        size_t n = buffer.size();
+        for (size_t i = 0; i < n; ++i){
+          const GridPoint& prev = buffer[(i + n - 1) % n];
+          const GridPoint& current = buffer[i];
+          GridCoord sp = cross(c0, c1, prev);
+          GridCoord sc = cross(c0, c1, current);
+
+          if (((sp < 0) && (sc > 0)) || ((sp > 0) && (sc < 0))){
+            // edge crosses the clip line, snap the crossing to the grid
+            long double t = static_cast<long double>(sp) / (static_cast<long double>(sp) - static_cast<long double>(sc));
+            GridPoint crossing = {prev.x + static_cast<GridCoord>(std::llround(t*(current.x - prev.x))),
+                                  prev.y + static_cast<GridCoord>(std::llround(t*(current.y - prev.y)))};
+            if (result.empty() || (result.back() != crossing)){
+              result.push_back(crossing);
+            }
+          }
+          if (sc >= 0){
+            if (result.empty() || (result.back() != current)){
+              result.push_back(current);
+            }
+          }
+        }
+
+        if (!result.empty() && (result.front() == result.back())){
+          result.pop_back();
+        }
+      }
+
+      // touching polygons leave degenerate results
+      if (!removeCollinear(result) || (result.size() < 3)){
+        result.clear();
+      }
+    }
+
+    // position of a point on the boundary of a polygon, edge index and parameter along the edge in [0, 1)
+    struct BoundaryPosition {
+      size_t edge;
+      long double t;
+    };
+
+    bool isOnEdge(const GridPoint& a0, const GridPoint& a1, const GridPoint& p, long double& t)
+    {
+      long double length2 = static_cast<long double>(dot(a0, a1, a1));
+      long double c = static_cast<long double>(cross(a0, a1, p));
+      if (c*c > onEdgeTol*onEdgeTol*length2){
+        return false;
+      }
+      t = static_cast<long double>(dot(a0, a1, p)) / length2;
+      long double tTol = onEdgeTol / std::sqrt(length2);
+      if ((t < -tTol) || (t > 1.0 + tTol)){
+        return false;
+      }
+      // snap to the ends of the edge
+      if (t <= tTol){
+        t = 0.0;
+      }else if (t >= 1.0 - tTol){
+        t = 1.0;
+      }
+      return true;
+    }
+
+    // pieces of convex polygon minus its convex subset part, both counter-clockwise
+    // returns false if part touches the boundary of polygon at less than two points (result would have a hole or pinch)
+    bool convexDifference(const GridPolygon& polygon, const GridPolygon& part, std::vector<GridPolygon>& result)
+    {
+      result.clear();
+
+      if (part.empty()){
+        result.push_back(polygon);
+        return true;
+      }
+
+      size_t n = polygon.size();
+      size_t m = part.size();
+
+      // find the edges of polygon each vertex of part lies on
+      std::vector<int> firstEdge(m, -1);
+      std::vector<int> secondEdge(m, -1);
+      std::vector<BoundaryPosition> positions(m);
+      unsigned numOnBoundary = 0;
+      for (size_t i = 0; i < m; ++i){
+        for (size_t k = 0; k < n; ++k){
+          long double t;
+          if (isOnEdge(polygon[k], polygon[(k + 1) % n], part[i], t)){
+            if (firstEdge[i] < 0){
+              firstEdge[i] = static_cast<int>(k);
+              BoundaryPosition position = {k, t};
+              if (position.t >= 1.0){
+                position.edge = (k + 1) % n;
+                position.t = 0.0;
+              }
+              positions[i] = position;
+            }else{
+              secondEdge[i] = static_cast<int>(k);
+            }
+          }
+        }
+        if (firstEdge[i] >= 0){
+          ++numOnBoundary;
+        }
+      }
+
+      if (numOnBoundary < 2){
+        return false;
+      }
+
+      // edges of part which lie along the boundary of polygon
+      std::vector<bool> alongBoundary(m, false);
+      bool allAlongBoundary = true;
+      for (size_t i = 0; i < m; ++i){
+        size_t j = (i + 1) % m;
+        if (firstEdge[i] >= 0 && firstEdge[j] >= 0){
+          alongBoundary[i] = (firstEdge[i] == firstEdge[j]) || (firstEdge[i] == secondEdge[j]) ||
+                             ((secondEdge[i] >= 0) && ((secondEdge[i] == firstEdge[j]) || (secondEdge[i] == secondEdge[j])));
+        }
+        allAlongBoundary = allAlongBoundary && alongBoundary[i];
+      }
+
+      if (allAlongBoundary){
+        // part is the whole polygon
+        return true;
+      }
+
+      size_t start = 0;
+      while (firstEdge[start] < 0){
+        ++start;
+      }
+
+      // each run of part's edges inside polygon between two boundary vertices p and q bounds one piece,
+      // the piece follows polygon's boundary from p to q and then part's run back from q to p
+      GridPolygon interior;
+      size_t p = start;
+      for (size_t step = 0; step < m; ++step){
+        size_t i = (start + step) % m;
+        size_t j = (i + 1) % m;
+        if (alongBoundary[i]){
+          p = j;
+          interior.clear();
+          continue;
+        }
+        if (firstEdge[j] < 0){
+          interior.push_back(part[j]);
+          continue;
+        }
+
+        size_t q = j;
+        GridPolygon piece;
+        piece.reserve(n + interior.size() + 2);
+        piece.push_back(part[p]);
+
+        const BoundaryPosition& from = positions[p];
+        const BoundaryPosition& to = positions[q];
+        size_t numVertices = (to.edge + n - from.edge) % n;
+        if ((numVertices == 0) && (to.t <= from.t)){
+          numVertices = n;
+        }
+        for (size_t k = 1; k <= numVertices; ++k){
+          size_t vertex = (from.edge + k) % n;
+          if ((k == numVertices) && (to.t == 0.0)){
+            // q is this vertex
+            break;
+          }
+          piece.push_back(polygon[vertex]);
+        }
+
+        piece.push_back(part[q]);
+        piece.insert(piece.end(), interior.rbegin(), interior.rend());
+
+        if (removeCollinear(piece) && (piece.size() >= 3)){
+          result.push_back(piece);
+        }
+
+        p = q;
+        interior.clear();
+      }
+
+      return true;
+    }
+
+    // convert a counter-clockwise grid polygon back to clockwise vertices
+    std::vector<Point3d> verticesFromGridPolygon(const GridPolygon& polygon, std::vector<Point3d>& allPoints, double grid, double tol)
+    {
+      std::vector<Point3d> result;
+      result.reserve(polygon.size());
+
+      for (auto it = polygon.rbegin(); it != polygon.rend(); ++it){
+        Point3d point3d(grid * it->x, grid * it->y, 0.0);
+
+        // try to combine points within tolerance
+        Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+
+        // don't keep repeated vertices
+        if (!result.empty() && (result.back() == resultPoint)){
+          continue;
+        }
+        result.push_back(resultPoint);
+      }
+
+      if (result.empty()){
+        return result;
+      }
+
+      result = removeCollinearLegacy(result);
+
+      // don't keep repeated vertices
+      if (result.front() == result.back()){
+        result.pop_back();
+      }
+
+      if (result.size() < 3){
+        return std::vector<Point3d>();
+      }
+
+      return result;
+    }
+
+  }
+
+  // Public functions
+
+  bool convexIntersect(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol,
+                       boost::optional<IntersectionResult>& result)
+  {
+    result.reset();
+
+    double grid = gridFraction * tol;
+    if (!(grid > 0)){
+      return false;
+    }
+
+    std::vector<Point3d> allPoints;
+    GridPolygon gridPolygon1;
+    GridPolygon gridPolygon2;
+    if (!gridPolygonFromVertices(polygon1, allPoints, grid, tol, gridPolygon1)){
+      return false;
+    }
+    if (!gridPolygonFromVertices(polygon2, allPoints, grid, tol, gridPolygon2)){
+      return false;
+    }
+
+    GridPolygon intersection;
+    GridPolygon buffer;
+    clipConvex(gridPolygon1, gridPolygon2, intersection, buffer);
+
+    // area in grid units below which polygons are dropped
+    double minArea = (tol*tol) / (grid*grid);
+
+    if (intersection.empty()){
+      return true;
+    }
+
+    if (doubleArea(intersection) / 2.0 < minArea){
+      LOG_FREE(Info, "utilities.geometry.convexIntersect", "Intersection has very small area of " << grid*grid*doubleArea(intersection)/2.0 << " m^2");
+      return true;
+    }
+
+    std::vector<GridPolygon> differences1;
+    std::vector<GridPolygon> differences2;
+    if (!convexDifference(gridPolygon1, intersection, differences1) || !convexDifference(gridPolygon2, intersection, differences2)){
+      return false;
+    }
+
+    std::vector<Point3d> intersectionVertices = verticesFromGridPolygon(intersection, allPoints, grid, tol);
+    if (intersectionVertices.empty()){
+      LOG_FREE(Info, "utilities.geometry.convexIntersect", "Cannot compute vertices of intersection");
+      return true;
+    }
+
+    std::vector< std::vector<Point3d> > newPolygons1;
+    for (const GridPolygon& difference : differences1){
+      std::vector<Point3d> newPolygon1 = verticesFromGridPolygon(difference, allPoints, grid, tol);
+      if (newPolygon1.empty() || (doubleArea(difference) / 2.0 < minArea)){
+        LOG_FREE(Info, "utilities.geometry.convexIntersect", "Face difference has very small area, result will not include this polygon, " << newPolygon1);
+        continue;
+      }
+      newPolygons1.push_back(newPolygon1);
+    }
+
+    std::vector< std::vector<Point3d> > newPolygons2;
+    for (const GridPolygon& difference : differences2){
+      std::vector<Point3d> newPolygon2 = verticesFromGridPolygon(difference, allPoints, grid, tol);
+      if (newPolygon2.empty() || (doubleArea(difference) / 2.0 < minArea)){
+        LOG_FREE(Info, "utilities.geometry.convexIntersect", "Face difference has very small area, result will not include this polygon, " << newPolygon2);
+        continue;
+      }
+      newPolygons2.push_back(newPolygon2);
+    }
+
+    result = IntersectionResult(intersectionVertices, intersectionVertices, newPolygons1, newPolygons2);
+    return true;
+  }
+
+  bool convexSubtract(const std::vector<Point3d>& polygon, const std::vector<std::vector<Point3d> >& holes, double tol,
+                      std::vector<std::vector<Point3d> >& result)
+  {
+    result.clear();
+
+    double grid = gridFraction * tol;
+    if (!(grid > 0)){
+      return false;
+    }
+
+    std::vector<Point3d> allPoints;
+    GridPolygon gridPolygon;
+    if (!gridPolygonFromVertices(polygon, allPoints, grid, tol, gridPolygon)){
+      return false;
+    }
+
+    std::vector<GridPolygon> gridHoles(holes.size());
+    for (size_t i = 0; i < holes.size(); ++i){
+      if (!gridPolygonFromVertices(holes[i], allPoints, grid, tol, gridHoles[i])){
+        return false;
+      }
+    }
+
+    std::vector<GridPolygon> pieces(1, gridPolygon);
+    std::vector<GridPolygon> newPieces;
+    std::vector<GridPolygon> differences;
+    GridPolygon intersection;
+    GridPolygon buffer;
+    for (const GridPolygon& gridHole : gridHoles){
+      newPieces.clear();
+      for (const GridPolygon& piece : pieces){
+        if (!isConvex(piece)){
+          return false;
+        }
+        clipConvex(piece, gridHole, intersection, buffer);
+        if (!convexDifference(piece, intersection, differences)){
+          return false;
+        }
+        newPieces.insert(newPieces.end(), differences.begin(), differences.end());
+      }
+      pieces.swap(newPieces);
+    }
+
+    for (const GridPolygon& piece : pieces){
+      std::vector<Point3d> vertices = verticesFromGridPolygon(piece, allPoints, grid, tol);
+      if (!vertices.empty()){
+        result.push_back(vertices);
+      }
+    }
+
+    return true;
+  }
+
+} // openstudio
@@ -0,0 +1,62 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_POLYGONCLIPPING_HPP
+#define UTILITIES_GEOMETRY_POLYGONCLIPPING_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "Point3d.hpp"
+
+#include <vector>
+#include <boost/optional.hpp>
+
+namespace openstudio{
+
+  class IntersectionResult;
+
+  /** Boolean operations on small convex planar polygons, tried by intersect and subtract before the general
+   *  boost::geometry path. Vertices follow the same conventions as intersect, clockwise order on the z = 0 plane.
+   *  Coordinates are snapped to an integer grid much finer than tol so that orientation tests are exact, and
+   *  output vertices are merged with the input vertices within tol as in the general path.
+   *
+   *  Each function returns false if the polygons are not handled by the kernel (non-convex polygons, results
+   *  with inner loops), the caller should then use the general path. */
+
+  /// intersect two convex polygons, result is set to the same value intersect would return
+  UTILITIES_API bool convexIntersect(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol,
+                                     boost::optional<IntersectionResult>& result);
+
+  /// subtract convex holes from a convex polygon, result is set to the polygons subtract would return
+  UTILITIES_API bool convexSubtract(const std::vector<Point3d>& polygon, const std::vector<std::vector<Point3d> >& holes, double tol,
+                                    std::vector<std::vector<Point3d> >& result);
+
+} // openstudio
+
+#endif //UTILITIES_GEOMETRY_POLYGONCLIPPING_HPP
@@ -35,6 +35,9 @@
 
 #include <resources.hxx>
 
+#include <chrono>
+#include <set>
+
 using namespace openstudio;
 
 TEST_F(GeometryFixture, FloorplanJS)
@@ -77,3 +80,61 @@ TEST_F(GeometryFixture, FloorplanJS)
   }
 
 }
+
+TEST_F(GeometryFixture, FloorplanJS_FiftyStories)
+{
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/floorplan_school.json");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<FloorplanJS> floorplan = FloorplanJS::load(toString(p));
+  ASSERT_TRUE(floorplan);
+  size_t numGeometries = floorplan->toThreeScene(true).geometries().size();
+  EXPECT_LT(0u, numGeometries);
+
+  // stack copies of the stories into a 50 story building
+  Json::Value value;
+  Json::Reader reader;
+  ASSERT_TRUE(reader.parse(floorplan->toJSON(false), value));
+  Json::Value stories = value["stories"];
+  Json::Value allStories(Json::arrayValue);
+  for (unsigned i = 0; allStories.size() < 50; ++i){
+    for (Json::Value story : stories){
+      story["name"] = story["name"].asString() + " " + std::to_string(i);
+      story.removeMember("handle");
+      allStories.append(story);
+    }
+  }
+  value["stories"] = allStories;
+
+  floorplan = FloorplanJS::load(Json::FastWriter().write(value));
+  ASSERT_TRUE(floorplan);
+
+  auto start = std::chrono::steady_clock::now();
+  ThreeScene scene = floorplan->toThreeScene(true);
+  auto end = std::chrono::steady_clock::now();
+
+  LOG(Info, "Converted " << allStories.size() << " stories to " << scene.geometries().size() << " geometries in "
+      << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms");
+
+  // ids are numbered in story order regardless of which story finished first
+  std::vector<ThreeGeometry> geometries = scene.geometries();
+  std::vector<ThreeSceneChild> children = scene.object().children();
+  ASSERT_EQ(allStories.size() / stories.size() * numGeometries, geometries.size());
+  ASSERT_EQ(geometries.size(), children.size());
+
+  std::set<std::string> faceIds;
+  for (size_t i = 0; i < geometries.size(); ++i){
+    EXPECT_EQ("Geometry " + std::to_string(i), geometries[i].uuid());
+    EXPECT_EQ("Face " + std::to_string(i), children[i].uuid());
+    EXPECT_EQ(geometries[i].uuid(), children[i].geometry());
+    faceIds.insert(children[i].uuid());
+  }
+
+  // sub surfaces reference their parent surfaces on the same story
+  for (const auto& child : children){
+    std::string surfaceName = child.userData().surfaceName();
+    if (!surfaceName.empty()){
+      EXPECT_EQ(1u, faceIds.count(surfaceName));
+    }
+  }
+}
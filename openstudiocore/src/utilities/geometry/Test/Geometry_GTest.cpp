@@ -32,9 +32,13 @@
 
 #include "../Geometry.hpp"
 #include "../Point3d.hpp"
+#include "../PointHashGrid.hpp"
 #include "../PointLatLon.hpp"
 #include "../Vector3d.hpp"
 
+#include <chrono>
+#include <random>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -1090,4 +1094,76 @@ TEST_F(GeometryFixture, PointLatLon_Elevation)
   EXPECT_NEAR(-42.521429845143913, test.x(), 0.001);
   EXPECT_NEAR(0.0, test.y(), 0.001);
   EXPECT_NEAR(30.0, test.z(), 0.001);
-}
\ No newline at end of file
+}
+
+TEST_F(GeometryFixture, PointHashGrid)
+{
+  double tol = 0.001;
+
+  // clusters of points around a coarse grid so many points are merged
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<int> cellDistribution(0, 20);
+  std::uniform_real_distribution<double> offsetDistribution(-1.5*tol, 1.5*tol);
+  std::vector<Point3d> points;
+  for (unsigned i = 0; i < 5000; ++i){
+    points.push_back(Point3d(0.1*cellDistribution(generator) + offsetDistribution(generator),
+                             0.1*cellDistribution(generator) + offsetDistribution(generator),
+                             0.1*cellDistribution(generator) + offsetDistribution(generator)));
+  }
+
+  PointHashGrid grid(tol);
+  std::vector<Point3d> allPoints;
+  for (const Point3d& point : points){
+    size_t index = grid.pointIndex(point);
+    Point3d combined = getCombinedPoint(point, allPoints, tol);
+    ASSERT_EQ(allPoints.size(), grid.points().size());
+    EXPECT_EQ(combined, grid.points()[index]);
+  }
+  EXPECT_EQ(allPoints, grid.points());
+  EXPECT_EQ(grid.points()[0], grid.combinedPoint(points[0]));
+
+  // nothing is merged with zero tolerance
+  PointHashGrid zeroGrid(0.0);
+  EXPECT_EQ(0u, zeroGrid.pointIndex(points[0]));
+  EXPECT_EQ(1u, zeroGrid.pointIndex(points[0]));
+
+  grid.clear();
+  EXPECT_TRUE(grid.points().empty());
+  EXPECT_EQ(0u, grid.pointIndex(points[1]));
+}
+
+TEST_F(GeometryFixture, PointHashGrid_Benchmark)
+{
+  double tol = 0.001;
+
+  // vertices of a 50 x 50 grid of unit squares, each vertex is repeated by its neighboring squares
+  std::vector<Point3d> points;
+  for (unsigned i = 0; i < 50; ++i){
+    for (unsigned j = 0; j < 50; ++j){
+      points.push_back(Point3d(i, j, 0));
+      points.push_back(Point3d(i + 1, j, 0));
+      points.push_back(Point3d(i + 1, j + 1, 0));
+      points.push_back(Point3d(i, j + 1, 0));
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  PointHashGrid grid(tol);
+  for (const Point3d& point : points){
+    grid.pointIndex(point);
+  }
+  auto gridEnd = std::chrono::steady_clock::now();
+
+  std::vector<Point3d> allPoints;
+  for (const Point3d& point : points){
+    getCombinedPoint(point, allPoints, tol);
+  }
+  auto linearEnd = std::chrono::steady_clock::now();
+
+  EXPECT_EQ(51u*51u, grid.points().size());
+  EXPECT_EQ(allPoints.size(), grid.points().size());
+
+  LOG(Info, "Merged " << points.size() << " points with PointHashGrid in "
+      << std::chrono::duration_cast<std::chrono::milliseconds>(gridEnd - start).count() << " ms, getCombinedPoint took "
+      << std::chrono::duration_cast<std::chrono::milliseconds>(linearEnd - gridEnd).count() << " ms");
+}
@@ -29,6 +29,8 @@
 
 #include <gtest/gtest.h>
 #include "../Intersection.hpp"
+#include "../PolygonClipping.hpp"
+#include "../Vector3d.hpp"
 #include "GeometryFixture.hpp"
 
 #undef BOOST_UBLAS_TYPE_CHECK
@@ -38,6 +40,10 @@
 #include <boost/geometry/geometries/ring.hpp>
 #include <boost/geometry/multi/geometries/multi_polygon.hpp>
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
+#include <boost/math/constants/constants.hpp>
+
+#include <chrono>
+#include <random>
 
 typedef boost::geometry::model::d2::point_xy<double> BoostPoint;
 typedef boost::geometry::model::polygon<BoostPoint> BoostPolygon;
@@ -1870,4 +1876,268 @@ TEST_F(GeometryFixture, simplify7)
   EXPECT_NEAR(*area, *area4, tol*tol);
 }
 
+namespace {
+
+  // random convex polygon in the same vertex order as makeRectangleDown
+  std::vector<Point3d> makeRandomConvexDown(std::mt19937& generator)
+  {
+    std::uniform_int_distribution<int> numVertices(3, 8);
+    std::uniform_real_distribution<double> center(0.0, 10.0);
+    std::uniform_real_distribution<double> radius(1.0, 6.0);
+    std::uniform_real_distribution<double> angle(0.0, 2.0*boost::math::constants::pi<double>());
+
+    std::vector<double> angles;
+    int n = numVertices(generator);
+    for (int i = 0; i < n; ++i){
+      angles.push_back(angle(generator));
+    }
+    std::sort(angles.begin(), angles.end());
+
+    double x = center(generator);
+    double y = center(generator);
+    double r = radius(generator);
+    std::vector<Point3d> result;
+    for (auto it = angles.rbegin(); it != angles.rend(); ++it){
+      result.push_back(Point3d(x + r*cos(*it), y + r*sin(*it), 0.0));
+    }
+    return result;
+  }
+
+  // pairs of building-like rectangles on a 1 m grid and of random convex polygons
+  std::vector<std::pair<std::vector<Point3d>, std::vector<Point3d> > > makeConvexTestCases(unsigned n)
+  {
+    std::mt19937 generator(12345);
+    std::uniform_int_distribution<int> coordinate(0, 9);
+
+    std::vector<std::pair<std::vector<Point3d>, std::vector<Point3d> > > result;
+    for (unsigned i = 0; i < n; ++i){
+      if (i % 2 == 0){
+        int x1 = coordinate(generator);
+        int y1 = coordinate(generator);
+        int x2 = coordinate(generator);
+        int y2 = coordinate(generator);
+        std::vector<Point3d> rectangle1 = makeRectangleDown(x1, y1, 1 + coordinate(generator) % (10 - x1), 1 + coordinate(generator) % (10 - y1));
+        std::vector<Point3d> rectangle2 = makeRectangleDown(x2, y2, 1 + coordinate(generator) % (10 - x2), 1 + coordinate(generator) % (10 - y2));
+        result.push_back(std::make_pair(rectangle1, rectangle2));
+      }else{
+        std::vector<Point3d> polygon1 = makeRandomConvexDown(generator);
+        std::vector<Point3d> polygon2 = makeRandomConvexDown(generator);
+        result.push_back(std::make_pair(polygon1, polygon2));
+      }
+    }
+    return result;
+  }
+
+  BoostPolygon boostPolygonFromPoints(const std::vector<Point3d>& points)
+  {
+    BoostPolygon result;
+    for (const Point3d& point : points){
+      boost::geometry::append(result, boost::make_tuple(point.x(), point.y()));
+    }
+    boost::geometry::append(result, boost::make_tuple(points[0].x(), points[0].y()));
+    return result;
+  }
+
+  double totalBoostArea(const std::vector<BoostPolygon>& polygons)
+  {
+    double result = 0.0;
+    for (const BoostPolygon& polygon : polygons){
+      result += boost::geometry::area(polygon);
+    }
+    return result;
+  }
+
+  // outer rings of the boost pieces the general path keeps, those of at least tol^2 area
+  std::vector<std::vector<Point3d> > pointsFromBoostPolygons(const std::vector<BoostPolygon>& polygons, double tol)
+  {
+    std::vector<std::vector<Point3d> > result;
+    for (const BoostPolygon& polygon : polygons){
+      if (std::abs(boost::geometry::area(polygon)) < tol*tol){
+        continue;
+      }
+      std::vector<Point3d> points;
+      for (const BoostPoint& point : polygon.outer()){
+        points.push_back(Point3d(point.x(), point.y(), 0.0));
+      }
+      if (!points.empty()){
+        points.pop_back();
+      }
+      result.push_back(points);
+    }
+    return result;
+  }
+
+  double distanceToSegment(const Point3d& point, const Point3d& a, const Point3d& b)
+  {
+    Vector3d ab = b - a;
+    Vector3d ap = point - a;
+    double lengthSquared = ab.dot(ab);
+    double t = (lengthSquared > 0.0) ? std::max(0.0, std::min(1.0, ap.dot(ab) / lengthSquared)) : 0.0;
+    Vector3d offset = ap - t*ab;
+    return offset.length();
+  }
+
+  // every vertex of polygons1 lies on an edge of polygons2 within tol, extra collinear vertices are allowed
+  bool verticesOnBoundaries(const std::vector<std::vector<Point3d> >& polygons1, const std::vector<std::vector<Point3d> >& polygons2, double tol)
+  {
+    for (const std::vector<Point3d>& polygon1 : polygons1){
+      for (const Point3d& point : polygon1){
+        bool found = false;
+        for (const std::vector<Point3d>& polygon2 : polygons2){
+          for (unsigned i = 0; (i < polygon2.size()) && !found; ++i){
+            found = (distanceToSegment(point, polygon2[i], polygon2[(i + 1) % polygon2.size()]) <= tol);
+          }
+        }
+        if (!found){
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  // polygons have the same boundaries within tol
+  bool sameBoundaries(const std::vector<std::vector<Point3d> >& polygons1, const std::vector<std::vector<Point3d> >& polygons2, double tol)
+  {
+    return verticesOnBoundaries(polygons1, polygons2, tol) && verticesOnBoundaries(polygons2, polygons1, tol);
+  }
 
+}
+
+TEST_F(GeometryFixture, ConvexIntersect_Fuzz)
+{
+  double tol = 0.01;
+
+  // vertices near other vertices are merged within tol so allow for that
+  double areaTol = 0.05;
+  double vertexTol = 2*tol;
+
+  unsigned numHandled = 0;
+  std::vector<std::pair<std::vector<Point3d>, std::vector<Point3d> > > testCases = makeConvexTestCases(2000);
+  for (const auto& testCase : testCases){
+    const std::vector<Point3d>& polygon1 = testCase.first;
+    const std::vector<Point3d>& polygon2 = testCase.second;
+
+    boost::optional<IntersectionResult> result;
+    if (!convexIntersect(polygon1, polygon2, tol, result)){
+      continue;
+    }
+    ++numHandled;
+
+    BoostPolygon boostPolygon1 = boostPolygonFromPoints(polygon1);
+    BoostPolygon boostPolygon2 = boostPolygonFromPoints(polygon2);
+    std::vector<BoostPolygon> intersection;
+    boost::geometry::intersection(boostPolygon1, boostPolygon2, intersection);
+    double intersectionArea = totalBoostArea(intersection);
+
+    if (!result){
+      EXPECT_NEAR(0.0, intersectionArea, areaTol) << polygon1 << polygon2;
+      continue;
+    }
+
+    ASSERT_TRUE(getArea(result->polygon1()));
+    EXPECT_NEAR(intersectionArea, *getArea(result->polygon1()), areaTol) << polygon1 << polygon2;
+    EXPECT_NEAR(*getArea(polygon1), result->area1(), areaTol) << polygon1 << polygon2;
+    EXPECT_NEAR(*getArea(polygon2), result->area2(), areaTol) << polygon1 << polygon2;
+
+    // same result as the general path
+    std::vector<BoostPolygon> difference1;
+    boost::geometry::difference(boostPolygon1, boostPolygon2, difference1);
+    std::vector<BoostPolygon> difference2;
+    boost::geometry::difference(boostPolygon2, boostPolygon1, difference2);
+    EXPECT_NEAR(totalBoostArea(difference1), totalArea(result->newPolygons1()), areaTol) << polygon1 << polygon2;
+    EXPECT_NEAR(totalBoostArea(difference2), totalArea(result->newPolygons2()), areaTol) << polygon1 << polygon2;
+
+    // with the same vertices, up to the merging of nearby vertices
+    std::vector<std::vector<Point3d> > intersectionPolygons(1, result->polygon1());
+    EXPECT_TRUE(sameBoundaries(pointsFromBoostPolygons(intersection, tol), intersectionPolygons, vertexTol)) << polygon1 << polygon2;
+    EXPECT_TRUE(sameBoundaries(pointsFromBoostPolygons(difference1, tol), result->newPolygons1(), vertexTol)) << polygon1 << polygon2;
+    EXPECT_TRUE(sameBoundaries(pointsFromBoostPolygons(difference2, tol), result->newPolygons2(), vertexTol)) << polygon1 << polygon2;
+
+    // pieces keep the orientation of the inputs
+    boost::optional<Vector3d> normal = getOutwardNormal(polygon1);
+    ASSERT_TRUE(normal);
+    EXPECT_TRUE(checkNormals(*normal, result->newPolygons1()));
+    EXPECT_TRUE(checkNormals(*normal, result->newPolygons2()));
+  }
+
+  // all the rectangles are handled
+  EXPECT_LE(testCases.size() / 2, numHandled);
+}
+
+TEST_F(GeometryFixture, ConvexSubtract_Fuzz)
+{
+  double tol = 0.01;
+  double areaTol = 0.05;
+  double vertexTol = 2*tol;
+
+  std::vector<std::pair<std::vector<Point3d>, std::vector<Point3d> > > testCases = makeConvexTestCases(2000);
+  for (const auto& testCase : testCases){
+    const std::vector<Point3d>& polygon = testCase.first;
+    std::vector<std::vector<Point3d> > holes(1, testCase.second);
+
+    std::vector<std::vector<Point3d> > result;
+    if (!convexSubtract(polygon, holes, tol, result)){
+      continue;
+    }
+
+    std::vector<BoostPolygon> difference;
+    boost::geometry::difference(boostPolygonFromPoints(polygon), boostPolygonFromPoints(holes[0]), difference);
+    EXPECT_NEAR(totalBoostArea(difference), totalArea(result), areaTol) << polygon << holes[0];
+    EXPECT_TRUE(sameBoundaries(pointsFromBoostPolygons(difference, tol), result, vertexTol)) << polygon << holes[0];
+  }
+
+  // a hole in the middle is left to the general path
+  std::vector<std::vector<Point3d> > result;
+  std::vector<std::vector<Point3d> > holes(1, makeRectangleDown(4, 4, 2, 2));
+  EXPECT_FALSE(convexSubtract(makeRectangleDown(0, 0, 10, 10), holes, tol, result));
+  result = subtract(makeRectangleDown(0, 0, 10, 10), holes, tol);
+  EXPECT_NEAR(96.0, totalArea(result), tol*tol);
+
+  // two holes cutting off strips at either side
+  holes.clear();
+  holes.push_back(makeRectangleDown(0, 0, 2, 10));
+  holes.push_back(makeRectangleDown(8, 0, 2, 10));
+  EXPECT_TRUE(convexSubtract(makeRectangleDown(0, 0, 10, 10), holes, tol, result));
+  ASSERT_EQ(1u, result.size());
+  EXPECT_NEAR(60.0, totalArea(result), tol*tol);
+
+  // the first hole leaves a non-convex piece for the second one
+  holes.clear();
+  holes.push_back(makeRectangleDown(0, 0, 2, 2));
+  holes.push_back(makeRectangleDown(8, 8, 2, 2));
+  EXPECT_FALSE(convexSubtract(makeRectangleDown(0, 0, 10, 10), holes, tol, result));
+  result = subtract(makeRectangleDown(0, 0, 10, 10), holes, tol);
+  EXPECT_NEAR(92.0, totalArea(result), tol*tol);
+}
+
+TEST_F(GeometryFixture, ConvexIntersect_Benchmark)
+{
+  double tol = 0.01;
+
+  std::vector<std::pair<std::vector<Point3d>, std::vector<Point3d> > > testCases = makeConvexTestCases(2000);
+
+  auto start = std::chrono::steady_clock::now();
+  for (const auto& testCase : testCases){
+    boost::optional<IntersectionResult> result;
+    convexIntersect(testCase.first, testCase.second, tol, result);
+  }
+  auto kernelEnd = std::chrono::steady_clock::now();
+
+  // the boolean operations the general path runs for each pair
+  for (const auto& testCase : testCases){
+    BoostPolygon boostPolygon1 = boostPolygonFromPoints(testCase.first);
+    BoostPolygon boostPolygon2 = boostPolygonFromPoints(testCase.second);
+    std::vector<BoostPolygon> intersection;
+    boost::geometry::intersection(boostPolygon1, boostPolygon2, intersection);
+    std::vector<BoostPolygon> difference1;
+    boost::geometry::difference(boostPolygon1, boostPolygon2, difference1);
+    std::vector<BoostPolygon> difference2;
+    boost::geometry::difference(boostPolygon2, boostPolygon1, difference2);
+  }
+  auto boostEnd = std::chrono::steady_clock::now();
+
+  LOG(Info, "Intersected " << testCases.size() << " convex pairs with the convex kernel in "
+    << std::chrono::duration_cast<std::chrono::milliseconds>(kernelEnd - start).count() << " ms, boost::geometry took "
+    << std::chrono::duration_cast<std::chrono::milliseconds>(boostEnd - kernelEnd).count() << " ms");
+}
@@ -32,8 +32,12 @@
 
 #include "../ThreeJS.hpp"
 
+#include <jsoncpp/json.h>
+
 #include <resources.hxx>
 
+#include <sstream>
+
 using namespace openstudio;
 
 TEST_F(GeometryFixture, ThreeJS)
@@ -60,3 +64,24 @@ TEST_F(GeometryFixture, ThreeJS)
   scene = ThreeScene::load(toString(p));
   ASSERT_TRUE(scene);
 }
+
+TEST_F(GeometryFixture, ThreeJS_PrintJSON)
+{
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/threejs.json");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<ThreeScene> scene = ThreeScene::load(toString(p));
+  ASSERT_TRUE(scene);
+
+  // streamed output must match the Json::Value based output
+  std::string json = scene->toJSON(false);
+  EXPECT_EQ(Json::FastWriter().write(scene->toJsonValue()), json);
+  std::stringstream ss;
+  scene->printJSON(ss);
+  EXPECT_EQ(json, ss.str());
+
+  boost::optional<ThreeScene> scene2 = ThreeScene::load(json);
+  ASSERT_TRUE(scene2);
+  EXPECT_EQ(scene->toJSON(true), scene2->toJSON(true));
+  EXPECT_EQ(json, scene2->toJSON(false));
+}
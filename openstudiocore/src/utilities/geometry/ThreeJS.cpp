@@ -38,7 +38,10 @@
 #include <jsoncpp/json.h>
 
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <cmath>
+#include <cstdio>
 
 namespace openstudio{
 
@@ -281,6 +284,152 @@ namespace openstudio{
     return Transformation();
   }
 
+  /// Writes compact JSON directly to a stream, output matches Json::FastWriter as long as
+  /// object keys are written in sorted order (Json::Value stores members in a std::map).
+  class ThreeJsonWriter{
+  public:
+    ThreeJsonWriter(std::ostream& os)
+      : m_os(os), m_afterKey(false)
+    {}
+
+    void startObject()
+    {
+      separate();
+      m_os.put('{');
+      m_first.push_back(true);
+    }
+
+    void endObject()
+    {
+      m_os.put('}');
+      m_first.pop_back();
+    }
+
+    void startArray()
+    {
+      separate();
+      m_os.put('[');
+      m_first.push_back(true);
+    }
+
+    void endArray()
+    {
+      m_os.put(']');
+      m_first.pop_back();
+    }
+
+    void key(const char* k)
+    {
+      separate();
+      m_os.put('"');
+      m_os << k;
+      m_os.write("\":", 2);
+      m_afterKey = true;
+    }
+
+    void value(const std::string& s)
+    {
+      separate();
+      m_os.put('"');
+      for (const char c : s){
+        switch (c){
+        case '"':
+          m_os.write("\\\"", 2);
+          break;
+        case '\\':
+          m_os.write("\\\\", 2);
+          break;
+        case '\b':
+          m_os.write("\\b", 2);
+          break;
+        case '\f':
+          m_os.write("\\f", 2);
+          break;
+        case '\n':
+          m_os.write("\\n", 2);
+          break;
+        case '\r':
+          m_os.write("\\r", 2);
+          break;
+        case '\t':
+          m_os.write("\\t", 2);
+          break;
+        default:
+          if ((c >= 0) && (c < 0x20)){
+            char buffer[8];
+            int len = snprintf(buffer, sizeof(buffer), "\\u%04X", static_cast<int>(c));
+            m_os.write(buffer, len);
+          }else{
+            m_os.put(c);
+          }
+          break;
+        }
+      }
+      m_os.put('"');
+    }
+
+    void value(double d)
+    {
+      separate();
+      char buffer[32];
+      int len;
+      if (std::isfinite(d)){
+        len = snprintf(buffer, sizeof(buffer), "%.17g", d);
+        // same locale fix as Json::FastWriter
+        for (int i = 0; i < len; ++i){
+          if (buffer[i] == ','){
+            buffer[i] = '.';
+          }
+        }
+      }else if (d != d){
+        len = snprintf(buffer, sizeof(buffer), "null");
+      }else if (d < 0){
+        len = snprintf(buffer, sizeof(buffer), "-1e+9999");
+      }else{
+        len = snprintf(buffer, sizeof(buffer), "1e+9999");
+      }
+      m_os.write(buffer, len);
+    }
+
+    void value(unsigned u)
+    {
+      separate();
+      m_os << u;
+    }
+
+    void value(bool b)
+    {
+      separate();
+      if (b){
+        m_os.write("true", 4);
+      }else{
+        m_os.write("false", 5);
+      }
+    }
+
+  private:
+
+    // writes a comma before all but the first element of an array or object
+    void separate()
+    {
+      if (m_afterKey){
+        m_afterKey = false;
+        return;
+      }
+      if (!m_first.empty()){
+        if (m_first.back()){
+          m_first.back() = false;
+        }else{
+          m_os.put(',');
+        }
+      }
+    }
+
+    std::ostream& m_os;
+    std::vector<bool> m_first;
+    bool m_afterKey;
+  };
+
   ThreeScene::ThreeScene(const ThreeSceneMetadata& metadata, const std::vector<ThreeGeometry>& geometries, const std::vector<ThreeMaterial>& materials, const ThreeSceneObject& sceneObject)
     : m_metadata(metadata), m_geometries(geometries), m_materials(materials), m_sceneObject(sceneObject)
   {
@@ -342,6 +491,19 @@ namespace openstudio{
   }
 
   std::string ThreeScene::toJSON(bool prettyPrint) const
+  {
+    if (!prettyPrint){
+      std::ostringstream ss;
+      printJSON(ss);
+      return ss.str();
+    }
+
+    // write to string
+    Json::StyledWriter writer;
+    return writer.write(toJsonValue());
+  }
+
+  Json::Value ThreeScene::toJsonValue() const
   {
     Json::Value scene(Json::objectValue);
 
@@ -365,17 +527,40 @@ namespace openstudio{
     // object
     scene["object"] = m_sceneObject.toJsonValue();
 
-    // write to string
-    std::string result;
-    if (prettyPrint){
-      Json::StyledWriter writer;
-      result = writer.write(scene);
-    } else{
-      Json::FastWriter writer;
-      result = writer.write(scene);
+    return scene;
+  }
+
+  std::ostream& ThreeScene::printJSON(std::ostream& os) const
+  {
+    ThreeJsonWriter writer(os);
+
+    // keys in sorted order
+    writer.startObject();
+
+    writer.key("geometries");
+    writer.startArray();
+    for (const auto& g : m_geometries) {
+      g.writeJson(writer);
     }
+    writer.endArray();
 
-    return result;
+    writer.key("materials");
+    writer.startArray();
+    for (const auto& m : m_materials){
+      m.writeJson(writer);
+    }
+    writer.endArray();
+
+    writer.key("metadata");
+    m_metadata.writeJson(writer);
+
+    writer.key("object");
+    m_sceneObject.writeJson(writer);
+
+    writer.endObject();
+
+    os << '\n';
+    return os;
   }
 
   ThreeSceneMetadata ThreeScene::metadata() const
@@ -503,6 +688,40 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeGeometryData::writeJson(ThreeJsonWriter& writer) const
+  {
+    writer.startObject();
+    writer.key("castShadow");
+    writer.value(m_castShadow);
+    writer.key("doubleSided");
+    writer.value(m_doubleSided);
+    writer.key("faces");
+    writer.startArray();
+    for (const size_t& f : m_faces){
+      writer.value(static_cast<unsigned>(f));
+    }
+    writer.endArray();
+    writer.key("normals");
+    writer.startArray();
+    writer.endArray();
+    writer.key("receiveShadow");
+    writer.value(m_receiveShadow);
+    writer.key("scale");
+    writer.value(m_scale);
+    writer.key("uvs");
+    writer.startArray();
+    writer.endArray();
+    writer.key("vertices");
+    writer.startArray();
+    for (const auto& v : m_vertices){
+      writer.value(v);
+    }
+    writer.endArray();
+    writer.key("visible");
+    writer.value(m_visible);
+    writer.endObject();
+  }
+
 
   std::vector<double> ThreeGeometryData::vertices() const
   {
@@ -573,6 +792,18 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeGeometry::writeJson(ThreeJsonWriter& writer) const
+  {
+    writer.startObject();
+    writer.key("data");
+    m_data.writeJson(writer);
+    writer.key("type");
+    writer.value(m_type);
+    writer.key("uuid");
+    writer.value(m_uuid);
+    writer.endObject();
+  }
+
    std::string ThreeGeometry::uuid() const
    {
      return m_uuid;
@@ -645,6 +876,36 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeMaterial::writeJson(ThreeJsonWriter& writer) const
+  {
+    writer.startObject();
+    writer.key("ambient");
+    writer.value(m_ambient);
+    writer.key("color");
+    writer.value(m_color);
+    writer.key("emissive");
+    writer.value(m_emissive);
+    writer.key("name");
+    writer.value(m_name);
+    writer.key("opacity");
+    writer.value(m_opacity);
+    writer.key("shininess");
+    writer.value(m_shininess);
+    writer.key("side");
+    writer.value(m_side);
+    writer.key("specular");
+    writer.value(m_specular);
+    writer.key("transparent");
+    writer.value(m_transparent);
+    writer.key("type");
+    writer.value(m_type);
+    writer.key("uuid");
+    writer.value(m_uuid);
+    writer.key("wireframe");
+    writer.value(m_wireframe);
+    writer.endObject();
+  }
+
 
   std::string ThreeMaterial::uuid() const
   {
@@ -850,6 +1111,88 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeUserData::writeJson(ThreeJsonWriter& writer) const
+  {
+    writer.startObject();
+    writer.key("airWall");
+    writer.value(m_airWall);
+    writer.key("boundaryMaterialName");
+    writer.value(m_boundaryMaterialName);
+    writer.key("buildingStoryHandle");
+    writer.value(m_buildingStoryHandle);
+    writer.key("buildingStoryMaterialName");
+    writer.value(m_buildingStoryMaterialName);
+    writer.key("buildingStoryName");
+    writer.value(m_buildingStoryName);
+    writer.key("buildingUnitHandle");
+    writer.value(m_buildingUnitHandle);
+    writer.key("buildingUnitMaterialName");
+    writer.value(m_buildingUnitMaterialName);
+    writer.key("buildingUnitName");
+    writer.value(m_buildingUnitName);
+    writer.key("coincidentWithOutsideObject");
+    writer.value(m_coincidentWithOutsideObject);
+    writer.key("constructionMaterialName");
+    writer.value(m_constructionMaterialName);
+    writer.key("constructionName");
+    writer.value(m_constructionName);
+    writer.key("constructionSetHandle");
+    writer.value(m_constructionSetHandle);
+    writer.key("constructionSetMaterialName");
+    writer.value(m_constructionSetMaterialName);
+    writer.key("constructionSetName");
+    writer.value(m_constructionSetName);
+    writer.key("handle");
+    writer.value(m_handle);
+    writer.key("illuminanceSetpoint");
+    writer.value(m_illuminanceSetpoint);
+    writer.key("name");
+    writer.value(m_name);
+    writer.key("outsideBoundaryCondition");
+    writer.value(m_outsideBoundaryCondition);
+    writer.key("outsideBoundaryConditionObjectHandle");
+    writer.value(m_outsideBoundaryConditionObjectHandle);
+    writer.key("outsideBoundaryConditionObjectName");
+    writer.value(m_outsideBoundaryConditionObjectName);
+    writer.key("shadingHandle");
+    writer.value(m_shadingHandle);
+    writer.key("shadingName");
+    writer.value(m_shadingName);
+    writer.key("spaceHandle");
+    writer.value(m_spaceHandle);
+    writer.key("spaceName");
+    writer.value(m_spaceName);
+    writer.key("spaceTypeHandle");
+    writer.value(m_spaceTypeHandle);
+    writer.key("spaceTypeMaterialName");
+    writer.value(m_spaceTypeMaterialName);
+    writer.key("spaceTypeName");
+    writer.value(m_spaceTypeName);
+    writer.key("subSurfaceHandle");
+    writer.value(m_subSurfaceHandle);
+    writer.key("subSurfaceName");
+    writer.value(m_subSurfaceName);
+    writer.key("sunExposure");
+    writer.value(m_sunExposure);
+    writer.key("surfaceHandle");
+    writer.value(m_surfaceHandle);
+    writer.key("surfaceName");
+    writer.value(m_surfaceName);
+    writer.key("surfaceType");
+    writer.value(m_surfaceType);
+    writer.key("surfaceTypeMaterialName");
+    writer.value(m_surfaceTypeMaterialName);
+    writer.key("thermalZoneHandle");
+    writer.value(m_thermalZoneHandle);
+    writer.key("thermalZoneMaterialName");
+    writer.value(m_thermalZoneMaterialName);
+    writer.key("thermalZoneName");
+    writer.value(m_thermalZoneName);
+    writer.key("windExposure");
+    writer.value(m_windExposure);
+    writer.endObject();
+  }
+
   std::string ThreeUserData::handle() const
   {
     return m_handle;
@@ -1321,6 +1664,30 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeSceneChild::writeJson(ThreeJsonWriter& writer) const
+  {
+    writer.startObject();
+    writer.key("geometry");
+    writer.value(m_geometryId);
+    writer.key("material");
+    writer.value(m_materialId);
+    writer.key("matrix");
+    writer.startArray();
+    for (const auto& d : m_matrix){
+      writer.value(d);
+    }
+    writer.endArray();
+    writer.key("name");
+    writer.value(m_name);
+    writer.key("type");
+    writer.value(m_type);
+    writer.key("userData");
+    m_userData.writeJson(writer);
+    writer.key("uuid");
+    writer.value(m_uuid);
+    writer.endObject();
+  }
+
   std::string ThreeSceneChild::uuid() const
   {
     return m_uuid;
@@ -1405,6 +1772,28 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeSceneObject::writeJson(ThreeJsonWriter& writer) const
+  {
+    writer.startObject();
+    writer.key("children");
+    writer.startArray();
+    for (const auto& c : m_children){
+      c.writeJson(writer);
+    }
+    writer.endArray();
+    writer.key("matrix");
+    writer.startArray();
+    for (const auto& d : m_matrix){
+      writer.value(d);
+    }
+    writer.endArray();
+    writer.key("type");
+    writer.value(m_type);
+    writer.key("uuid");
+    writer.value(m_uuid);
+    writer.endObject();
+  }
+
   std::string ThreeSceneObject::uuid() const
   {
     return m_uuid;
@@ -1453,6 +1842,32 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeBoundingBox::writeJson(ThreeJsonWriter& writer) const
+  {
+    writer.startObject();
+    writer.key("lookAtR");
+    writer.value(m_lookAtR);
+    writer.key("lookAtX");
+    writer.value(m_lookAtX);
+    writer.key("lookAtY");
+    writer.value(m_lookAtY);
+    writer.key("lookAtZ");
+    writer.value(m_lookAtZ);
+    writer.key("maxX");
+    writer.value(m_maxX);
+    writer.key("maxY");
+    writer.value(m_maxY);
+    writer.key("maxZ");
+    writer.value(m_maxZ);
+    writer.key("minX");
+    writer.value(m_minX);
+    writer.key("minY");
+    writer.value(m_minY);
+    writer.key("minZ");
+    writer.value(m_minZ);
+    writer.endObject();
+  }
+
   double ThreeBoundingBox::minX() const
   {
     return m_minX;
@@ -1588,6 +2003,42 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeModelObjectMetadata::writeJson(ThreeJsonWriter& writer) const
+  {
+    writer.startObject();
+    if (m_aboveCeilingPlenumHeight){
+      writer.key("above_ceiling_plenum_height");
+      writer.value(m_aboveCeilingPlenumHeight.get());
+    }
+    if (m_belowFloorPlenumHeight){
+      writer.key("below_floor_plenum_height");
+      writer.value(m_belowFloorPlenumHeight.get());
+    }
+    writer.key("color");
+    writer.value(m_color);
+    if (m_floorToCeilingHeight){
+      writer.key("floor_to_ceiling_height");
+      writer.value(m_floorToCeilingHeight.get());
+    }
+    writer.key("handle");
+    writer.value(m_handle);
+    writer.key("iddObjectType");
+    writer.value(m_iddObjectType);
+    if (m_multiplier){
+      writer.key("multiplier");
+      writer.value(m_multiplier.get());
+    }
+    writer.key("name");
+    writer.value(m_name);
+    if (m_nominalZCoordinate){
+      writer.key("nominal_z_coordinate");
+      writer.value(m_nominalZCoordinate.get());
+    }
+    writer.key("open_to_below");
+    writer.value(m_openToBelow);
+    writer.endObject();
+  }
+
   std::string ThreeModelObjectMetadata::color() const
   {
     return m_color;
@@ -1773,6 +2224,32 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeSceneMetadata::writeJson(ThreeJsonWriter& writer) const
+  {
+    writer.startObject();
+    writer.key("boundingBox");
+    m_boundingBox.writeJson(writer);
+    writer.key("buildingStoryNames");
+    writer.startArray();
+    for (const auto& buildingStoryName : m_buildingStoryNames){
+      writer.value(buildingStoryName);
+    }
+    writer.endArray();
+    writer.key("generator");
+    writer.value(m_generator);
+    writer.key("modelObjectMetadata");
+    writer.startArray();
+    for (const auto& m : m_modelObjectMetadata){
+      m.writeJson(writer);
+    }
+    writer.endArray();
+    writer.key("type");
+    writer.value(m_type);
+    writer.key("version");
+    writer.value(m_version);
+    writer.endObject();
+  }
+
   std::string ThreeSceneMetadata::version() const
   {
     return m_version;
@@ -39,6 +39,7 @@
 
 #include <vector>
 #include <map>
+#include <ostream>
 #include <boost/optional.hpp>
 
 namespace Json{
@@ -49,6 +50,7 @@ namespace openstudio{
 
   class ThreeScene;
   class ThreeMaterial;
+  class ThreeJsonWriter;
 
   /// enum for materials
   enum ThreeSide{FrontSide = 0, BackSide = 1, DoubleSide = 2};
@@ -113,6 +115,7 @@ namespace openstudio{
     friend class ThreeGeometry;
     ThreeGeometryData(const Json::Value& json);
     Json::Value toJsonValue() const;
+    void writeJson(ThreeJsonWriter& writer) const;
 
     std::vector<double> m_vertices;
     std::vector<size_t> m_normals;
@@ -137,6 +140,7 @@ namespace openstudio{
     friend class ThreeScene;
     ThreeGeometry(const Json::Value& json);
     Json::Value toJsonValue() const;
+    void writeJson(ThreeJsonWriter& writer) const;
 
     std::string m_uuid;
     std::string m_type;
@@ -166,6 +170,7 @@ namespace openstudio{
     friend class ThreeScene;
     ThreeMaterial(const Json::Value& json);
     Json::Value toJsonValue() const;
+    void writeJson(ThreeJsonWriter& writer) const;
 
     std::string m_uuid;
     std::string m_name;
@@ -302,6 +307,7 @@ namespace openstudio{
     friend class ThreeSceneChild;
     ThreeUserData(const Json::Value& json);
     Json::Value toJsonValue() const;
+    void writeJson(ThreeJsonWriter& writer) const;
 
     std::string m_handle;
     std::string m_name;
@@ -365,6 +371,7 @@ namespace openstudio{
     friend class ThreeSceneObject;
     ThreeSceneChild(const Json::Value& json);
     Json::Value toJsonValue() const;
+    void writeJson(ThreeJsonWriter& writer) const;
 
     std::string m_uuid;
     std::string m_name;
@@ -388,6 +395,7 @@ namespace openstudio{
     friend class ThreeScene;
     ThreeSceneObject(const Json::Value& json);
     Json::Value toJsonValue() const;
+    void writeJson(ThreeJsonWriter& writer) const;
 
     std::string m_uuid;
     std::string m_type;
@@ -415,6 +423,7 @@ namespace openstudio{
     friend class ThreeSceneMetadata;
     ThreeBoundingBox(const Json::Value& json);
     Json::Value toJsonValue() const;
+    void writeJson(ThreeJsonWriter& writer) const;
 
     double m_minX;
     double m_minY;
@@ -481,6 +490,7 @@ namespace openstudio{
 
     ThreeModelObjectMetadata(const Json::Value& json);
     Json::Value toJsonValue() const;
+    void writeJson(ThreeJsonWriter& writer) const;
 
     std::string m_iddObjectType;
     std::string m_handle;
@@ -510,6 +520,7 @@ namespace openstudio{
     friend class ThreeScene;
     ThreeSceneMetadata(const Json::Value& json);
     Json::Value toJsonValue() const;
+    void writeJson(ThreeJsonWriter& writer) const;
 
     std::string m_version;
     std::string m_type;
@@ -539,6 +550,11 @@ namespace openstudio{
     /// print to JSON
     std::string toJSON(bool prettyPrint = false) const;
 
+    /// print compact JSON to a stream, same output as toJSON(false) but written directly without building a Json::Value tree
+    std::ostream& printJSON(std::ostream& os) const;
+
+    Json::Value toJsonValue() const;
+
     ThreeSceneMetadata metadata() const;
     std::vector<ThreeGeometry> geometries() const;
     boost::optional<ThreeGeometry> getGeometry(const std::string& geometryId) const;
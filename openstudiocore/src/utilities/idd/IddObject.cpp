@@ -73,6 +73,7 @@ namespace detail {
                             m_name);
     OS_ASSERT(oField);
     m_extensibleFields.push_back(*oField);
+    cacheNameField();
   }
 
   // GETTERS
@@ -197,6 +198,7 @@ namespace detail {
         unsigned newMaxFields = m_properties.maxFields.get() + 1;
         m_properties.maxFields = newMaxFields;
       }
+      cacheNameField();
     }
   }
 
@@ -247,22 +249,12 @@ namespace detail {
   }
 
   bool IddObject_Impl::hasNameField() const {
-    if (m_nameFieldCache) {
-      return m_nameFieldCache->first;
-    }
-
-    unsigned index = 0;
-    if (hasHandleField()) {
-      index = 1;
-    }
-    bool result = ((m_fields.size() > index) && (m_fields[index].isNameField()));
-    m_nameFieldCache = std::pair<bool,unsigned>(result,index);
-    return result;
+    return m_nameFieldCache.first;
   }
 
   boost::optional<unsigned> IddObject_Impl::nameFieldIndex() const {
     if (hasNameField()) {
-      return m_nameFieldCache->second;
+      return m_nameFieldCache.second;
     }
     return boost::none;
   }
@@ -466,7 +458,7 @@ namespace detail {
   // PRIVATE
 
   IddObject_Impl::IddObject_Impl(const string& name, const string& group, IddObjectType type)
-    : m_name(name), m_group(group), m_type(type) {}
+    : m_name(name), m_group(group), m_type(type), m_nameFieldCache(false,0) {}
 
   void IddObject_Impl::parse(const std::string& text)
   {
@@ -494,6 +486,17 @@ namespace detail {
       makeExtensible();
     }
 
+    cacheNameField();
+  }
+
+  void IddObject_Impl::cacheNameField()
+  {
+    unsigned index = 0;
+    if (hasHandleField()) {
+      index = 1;
+    }
+    bool result = ((m_fields.size() > index) && (m_fields[index].isNameField()));
+    m_nameFieldCache = std::pair<bool,unsigned>(result,index);
   }
 
   void IddObject_Impl::makeExtensible()
@@ -194,8 +194,9 @@ namespace detail {
     IddFieldVector m_extensibleFields; // vector of extensible fields, forms single
                                        // extensible field group
     std::vector<unsigned> m_urlIdx;
-    // .first = hasNameField(); .second = nameFieldIndex
-    mutable boost::optional< std::pair<bool,unsigned> > m_nameFieldCache;
+    // .first = hasNameField(); .second = nameFieldIndex; set whenever m_fields changes so that
+    // const access never writes, the validity report reads it from several threads
+    std::pair<bool,unsigned> m_nameFieldCache;
 
     // partial constructor used by load
     IddObject_Impl(const std::string& name, const std::string& group, IddObjectType type);
@@ -203,6 +204,9 @@ namespace detail {
     // parse
     void parse(const std::string& text);
 
+    // recompute m_nameFieldCache from m_fields
+    void cacheNameField();
+
     void parseObject(const std::string& text);
     void parseProperty(const std::string& text);
     void parseFields(const std::string& text);
@@ -101,6 +101,8 @@
 %ignore openstudio::IdfFile::load(std::istream&);
 %ignore openstudio::IdfFile::load(std::istream&, IddFileType);
 %ignore openstudio::IdfFile::load(std::istream&, const IddFile&);
+%ignore openstudio::IdfFile::loadBinary(std::istream&);
+%ignore openstudio::IdfFile::printBinary;
 
 #if defined(SWIGRUBY)
   // add mixins
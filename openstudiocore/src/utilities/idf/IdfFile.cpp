@@ -47,9 +47,214 @@
 #include <boost/iostreams/filter/newline.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <locale>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+
 
 namespace openstudio {
 
+namespace {
+
+  // Binary IdfFile layout, integers and doubles in host byte order:
+  //   signature, format version, IddFileType name, IDD version, header,
+  //   string table (count, then length and bytes per string),
+  //   object count, then per object: type and comment string indices, 16 byte handle,
+  //   field count and tagged fields, field comment count and string indices.
+  const char binarySignature[8] = {'O', 'S', 'I', 'D', 'F', 'B', 'I', 'N'};
+  const std::uint32_t binaryFormatVersion = 1;
+
+  enum BinaryFieldTag : unsigned char {
+    EmptyField = 0,
+    StringField = 1,
+    DoubleField = 2,
+    UUIDField = 3
+  };
+
+  template<typename T>
+  void appendBinary(std::string& buffer, const T& t)
+  {
+    buffer.append(reinterpret_cast<const char*>(&t), sizeof(T));
+  }
+
+  void appendBinaryString(std::string& buffer, const std::string& str)
+  {
+    appendBinary(buffer, static_cast<std::uint32_t>(str.size()));
+    buffer.append(str);
+  }
+
+  /** Bounds checked cursor over the contents of a binary file. */
+  class BinaryReader
+  {
+   public:
+    BinaryReader(const char* begin, const char* end)
+      : m_pos(begin), m_end(end), m_ok(true)
+    {}
+
+    bool ok() const { return m_ok; }
+
+    template<typename T>
+    T read()
+    {
+      T result = T();
+      if (const char* p = readBytes(sizeof(T))) {
+        std::memcpy(&result, p, sizeof(T));
+      }
+      return result;
+    }
+
+    const char* readBytes(size_t n)
+    {
+      if (!m_ok || (static_cast<size_t>(m_end - m_pos) < n)) {
+        m_ok = false;
+        return nullptr;
+      }
+      const char* result = m_pos;
+      m_pos += n;
+      return result;
+    }
+
+    std::string readString()
+    {
+      std::uint32_t n = read<std::uint32_t>();
+      if (const char* p = readBytes(n)) {
+        return std::string(p, n);
+      }
+      return std::string();
+    }
+
+   private:
+    const char* m_pos;
+    const char* m_end;
+    bool m_ok;
+  };
+
+  /** Assigns each distinct string an index in order of first use. */
+  class BinaryStringTable
+  {
+   public:
+    std::uint32_t index(const std::string& str)
+    {
+      auto it = m_indices.find(str);
+      if (it == m_indices.end()) {
+        it = m_indices.insert(std::make_pair(str, static_cast<std::uint32_t>(m_strings.size()))).first;
+        m_strings.push_back(&it->first);
+      }
+      return it->second;
+    }
+
+    void append(std::string& buffer) const
+    {
+      appendBinary(buffer, static_cast<std::uint32_t>(m_strings.size()));
+      for (const std::string* str : m_strings) {
+        appendBinaryString(buffer, *str);
+      }
+    }
+
+   private:
+    std::unordered_map<std::string, std::uint32_t> m_indices;
+    std::vector<const std::string*> m_strings;
+  };
+
+  int hexValue(char c)
+  {
+    if ((c >= '0') && (c <= '9')) { return c - '0'; }
+    if ((c >= 'a') && (c <= 'f')) { return c - 'a' + 10; }
+    return -1;
+  }
+
+  // matches only the lowercase, braced text written by toString(UUID)
+  bool uuidBytesFromText(const std::string& text, unsigned char* bytes)
+  {
+    if ((text.size() != 38u) || (text[0] != '{') || (text[37] != '}')) {
+      return false;
+    }
+    unsigned n = 0;
+    for (unsigned i = 1; i < 37; ++i) {
+      if ((i == 9) || (i == 14) || (i == 19) || (i == 24)) {
+        if (text[i] != '-') {
+          return false;
+        }
+        continue;
+      }
+      int hi = hexValue(text[i]);
+      int lo = hexValue(text[i + 1]);
+      if ((hi < 0) || (lo < 0)) {
+        return false;
+      }
+      bytes[n++] = static_cast<unsigned char>((hi << 4) | lo);
+      ++i;
+    }
+    return (n == 16u);
+  }
+
+  std::string uuidTextFromBytes(const unsigned char* bytes)
+  {
+    static const char digits[] = "0123456789abcdef";
+    std::string result;
+    result.reserve(38);
+    result.push_back('{');
+    for (unsigned n = 0; n < 16; ++n) {
+      if ((n == 4) || (n == 6) || (n == 8) || (n == 10)) {
+        result.push_back('-');
+      }
+      result.push_back(digits[bytes[n] >> 4]);
+      result.push_back(digits[bytes[n] & 0x0f]);
+    }
+    result.push_back('}');
+    return result;
+  }
+
+  /** Prints doubles stored in binary files as %.15g would in the classic locale, so the text
+   *  does not depend on the global locale of the process writing or reading the file. */
+  class BinaryDoubleFormatter
+  {
+   public:
+
+    BinaryDoubleFormatter()
+    {
+      m_os.imbue(std::locale::classic());
+      m_os.precision(15);
+    }
+
+    std::string format(double value)
+    {
+      m_os.str(std::string());
+      m_os.clear();
+      m_os << value;
+      return m_os.str();
+    }
+
+   private:
+
+    std::ostringstream m_os;
+  };
+
+  // only text that prints back exactly is stored as a double, text strtod reads differently
+  // under another locale does not print back and is kept as a string
+  bool doubleFromText(const std::string& text, double& value, BinaryDoubleFormatter& formatter)
+  {
+    if (text.empty() || (text.size() > 24u)) {
+      return false;
+    }
+    char c = text[0];
+    if (!((c == '-') || (c == '.') || ((c >= '0') && (c <= '9')))) {
+      return false;
+    }
+    char* end = nullptr;
+    value = std::strtod(text.c_str(), &end);
+    if (*end != '\0') {
+      return false;
+    }
+    return (formatter.format(value) == text);
+  }
+
+}
+
 // CONSTRUCTORS
 
 IdfFile::IdfFile(IddFileType iddFileType)
@@ -401,6 +606,17 @@ OptionalIdfFile IdfFile::load(const path& p,
     wp = completePathToFile(wp,path(),"idf",true);
   }
 
+  // binary files are recognized by their signature rather than their extension
+  if (isBinary(wp)) {
+    OptionalIdfFile result = loadBinary(wp);
+    if (result && !(result->iddFileType() == iddFileType)) {
+      LOG(Error,"Binary file '" << toString(wp) << "' uses IddFileType " << result->iddFileType().valueName()
+          << ", not the requested " << iddFileType.valueName() << ".");
+      return boost::none;
+    }
+    return result;
+  }
+
   // try to open file and parse
   openstudio::filesystem::ifstream inFile(wp);
   if (inFile) {
@@ -531,6 +747,135 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
   return false;
 }
 
+boost::optional<IdfFile> IdfFile::loadBinary(std::istream& is) {
+  std::stringstream ss;
+  ss << is.rdbuf();
+  return m_loadBinary(ss.str());
+}
+
+boost::optional<IdfFile> IdfFile::loadBinary(const path& p) {
+  openstudio::filesystem::ifstream inFile(p, std::ios_base::binary);
+  if (!inFile) {
+    LOG(Error,"Unable to open binary file '" << toString(p) << "'.");
+    return boost::none;
+  }
+
+  std::string data;
+  inFile.seekg(0, std::ios_base::end);
+  std::streamoff size = inFile.tellg();
+  inFile.seekg(0, std::ios_base::beg);
+  if (size > 0) {
+    data.resize(static_cast<size_t>(size));
+    inFile.read(&data[0], size);
+  }
+  if (!inFile) {
+    LOG(Error,"Unable to read binary file '" << toString(p) << "'.");
+    return boost::none;
+  }
+
+  return m_loadBinary(data);
+}
+
+bool IdfFile::isBinary(const path& p) {
+  if (p.empty() || !openstudio::filesystem::is_regular_file(p)) {
+    return false;
+  }
+  openstudio::filesystem::ifstream inFile(p, std::ios_base::binary);
+  char signature[sizeof(binarySignature)];
+  if (!inFile.read(signature, sizeof(signature))) {
+    return false;
+  }
+  return (std::memcmp(signature, binarySignature, sizeof(signature)) == 0);
+}
+
+std::ostream& IdfFile::printBinary(std::ostream& os) const {
+  OptionalIddFileType iddType = m_iddFileAndFactoryWrapper.iddFileType();
+  if (!iddType || (*iddType == IddFileType::UserCustom)) {
+    LOG(Error,"Only files using an IddFileType from the IddFactory can be written in the binary format.");
+    os.setstate(std::ios_base::failbit);
+    return os;
+  }
+
+  // objects are encoded first so that the string table is complete before it is written
+  BinaryStringTable strings;
+  BinaryDoubleFormatter formatter;
+  std::string body;
+  unsigned char bytes[16];
+
+  appendBinary(body, static_cast<std::uint32_t>(m_objects.size()));
+  for (const IdfObject& object : m_objects) {
+    std::shared_ptr<detail::IdfObject_Impl> impl = object.getImpl<detail::IdfObject_Impl>();
+
+    appendBinary(body, strings.index(impl->m_iddObject.name()));
+    appendBinary(body, strings.index(impl->m_comment));
+    body.append(reinterpret_cast<const char*>(&*impl->m_handle.begin()), 16);
+
+    appendBinary(body, static_cast<std::uint32_t>(impl->m_fields.size()));
+    for (const std::string& field : impl->m_fields) {
+      double value;
+      if (field.empty()) {
+        appendBinary(body, static_cast<unsigned char>(EmptyField));
+      }
+      else if (uuidBytesFromText(field, bytes)) {
+        appendBinary(body, static_cast<unsigned char>(UUIDField));
+        body.append(reinterpret_cast<const char*>(bytes), 16);
+      }
+      else if (doubleFromText(field, value, formatter)) {
+        appendBinary(body, static_cast<unsigned char>(DoubleField));
+        appendBinary(body, value);
+      }
+      else {
+        appendBinary(body, static_cast<unsigned char>(StringField));
+        appendBinary(body, strings.index(field));
+      }
+    }
+
+    appendBinary(body, static_cast<std::uint32_t>(impl->m_fieldComments.size()));
+    for (const std::string& fieldComment : impl->m_fieldComments) {
+      appendBinary(body, strings.index(fieldComment));
+    }
+  }
+
+  std::string head;
+  head.append(binarySignature, sizeof(binarySignature));
+  appendBinary(head, binaryFormatVersion);
+  appendBinaryString(head, iddType->valueName());
+  appendBinaryString(head, m_iddFileAndFactoryWrapper.version());
+  appendBinaryString(head, m_header);
+  strings.append(head);
+
+  os.write(head.data(), head.size());
+  os.write(body.data(), body.size());
+  return os;
+}
+
+bool IdfFile::saveBinary(const openstudio::path& p, bool overwrite) {
+
+  // do not overwrite if not allowed
+  if (!overwrite && openstudio::filesystem::exists(p)) {
+    LOG(Info,"Save method failed because instructed not to overwrite path '"
+      << toString(p) << "'.");
+    return false;
+  }
+
+  if (makeParentFolder(p)) {
+    openstudio::filesystem::ofstream outFile(p, std::ios_base::binary | std::ios_base::trunc);
+    if (outFile) {
+      printBinary(outFile);
+      outFile.close();
+      if (outFile) {
+        return true;
+      }
+    }
+    LOG(Error,"Unable to write file to path '" << toString(p) << "'.");
+    return false;
+  }
+
+  LOG(Error,"Unable to write file to path '" << toString(p) << "', because parent directory "
+      << "could not be created.");
+  return false;
+}
+
 // PRIVATE
 
 // SERIALIZATION
@@ -715,6 +1060,154 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
   }
 }
 
+boost::optional<IdfFile> IdfFile::m_loadBinary(const std::string& data) {
+  BinaryReader reader(data.data(), data.data() + data.size());
+
+  const char* signature = reader.readBytes(sizeof(binarySignature));
+  if (!signature || (std::memcmp(signature, binarySignature, sizeof(binarySignature)) != 0)) {
+    LOG(Error,"Data does not start with the binary IdfFile signature.");
+    return boost::none;
+  }
+  std::uint32_t formatVersion = reader.read<std::uint32_t>();
+  if (formatVersion != binaryFormatVersion) {
+    LOG(Error,"Unsupported binary IdfFile format version " << formatVersion << ".");
+    return boost::none;
+  }
+
+  std::string iddFileTypeName = reader.readString();
+  std::string version = reader.readString();
+  std::string header = reader.readString();
+  if (!reader.ok()) {
+    LOG(Error,"Binary IdfFile is truncated.");
+    return boost::none;
+  }
+
+  OptionalIddFileType iddFileType;
+  try {
+    iddFileType = IddFileType(iddFileTypeName);
+  }
+  catch (...) {}
+  if (!iddFileType || (*iddFileType == IddFileType::UserCustom)) {
+    LOG(Error,"Binary IdfFile uses unknown IddFileType '" << iddFileTypeName << "'.");
+    return boost::none;
+  }
+
+  IdfFile result(*iddFileType);
+  // remove initial version object
+  if (OptionalIdfObject vo = result.versionObject()) {
+    result.removeObject(*vo);
+  }
+  if (result.m_iddFileAndFactoryWrapper.version() != version) {
+    LOG(Error,"Binary IdfFile was written with IDD version " << version << ", but version "
+        << result.m_iddFileAndFactoryWrapper.version() << " is loaded. Binary files are not "
+        << "version translated, save the file as text with the original version instead.");
+    return boost::none;
+  }
+  result.m_header = header;
+
+  std::uint32_t numStrings = reader.read<std::uint32_t>();
+  std::vector<std::string> strings;
+  strings.reserve(std::min<size_t>(numStrings, data.size()));
+  for (std::uint32_t i = 0; (i < numStrings) && reader.ok(); ++i) {
+    strings.push_back(reader.readString());
+  }
+
+  // IddObjects are looked up once per distinct type
+  std::vector<boost::optional<IddObject> > iddObjects(strings.size());
+
+  std::uint32_t numObjects = reader.read<std::uint32_t>();
+  BinaryDoubleFormatter formatter;
+  for (std::uint32_t i = 0; (i < numObjects) && reader.ok(); ++i) {
+    std::uint32_t typeIndex = reader.read<std::uint32_t>();
+    std::uint32_t commentIndex = reader.read<std::uint32_t>();
+    const char* handleBytes = reader.readBytes(16);
+    if (!reader.ok()) {
+      break;
+    }
+    if ((typeIndex >= strings.size()) || (commentIndex >= strings.size())) {
+      LOG(Error,"Binary IdfFile has an invalid string index.");
+      return boost::none;
+    }
+
+    if (!iddObjects[typeIndex]) {
+      if (strings[typeIndex] == "Catchall") {
+        iddObjects[typeIndex] = IddObject();
+      }
+      else {
+        iddObjects[typeIndex] = result.m_iddFileAndFactoryWrapper.getObject(strings[typeIndex]);
+        if (!iddObjects[typeIndex]) {
+          LOG(Error,"Cannot find object type '" << strings[typeIndex] << "' in Idd.");
+          return boost::none;
+        }
+      }
+    }
+
+    Handle handle;
+    std::copy(reinterpret_cast<const unsigned char*>(handleBytes),
+              reinterpret_cast<const unsigned char*>(handleBytes) + 16,
+              handle.begin());
+
+    std::uint32_t numFields = reader.read<std::uint32_t>();
+    StringVector fields;
+    fields.reserve(std::min<size_t>(numFields, data.size()));
+    for (std::uint32_t j = 0; (j < numFields) && reader.ok(); ++j) {
+      unsigned char tag = reader.read<unsigned char>();
+      if (tag == EmptyField) {
+        fields.push_back(std::string());
+      }
+      else if (tag == StringField) {
+        std::uint32_t index = reader.read<std::uint32_t>();
+        if (index >= strings.size()) {
+          LOG(Error,"Binary IdfFile has an invalid string index.");
+          return boost::none;
+        }
+        fields.push_back(strings[index]);
+      }
+      else if (tag == DoubleField) {
+        fields.push_back(formatter.format(reader.read<double>()));
+      }
+      else if (tag == UUIDField) {
+        if (const char* bytes = reader.readBytes(16)) {
+          fields.push_back(uuidTextFromBytes(reinterpret_cast<const unsigned char*>(bytes)));
+        }
+      }
+      else {
+        LOG(Error,"Binary IdfFile has an invalid field tag.");
+        return boost::none;
+      }
+    }
+
+    std::uint32_t numFieldComments = reader.read<std::uint32_t>();
+    StringVector fieldComments;
+    for (std::uint32_t j = 0; (j < numFieldComments) && reader.ok(); ++j) {
+      std::uint32_t index = reader.read<std::uint32_t>();
+      if (index >= strings.size()) {
+        LOG(Error,"Binary IdfFile has an invalid string index.");
+        return boost::none;
+      }
+      fieldComments.push_back(strings[index]);
+    }
+
+    if (reader.ok()) {
+      std::shared_ptr<detail::IdfObject_Impl> impl(new detail::IdfObject_Impl(handle,
+                                                                             strings[commentIndex],
+                                                                             *iddObjects[typeIndex],
+                                                                             fields,
+                                                                             fieldComments));
+      result.addObject(IdfObject(impl));
+    }
+  }
+
+  if (!reader.ok()) {
+    LOG(Error,"Binary IdfFile is truncated.");
+    return boost::none;
+  }
+
+  // check for it again here
+  result.addVersionObject();
+  return result;
+}
+
 IddFileAndFactoryWrapper IdfFile::iddFileAndFactoryWrapper() const {
   return m_iddFileAndFactoryWrapper;
 }
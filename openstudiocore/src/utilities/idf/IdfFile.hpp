@@ -210,15 +210,38 @@ class UTILITIES_API IdfFile {
    *  identifier is found. Used to determine the appropriate IddFile to use for a full load. */
   static boost::optional<VersionString> loadVersionOnly(const path& p);
 
+  /** Load an IdfFile written by printBinary or saveBinary. Binary files are not version
+   *  translated, so a file written against a different IDD version than the one in the
+   *  IddFactory returns an empty optional. */
+  static boost::optional<IdfFile> loadBinary(std::istream& is);
+
+  /** Load an IdfFile from a binary file at path p, if possible. */
+  static boost::optional<IdfFile> loadBinary(const path& p);
+
+  /** Returns true if the file at path p starts with the binary IdfFile signature. The path-based
+   *  load methods check this and read binary files transparently. */
+  static bool isBinary(const path& p);
+
   /** Print this file to std::ostream os. */
   std::ostream& print(std::ostream& os) const;
 
+  /** Print this file to std::ostream os in the binary format. Names, keys and other text are
+   *  stored once in a string table, numeric fields as doubles and handles as 16 byte UUIDs. Text
+   *  that would not print back exactly is kept as text, so the round trip is lossless. Only files
+   *  using an IddFileType from the IddFactory can be written. */
+  std::ostream& printBinary(std::ostream& os) const;
+
   /** Save this file to path p. Will construct the parent folder if necessary and if its parent
    *  folder already exists. Will only overwrite an existing file if overwrite==true. If no
    *  extension is provided will use modelFileExtension() for files using IddFileType::OpenStudio,
    *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
   bool save(const openstudio::path& p, bool overwrite=false);
 
+  /** Save this file to path p in the binary format. The path is used as given. Will only
+   *  overwrite an existing file if overwrite==true. Returns true if the save operation is
+   *  successful; false otherwise. */
+  bool saveBinary(const openstudio::path& p, bool overwrite=false);
+
   //@}
 
  protected:
@@ -247,6 +270,9 @@ class UTILITIES_API IdfFile {
   /// private load function that uses m_iddFile and m_iddFileType initialized elsewhere
   bool m_load(std::istream& is, ProgressBar* progressBar=nullptr, bool versionOnly=false);
 
+  /// private binary load function over the complete contents of a binary file
+  static boost::optional<IdfFile> m_loadBinary(const std::string& data);
+
   // configure logging
   REGISTER_LOGGER("utilities.idf.IdfFile");
 };
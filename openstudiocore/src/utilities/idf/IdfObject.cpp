@@ -889,7 +889,7 @@ namespace detail {
 
       // record diffs for each field going backwards
       for (unsigned i = 0; i < groupSize; ++i){
-        m_diffs.push_back(IdfObjectDiff(numBeforePop-1-i, result[i], boost::none));
+        m_diffs.push_back(IdfObjectDiff(numBeforePop-1-i, result[groupSize-1-i], boost::none));
       }
 
       m_fields.resize(numAfterPop);
@@ -51,6 +51,7 @@ namespace openstudio {
 
 // forward declarations
 class IdfObject;
+class IdfFile;
 class IdfExtensibleGroup;
 struct IdfObjectImplLess;
 class StrictnessLevel;
@@ -395,6 +396,7 @@ namespace detail {
    protected:
 
     friend class openstudio::IdfObject;
+    friend class openstudio::IdfFile; // for binary serialization
 
     // handle
     Handle m_handle;
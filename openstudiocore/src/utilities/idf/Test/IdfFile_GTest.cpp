@@ -41,7 +41,9 @@
 
 
 #include <iostream>
+#include <locale>
 #include <sstream>
+#include <stdexcept>
 
 using namespace std;
 using namespace boost;
@@ -102,6 +104,106 @@ TEST_F(IdfFixture, IdfFile_Header) {
   file.setHeader(header);
   EXPECT_EQ("! Multi-line \n! Non-comment.",file.header());
 }
+TEST_F(IdfFixture, IdfFile_BinaryRoundTrip) {
+  std::stringstream text;
+  text << "! File Header" << std::endl
+       << std::endl
+       << "OS:Version," << std::endl
+       << "  {0a1b2c3d-4e5f-4a6b-8c7d-9e0f1a2b3c4d}, !- Handle" << std::endl
+       << "  " << IdfFile(IddFileType::OpenStudio).version().str() << ";" << std::endl
+       << std::endl
+       << "! Comment only" << std::endl
+       << std::endl
+       << "OS:Material, ! An insulating layer" << std::endl
+       << "  {1a1b2c3d-4e5f-4a6b-8c7d-9e0f1a2b3c4d}, !- Handle" << std::endl
+       << "  Insulation 1.50,                        !- Name" << std::endl
+       << "  MediumRough,                             !- Roughness" << std::endl
+       << "  0.050,                                   !- Thickness {m}" << std::endl
+       << "  0.03,                                    !- Conductivity {W/m-K}" << std::endl
+       << "  43,                                      !- Density {kg/m3}" << std::endl
+       << "  1.2e3,                                   !- Specific Heat {J/kg-K}" << std::endl
+       << "  0.9,                                     !- Thermal Absorptance" << std::endl
+       << "  ,                                        !- Solar Absorptance" << std::endl
+       << "  0.7;                                     !- Visible Absorptance" << std::endl;
+
+  OptionalIdfFile file = IdfFile::load(text, IddFileType::OpenStudio);
+  ASSERT_TRUE(file);
+
+  std::stringstream binary;
+  file->printBinary(binary);
+  ASSERT_TRUE(binary.good());
+
+  OptionalIdfFile binaryFile = IdfFile::loadBinary(binary);
+  ASSERT_TRUE(binaryFile);
+  EXPECT_EQ(file->header(), binaryFile->header());
+  ASSERT_EQ(file->numObjects(), binaryFile->numObjects());
+
+  IdfObjectVector objects = file->objects();
+  IdfObjectVector binaryObjects = binaryFile->objects();
+  for (unsigned i = 0, n = objects.size(); i < n; ++i) {
+    EXPECT_EQ(objects[i].handle(), binaryObjects[i].handle());
+    EXPECT_EQ(objects[i].comment(), binaryObjects[i].comment());
+  }
+
+  // printed text is unchanged
+  std::stringstream ss1, ss2;
+  file->print(ss1);
+  binaryFile->print(ss2);
+  EXPECT_EQ(ss1.str(), ss2.str());
+
+  // numbers are printed the same way under a locale with a decimal comma
+  std::locale originalLocale;
+  bool commaLocale = false;
+  for (const char* name : {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8"}) {
+    try {
+      std::locale::global(std::locale(name));
+      commaLocale = true;
+      break;
+    }
+    catch (const std::runtime_error&) {}
+  }
+  if (commaLocale) {
+    std::stringstream binaryCopy(binary.str());
+    OptionalIdfFile localeFile = IdfFile::loadBinary(binaryCopy);
+    std::stringstream localeBinary;
+    if (localeFile) {
+      localeFile->printBinary(localeBinary);
+    }
+    OptionalIdfFile localeFile2 = IdfFile::loadBinary(localeBinary);
+    std::locale::global(originalLocale);
+
+    ASSERT_TRUE(localeFile);
+    ASSERT_TRUE(localeFile2);
+    std::stringstream ss4, ss5;
+    localeFile->print(ss4);
+    localeFile2->print(ss5);
+    EXPECT_EQ(ss1.str(), ss4.str());
+    EXPECT_EQ(ss1.str(), ss5.str());
+  }
+
+  // path based load reads binary files transparently
+  openstudio::path p = toPath("IdfFile_BinaryRoundTrip.osm");
+  EXPECT_TRUE(file->saveBinary(p, true));
+  EXPECT_FALSE(file->saveBinary(p, false));
+  EXPECT_TRUE(IdfFile::isBinary(p));
+  binaryFile = IdfFile::load(p, IddFileType::OpenStudio);
+  ASSERT_TRUE(binaryFile);
+  std::stringstream ss3;
+  binaryFile->print(ss3);
+  EXPECT_EQ(ss1.str(), ss3.str());
+
+  // not a binary file
+  EXPECT_TRUE(file->save(p, true));
+  EXPECT_FALSE(IdfFile::isBinary(p));
+  std::stringstream notBinary("OS:Version;");
+  EXPECT_FALSE(IdfFile::loadBinary(notBinary));
+
+  // truncated
+  std::string data = binary.str();
+  std::stringstream truncated(data.substr(0, data.size() - 3));
+  EXPECT_FALSE(IdfFile::loadBinary(truncated));
+}
+
 /*
 TEST_F(IdfFixture, IdfFile_UnixLineEndings) {
   OptionalIdfFile oFile = IdfFile::load(resourcesPath()/toPath("utilities/Idf/UnixLineEndingTest.idf"));
@@ -97,4 +97,67 @@ class WorkspaceReciever  {
 
 };
 
+class WorkspaceBatchReciever  {
+ public:
+
+  WorkspaceBatchReciever(const Workspace& workspace, const IddObjectType& type)
+  {
+    std::shared_ptr<openstudio::detail::Workspace_Impl> impl = workspace.getImpl<openstudio::detail::Workspace_Impl>();
+
+    impl->addWorkspaceObjects.connect<WorkspaceBatchReciever, &WorkspaceBatchReciever::addWorkspaceObjects>(this);
+    impl->removeWorkspaceObjects.connect<WorkspaceBatchReciever, &WorkspaceBatchReciever::removeWorkspaceObjects>(this);
+    impl->addWorkspaceObjectPtrSignal(type).connect<WorkspaceBatchReciever, &WorkspaceBatchReciever::addWorkspaceObjectPtr>(this);
+    impl->removeWorkspaceObjectPtrSignal(type).connect<WorkspaceBatchReciever, &WorkspaceBatchReciever::removeWorkspaceObjectPtr>(this);
+  }
+
+  std::vector<std::vector<detail::WorkspaceObjectChange> > m_addedBatches;
+
+  std::vector<std::vector<detail::WorkspaceObjectChange> > m_removedBatches;
+
+  std::vector<IddObjectType> m_typedAdded;
+
+  std::vector<IddObjectType> m_typedRemoved;
+
+ public:
+
+  void addWorkspaceObjects(const std::vector<detail::WorkspaceObjectChange>& changes)
+  {
+    m_addedBatches.push_back(changes);
+  }
+
+  void removeWorkspaceObjects(const std::vector<detail::WorkspaceObjectChange>& changes)
+  {
+    m_removedBatches.push_back(changes);
+  }
+
+  void addWorkspaceObjectPtr(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+  {
+    m_typedAdded.push_back(iddObjectType);
+  }
+
+  void removeWorkspaceObjectPtr(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
+  {
+    m_typedRemoved.push_back(iddObjectType);
+  }
+
+};
+
+class ChangeCounter : public Nano::Observer {
+ public:
+
+  ChangeCounter()
+    : m_count(0)
+  {}
+
+  unsigned m_count;
+
+ public:
+
+  void change()
+  {
+    ++m_count;
+  }
+
+};
+
 #endif // UTILITIES_IDF_TEST_IDFTESTQOBJECTS_HPP
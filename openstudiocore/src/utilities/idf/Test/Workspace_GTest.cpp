@@ -56,6 +56,7 @@
 #include <utilities/idd/Sizing_Zone_FieldEnums.hxx>
 #include <utilities/idd/OS_WeatherFile_FieldEnums.hxx>
 #include "../WorkspaceWatcher.hpp"
+#include "../WorkspaceTransaction.hpp"
 #include "IdfTestQObjects.hpp"
 
 #include "../../core/Application.hpp"
@@ -2043,6 +2044,168 @@ TEST_F(IdfFixture, Workspace_Signals)
   delete reciever;
 }
 
+TEST_F(IdfFixture, Workspace_BatchedSignals)
+{
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::OpenStudio);
+  WorkspaceBatchReciever reciever(workspace, IddObjectType::OS_Space);
+
+  IdfObjectVector idfObjects;
+  for (unsigned i = 0; i < 10; ++i) {
+    idfObjects.push_back(IdfObject(IddObjectType::OS_Space));
+  }
+  for (unsigned i = 0; i < 5; ++i) {
+    idfObjects.push_back(IdfObject(IddObjectType::OS_ThermalZone));
+  }
+
+  // one addObjects call is one batch, the typed signal only sees spaces
+  WorkspaceObjectVector objects = workspace.addObjects(idfObjects);
+  ASSERT_EQ(15u, objects.size());
+  ASSERT_EQ(1u, reciever.m_addedBatches.size());
+  ASSERT_EQ(15u, reciever.m_addedBatches[0].size());
+  for (unsigned i = 0; i < 15; ++i) {
+    EXPECT_EQ(objects[i].handle(), reciever.m_addedBatches[0][i].handle);
+    EXPECT_EQ(objects[i].iddObject().type(), reciever.m_addedBatches[0][i].iddObjectType);
+  }
+  EXPECT_EQ(10u, reciever.m_typedAdded.size());
+  EXPECT_TRUE(reciever.m_removedBatches.empty());
+
+  // removed handles are reported even though the objects no longer have them
+  HandleVector handles;
+  handles.push_back(objects[0].handle());
+  handles.push_back(objects[1].handle());
+  handles.push_back(objects[10].handle());
+  EXPECT_TRUE(workspace.removeObjects(handles));
+  ASSERT_EQ(1u, reciever.m_removedBatches.size());
+  ASSERT_EQ(3u, reciever.m_removedBatches[0].size());
+  for (unsigned i = 0; i < 3; ++i) {
+    EXPECT_EQ(handles[i], reciever.m_removedBatches[0][i].handle);
+    EXPECT_TRUE(reciever.m_removedBatches[0][i].object->handle().isNull());
+  }
+  EXPECT_EQ(2u, reciever.m_typedRemoved.size());
+
+  // explicit batch, an object added and removed within it is not reported
+  std::shared_ptr<detail::Workspace_Impl> impl = workspace.getImpl<detail::Workspace_Impl>();
+  impl->startNotificationBatch();
+  WorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::OS_ThermalZone)).get();
+  WorkspaceObject space = workspace.addObject(IdfObject(IddObjectType::OS_Space)).get();
+  impl->startNotificationBatch();
+  EXPECT_EQ(1u, zone.remove().size());
+  objects[2].remove();
+  impl->endNotificationBatch();
+  EXPECT_EQ(1u, reciever.m_addedBatches.size());
+  EXPECT_EQ(1u, reciever.m_removedBatches.size());
+  impl->endNotificationBatch();
+
+  ASSERT_EQ(2u, reciever.m_addedBatches.size());
+  ASSERT_EQ(1u, reciever.m_addedBatches[1].size());
+  EXPECT_EQ(space.handle(), reciever.m_addedBatches[1][0].handle);
+  ASSERT_EQ(2u, reciever.m_removedBatches.size());
+  ASSERT_EQ(1u, reciever.m_removedBatches[1].size());
+  EXPECT_EQ(IddObjectType(IddObjectType::OS_Space), reciever.m_removedBatches[1][0].iddObjectType);
+  EXPECT_EQ(11u, reciever.m_typedAdded.size());
+  EXPECT_EQ(3u, reciever.m_typedRemoved.size());
+}
+
+TEST_F(IdfFixture, Workspace_Transaction)
+{
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  WorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::Zone)).get();
+  WorkspaceObject lights = workspace.addObject(IdfObject(IddObjectType::Lights)).get();
+
+  ChangeCounter workspaceChanges;
+  ChangeCounter lightsChanges;
+  ChangeCounter lightsDataChanges;
+  ChangeCounter lightsNameChanges;
+  workspace.getImpl<detail::Workspace_Impl>()->onChange.connect<ChangeCounter, &ChangeCounter::change>(&workspaceChanges);
+  lights.getImpl<detail::WorkspaceObject_Impl>()->onChange.connect<ChangeCounter, &ChangeCounter::change>(&lightsChanges);
+  lights.getImpl<detail::WorkspaceObject_Impl>()->onDataChange.connect<ChangeCounter, &ChangeCounter::change>(&lightsDataChanges);
+  lights.getImpl<detail::WorkspaceObject_Impl>()->onNameChange.connect<ChangeCounter, &ChangeCounter::change>(&lightsNameChanges);
+  unsigned lightsChangesInTransaction = 0;
+
+  // object onChange is sent with each edit, the other signals are held back until commit, then sent once
+  {
+    WorkspaceTransaction transaction(workspace);
+    EXPECT_EQ(StrictnessLevel(StrictnessLevel::None), workspace.strictnessLevel());
+    EXPECT_TRUE(zone.setName("Zone 1"));
+    EXPECT_TRUE(lights.setName("Lights 1"));
+    EXPECT_TRUE(lights.setPointer(LightsFields::ZoneorZoneListName, zone.handle()));
+    EXPECT_TRUE(lights.setString(LightsFields::LightingLevel, "100"));
+    EXPECT_EQ(0u, workspaceChanges.m_count);
+    EXPECT_LT(0u, lightsChanges.m_count);
+    EXPECT_EQ(0u, lightsDataChanges.m_count);
+    EXPECT_EQ(0u, lightsNameChanges.m_count);
+    lightsChangesInTransaction = lightsChanges.m_count;
+    EXPECT_TRUE(transaction.commit());
+    EXPECT_FALSE(transaction.isOpen());
+  }
+  EXPECT_EQ(StrictnessLevel(StrictnessLevel::Draft), workspace.strictnessLevel());
+  EXPECT_EQ(1u, workspaceChanges.m_count);
+  EXPECT_EQ(lightsChangesInTransaction, lightsChanges.m_count);
+  EXPECT_EQ(1u, lightsDataChanges.m_count);
+  EXPECT_EQ(1u, lightsNameChanges.m_count);
+  ASSERT_TRUE(lights.getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_EQ(zone.handle(), lights.getTarget(LightsFields::ZoneorZoneListName)->handle());
+
+  // leaving scope without commit rolls back edits, additions and removals
+  workspaceChanges.m_count = 0;
+  lightsChanges.m_count = 0;
+  lightsDataChanges.m_count = 0;
+  lightsNameChanges.m_count = 0;
+  Handle addedHandle;
+  {
+    WorkspaceTransaction transaction(workspace);
+    EXPECT_TRUE(lights.setName("Lights 2"));
+    EXPECT_TRUE(lights.setString(LightsFields::LightingLevel, "200"));
+    addedHandle = workspace.addObject(IdfObject(IddObjectType::Zone)).get().handle();
+    EXPECT_FALSE(zone.remove().empty());
+    EXPECT_FALSE(lights.getTarget(LightsFields::ZoneorZoneListName));
+  }
+  // onChange went out for the edits and for their reversal, nothing else did
+  EXPECT_LT(0u, lightsChanges.m_count);
+  EXPECT_EQ(0u, lightsDataChanges.m_count);
+  EXPECT_EQ(0u, lightsNameChanges.m_count);
+  EXPECT_FALSE(workspace.getObject(addedHandle));
+  ASSERT_EQ(1u, workspace.getObjectsByType(IddObjectType::Zone).size());
+  EXPECT_EQ("Lights 1", lights.name().get());
+  EXPECT_EQ("100", lights.getString(LightsFields::LightingLevel).get());
+  // no handle field, so the restored zone is found by name
+  ASSERT_TRUE(lights.getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_EQ("Zone 1", lights.getTarget(LightsFields::ZoneorZoneListName)->name().get());
+
+  // rolling back an inner transaction rolls back the outer one
+  {
+    WorkspaceTransaction outer(workspace);
+    EXPECT_TRUE(lights.setName("Lights 3"));
+    {
+      WorkspaceTransaction inner(workspace);
+      EXPECT_TRUE(lights.setString(LightsFields::LightingLevel, "300"));
+      inner.rollback();
+    }
+    EXPECT_FALSE(outer.commit());
+  }
+  EXPECT_EQ("Lights 1", lights.name().get());
+  EXPECT_EQ("100", lights.getString(LightsFields::LightingLevel).get());
+  EXPECT_EQ(0u, lightsDataChanges.m_count);
+  EXPECT_EQ(0u, lightsNameChanges.m_count);
+
+  // popped extensible fields are restored in order
+  WorkspaceObject surface = workspace.addObject(IdfObject(IddObjectType::BuildingSurface_Detailed)).get();
+  StringVector vertex;
+  vertex.push_back("1");
+  vertex.push_back("2");
+  vertex.push_back("3");
+  EXPECT_FALSE(surface.pushExtensibleGroup(vertex).empty());
+  {
+    WorkspaceTransaction transaction(workspace);
+    surface.clearExtensibleGroups();
+    EXPECT_EQ(0u, surface.numExtensibleGroups());
+  }
+  ASSERT_EQ(1u, surface.numExtensibleGroups());
+  EXPECT_EQ("1", surface.getExtensibleGroup(0).getString(0).get());
+  EXPECT_EQ("2", surface.getExtensibleGroup(0).getString(1).get());
+  EXPECT_EQ("3", surface.getExtensibleGroup(0).getString(2).get());
+}
+
 TEST_F(IdfFixture,Workspace_Swap) {
   Workspace ws1, ws2;
   ws1.addObject(IdfObject(IddObjectType::OS_Building));
@@ -2177,3 +2340,44 @@ TEST_F(IdfFixture, Workspace_DuplicateObjectName) {
   EXPECT_EQ("Zone Group", zoneGroup1->nameString());
   EXPECT_EQ("Zone Group 1", zoneGroup2->nameString());
 }
+
+TEST_F(IdfFixture, Workspace_ParallelValidityReport) {
+  Workspace ws(StrictnessLevel::None, IddFileType::EnergyPlus);
+  EXPECT_TRUE(ws.parallelValidation());
+
+  // enough objects for the parallel path, with field errors and clashing names, spread over
+  // several types so that workers look up name fields of different idd objects at once
+  IdfObjectVector objects;
+  for (unsigned i = 0; i < 3000; ++i) {
+    IdfObject lights(IddObjectType::Lights);
+    lights.setName("Lights " + std::to_string(i % 1000));
+    if (i % 3 == 0) {
+      lights.setString(LightsFields::ZoneorZoneListName, "Missing Zone");
+    }
+    objects.push_back(lights);
+
+    IdfObject zone(IddObjectType::Zone);
+    zone.setName("Zone " + std::to_string(i % 500));
+    objects.push_back(zone);
+
+    IdfObject surface(IddObjectType::BuildingSurface_Detailed);
+    surface.setName("Surface " + std::to_string(i));
+    surface.setString(BuildingSurface_DetailedFields::ZoneName, "Zone " + std::to_string(i % 700));
+    objects.push_back(surface);
+  }
+  EXPECT_EQ(9000u, ws.addObjects(objects).size());
+
+  for (StrictnessLevel level : {StrictnessLevel::None, StrictnessLevel::Draft, StrictnessLevel::Final}) {
+    ValidityReport parallelReport = ws.validityReport(level);
+    ws.setParallelValidation(false);
+    ValidityReport serialReport = ws.validityReport(level);
+    ws.setParallelValidation(true);
+
+    EXPECT_EQ(serialReport.numErrors(), parallelReport.numErrors());
+    std::stringstream ss1, ss2;
+    ss1 << serialReport;
+    ss2 << parallelReport;
+    EXPECT_EQ(ss1.str(), ss2.str());
+  }
+  EXPECT_FALSE(ws.isValid(StrictnessLevel::Draft));
+}
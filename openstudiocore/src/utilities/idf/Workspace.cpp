@@ -33,6 +33,7 @@
 #include "IdfFile.hpp"
 #include "URLSearchPath.hpp"
 #include "ValidityReport.hpp"
+#include "WorkspaceObjectDiff.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
@@ -45,6 +46,8 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <QtConcurrent>
+
 
 using namespace std;
 using openstudio::istringEqual; // used for all name comparisons
@@ -53,12 +56,88 @@ namespace openstudio {
 
 namespace detail {
 
+  namespace {
+
+    // workspaces smaller than this are checked serially, the thread pool would not pay off
+    const size_t parallelValidityThreshold = 2000;
+
+    const size_t validityChunkSize = 256;
+
+    // a contiguous range of a snapshot of a workspace's objects
+    struct ObjectValidityJob {
+      const Workspace_Impl* workspace;
+      const std::vector<std::shared_ptr<WorkspaceObject_Impl> >* objects;
+      size_t begin;
+      size_t end;
+      StrictnessLevel level;
+    };
+
+    std::vector<DataError> objectValidityErrors(const ObjectValidityJob& job)
+    {
+      std::vector<DataError> result;
+      for (size_t i = job.begin; i < job.end; ++i) {
+        std::vector<DataError> errors = job.workspace->objectValidityErrors((*job.objects)[i], job.level);
+        result.insert(result.end(), errors.begin(), errors.end());
+      }
+      return result;
+    }
+
+  }
+
+  WorkspaceObjectChange::WorkspaceObjectChange(const std::shared_ptr<WorkspaceObject_Impl>& t_object,
+                                               const IddObjectType& t_iddObjectType,
+                                               const Handle& t_handle)
+    : object(t_object), iddObjectType(t_iddObjectType), handle(t_handle)
+  {}
+
+  bool WorkspaceObjectChangeQueue::empty() const {
+    return m_added.empty() && m_removed.empty();
+  }
+
+  void WorkspaceObjectChangeQueue::added(const WorkspaceObjectChange& change) {
+    m_addedIndices[change.handle] = m_added.size();
+    m_added.push_back(change);
+  }
+
+  void WorkspaceObjectChangeQueue::removed(const WorkspaceObjectChange& change) {
+    auto it = m_addedIndices.find(change.handle);
+    if (it != m_addedIndices.end()) {
+      // added and removed within the same batch, nobody needs to hear about it
+      m_added[it->second].object.reset();
+      m_addedIndices.erase(it);
+      return;
+    }
+    m_removed.push_back(change);
+  }
+
+  void WorkspaceObjectChangeQueue::take(std::vector<WorkspaceObjectChange>& added,
+                                        std::vector<WorkspaceObjectChange>& removed)
+  {
+    added.clear();
+    added.reserve(m_addedIndices.size());
+    for (const WorkspaceObjectChange& change : m_added) {
+      if (change.object) {
+        added.push_back(change);
+      }
+    }
+    removed.clear();
+    removed.swap(m_removed);
+    m_added.clear();
+    m_addedIndices.clear();
+  }
+
   // CONSTRUCTORS
 
   Workspace_Impl::Workspace_Impl(StrictnessLevel level,IddFileType iddFileType) :
       m_strictnessLevel(level),
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
+      m_parallelValidation(true),
+      m_notificationBatchDepth(0),
+      m_transactionDepth(0),
+      m_transactionFailed(false),
+      m_transactionChanged(false),
+      m_committingTransaction(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -72,6 +151,12 @@ namespace detail {
       m_header(idfFile.header()),
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
+      m_parallelValidation(true),
+      m_notificationBatchDepth(0),
+      m_transactionDepth(0),
+      m_transactionFailed(false),
+      m_transactionChanged(false),
+      m_committingTransaction(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -84,6 +169,12 @@ namespace detail {
     m_header(other.m_header),
     m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
     m_fastNaming(other.fastNaming()),
+    m_parallelValidation(other.m_parallelValidation),
+    m_notificationBatchDepth(0),
+    m_transactionDepth(0),
+    m_transactionFailed(false),
+    m_transactionChanged(false),
+    m_committingTransaction(false),
     m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -108,6 +199,12 @@ namespace detail {
       m_header(), // subset of original data--discard header
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_parallelValidation(other.m_parallelValidation),
+      m_notificationBatchDepth(0),
+      m_transactionDepth(0),
+      m_transactionFailed(false),
+      m_transactionChanged(false),
+      m_committingTransaction(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -171,6 +268,10 @@ namespace detail {
     m_fastNaming = otherImpl->m_fastNaming;
     otherImpl->m_fastNaming = tfn;
 
+    bool tpv = m_parallelValidation;
+    m_parallelValidation = otherImpl->m_parallelValidation;
+    otherImpl->m_parallelValidation = tpv;
+
     WorkspaceObjectMap twop = m_workspaceObjectMap;
     m_workspaceObjectMap = otherImpl->m_workspaceObjectMap;
     otherImpl->m_workspaceObjectMap = twop;
@@ -199,6 +300,10 @@ namespace detail {
   }
 
   StrictnessLevel Workspace_Impl::strictnessLevel() const {
+    if (m_transactionDepth > 0) {
+      // checked once, on commit
+      return StrictnessLevel::None;
+    }
     return m_strictnessLevel;
   }
 
@@ -555,7 +660,7 @@ namespace detail {
     }
 
     // step 5: check validity
-    if (ok && driverMethod) {
+    if (ok && driverMethod && (m_transactionDepth == 0)) {
       StrictnessLevel level = strictnessLevel();
       if ((objectImplPtrs.size() == numAllObjects()) || (level == StrictnessLevel::Final)) {
         // check whole workspace
@@ -586,9 +691,11 @@ namespace detail {
 
     // step 7: emit signals for successful completion
     if (driverMethod) {
+      startNotificationBatch();
       for (const WorkspaceObject& newObject : newObjects) {
         registerAdditionOfObject(newObject);
       }
+      endNotificationBatch();
     }
 
     return newObjects;
@@ -663,7 +770,9 @@ namespace detail {
 
     // step 6: check validity
     StrictnessLevel level = strictnessLevel();
-    if (ok && driverMethod && (!collectionClone || (level == StrictnessLevel::Final))) {
+    if (ok && driverMethod && (m_transactionDepth == 0) &&
+        (!collectionClone || (level == StrictnessLevel::Final)))
+    {
       if (objectImplPtrs.size() == numObjects()) {
         // check whole workspace
         ok = isValid();
@@ -698,9 +807,11 @@ namespace detail {
 
     // step 8: emit signals for successful completion
     if (driverMethod) {
+      startNotificationBatch();
       for (const WorkspaceObject& newObject : newObjects) {
         registerAdditionOfObject(newObject);
       }
+      endNotificationBatch();
     }
 
     return newObjects;
@@ -1503,18 +1614,23 @@ namespace detail {
       return true;
     } // trivially satisfied
 
-    this->removeWorkspaceObject.nano_emit(WorkspaceObject(objectData->objectImplPtr), objectData->objectImplPtr->iddObject().type(), objectData->handle);
-    this->removeWorkspaceObjectPtr.nano_emit(objectData->objectImplPtr, objectData->objectImplPtr->iddObject().type(), objectData->handle);
+    if (m_transactionDepth > 0) {
+      recordRemovalInTransaction(objectData->objectImplPtr);
+    }
+    emitRemoveWorkspaceObject(objectData->objectImplPtr, objectData->handle);
 
     // actual work of removing from maps--is always successful
     WorkspaceObjectVector sources = nominallyRemoveObject(handle);
 
 
     // can only be invalid if removal results in null and required
-    if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
+    if ((strictnessLevel() < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr,sources,removedHandles);
-      this->onChange.nano_emit();
+      startNotificationBatch();
+      m_notificationQueue.removed(WorkspaceObjectChange(objectData->objectImplPtr, objectData->objectImplPtr->iddObject().type(), handle));
+      endNotificationBatch();
+      this->change();
       return true;
     }
     else {
@@ -1536,17 +1652,26 @@ namespace detail {
       }
     }
 
-    for (SavedWorkspaceObject savedObject : objectData) {
-      this->removeWorkspaceObject.nano_emit(WorkspaceObject(savedObject.objectImplPtr), savedObject.objectImplPtr->iddObject().type(), savedObject.handle);
-      this->removeWorkspaceObjectPtr.nano_emit(savedObject.objectImplPtr, savedObject.objectImplPtr->iddObject().type(), savedObject.handle);
+    if (m_transactionDepth > 0) {
+      for (const SavedWorkspaceObject& savedObject : objectData) {
+        recordRemovalInTransaction(savedObject.objectImplPtr);
+      }
+    }
+    for (const SavedWorkspaceObject& savedObject : objectData) {
+      emitRemoveWorkspaceObject(savedObject.objectImplPtr, savedObject.handle);
     }
 
     // actual work of removing from maps--is always successful
     std::vector<WorkspaceObjectVector> sources = nominallyRemoveObjects(handles);
 
-    if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
+    if ((strictnessLevel() < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData,sources,handles);
-      this->onChange.nano_emit();
+      startNotificationBatch();
+      for (const SavedWorkspaceObject& savedObject : objectData) {
+        m_notificationQueue.removed(WorkspaceObjectChange(savedObject.objectImplPtr, savedObject.objectImplPtr->iddObject().type(), savedObject.handle));
+      }
+      endNotificationBatch();
+      this->change();
       return true;
     }
     else {
@@ -1748,13 +1873,42 @@ namespace detail {
     map<string,pair<bool,std::shared_ptr<WorkspaceObject_Impl> > > mapOfNames;
     map<string,list <std::shared_ptr<WorkspaceObject_Impl> > > objectsRepeatNames;
 
+    // snapshot of the objects, which the checks below only read
+    std::vector<std::shared_ptr<WorkspaceObject_Impl> > objects;
+    objects.reserve(m_workspaceObjectMap.size());
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      objects.push_back(p.second);
+    }
+
+    // object-local checks, in chunks merged back in snapshot order so the report does not depend
+    // on how the chunks were scheduled
+    std::vector<ObjectValidityJob> jobs;
+    for (size_t begin = 0; begin < objects.size(); begin += validityChunkSize) {
+      ObjectValidityJob job = {this, &objects, begin, std::min(begin + validityChunkSize, objects.size()), level};
+      jobs.push_back(job);
+    }
+    std::vector<std::vector<DataError> > objectErrors;
+    if (m_parallelValidation && (objects.size() >= parallelValidityThreshold)) {
+      objectErrors = QtConcurrent::blockingMapped<std::vector<std::vector<DataError> > >(jobs, &objectValidityErrors);
+    }
+    else {
+      for (const ObjectValidityJob& job : jobs) {
+        objectErrors.push_back(objectValidityErrors(job));
+      }
+    }
+    for (const std::vector<DataError>& errors : objectErrors) {
+      for (const DataError& error : errors) {
+        report.insertError(error);
+      }
+    }
+
     // by-object items
-    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap)
+    for (const std::shared_ptr<WorkspaceObject_Impl>& object : objects)
     {
 
       //find all objects with the same name
 
-      OptionalString oName = p.second->name();
+      OptionalString oName = object->name();
       if(oName)
       {
         auto itr = mapOfNames.find(*oName);
@@ -1766,7 +1920,7 @@ namespace detail {
             itr->second.first=true;
             list<std::shared_ptr<WorkspaceObject_Impl> > l;
             l.push_front(itr->second.second);
-            l.push_front(p.second);
+            l.push_front(object);
             objectsRepeatNames[itr->first] = l;
           }
           else
@@ -1774,40 +1928,15 @@ namespace detail {
 
             auto j= objectsRepeatNames.find(itr->first);
             OS_ASSERT(j!=objectsRepeatNames.end());
-            j->second.push_front( p.second );
+            j->second.push_front( object );
           }
         }
         else
         {
-          mapOfNames[*oName] = pair<bool,std::shared_ptr<WorkspaceObject_Impl> >(false,p.second);
+          mapOfNames[*oName] = pair<bool,std::shared_ptr<WorkspaceObject_Impl> >(false,object);
         }
       }
 
-
-      // object-level report
-      ValidityReport objectReport = p.second->validityReport(level,false);
-      OptionalDataError oError = objectReport.nextError();
-      while (oError) {
-        report.insertError(*oError);
-        oError = objectReport.nextError();
-      }
-
-      // StrictnessLevel::Draft
-      if (level > StrictnessLevel::None) {
-        // DataErrorType::NoIdd
-        // object-level
-        if (iddFileType() == IddFileType::UserCustom) {
-          if (!m_iddFileAndFactoryWrapper.isInFile(p.second->iddObject().name())) {
-            report.insertError(DataError(WorkspaceObject(p.second),DataErrorType(DataErrorType::NoIdd)));
-          }
-        }
-        else {
-          if (!m_iddFileAndFactoryWrapper.isInFile(p.second->iddObject().type())) {
-            report.insertError(DataError(WorkspaceObject(p.second),DataErrorType(DataErrorType::NoIdd)));
-          }
-        }
-      } // StrictnessLevel::Draft
-
       this->progressValue.nano_emit(++i);
     }
 
@@ -1869,6 +1998,46 @@ namespace detail {
     return report;
   }
 
+  std::vector<DataError> Workspace_Impl::objectValidityErrors(const std::shared_ptr<WorkspaceObject_Impl>& object,
+                                                              StrictnessLevel level) const
+  {
+    std::vector<DataError> result;
+
+    // object-level report
+    ValidityReport objectReport = object->validityReport(level,false);
+    OptionalDataError oError = objectReport.nextError();
+    while (oError) {
+      result.push_back(*oError);
+      oError = objectReport.nextError();
+    }
+
+    // StrictnessLevel::Draft
+    if (level > StrictnessLevel::None) {
+      // DataErrorType::NoIdd
+      // object-level
+      if (iddFileType() == IddFileType::UserCustom) {
+        if (!m_iddFileAndFactoryWrapper.isInFile(object->iddObject().name())) {
+          result.push_back(DataError(WorkspaceObject(object),DataErrorType(DataErrorType::NoIdd)));
+        }
+      }
+      else {
+        if (!m_iddFileAndFactoryWrapper.isInFile(object->iddObject().type())) {
+          result.push_back(DataError(WorkspaceObject(object),DataErrorType(DataErrorType::NoIdd)));
+        }
+      }
+    } // StrictnessLevel::Draft
+
+    return result;
+  }
+
+  bool Workspace_Impl::parallelValidation() const {
+    return m_parallelValidation;
+  }
+
+  void Workspace_Impl::setParallelValidation(bool parallelValidation) {
+    m_parallelValidation = parallelValidation;
+  }
+
   IdfObject Workspace_Impl::versionObjectToAdd() const {
     OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
     if (!versionIdd) {
@@ -2348,12 +2517,274 @@ namespace detail {
     }
   }
 
-  void Workspace_Impl::registerAdditionOfObject(const WorkspaceObject& object) {
+  void Workspace_Impl::registerAdditionOfObject(const WorkspaceObject& object, bool batchNotification) {
     object.getImpl<WorkspaceObject_Impl>().get()->WorkspaceObject_Impl::onChange.connect<Workspace_Impl, &Workspace_Impl::change>(this);
     auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
-    this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
-    this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
-    this->onChange.nano_emit();
+    IddObjectType type = object.iddObject().type();
+    Handle handle = object.handle();
+    this->addWorkspaceObject.nano_emit(object, type, handle);
+    this->addWorkspaceObjectPtr.nano_emit(sh_ptr, type, handle);
+    auto it = m_addWorkspaceObjectPtrSignals.find(type);
+    if (it != m_addWorkspaceObjectPtrSignals.end()) {
+      it->second.nano_emit(sh_ptr, type, handle);
+    }
+    if (batchNotification) {
+      startNotificationBatch();
+      m_notificationQueue.added(WorkspaceObjectChange(sh_ptr, type, handle));
+      endNotificationBatch();
+      if (m_transactionDepth > 0) {
+        m_transactionAddedHandles.insert(handle);
+      }
+    }
+    this->change();
+  }
+
+  void Workspace_Impl::emitRemoveWorkspaceObject(const std::shared_ptr<WorkspaceObject_Impl>& ptr, const Handle& handle) {
+    IddObjectType type = ptr->iddObject().type();
+    this->removeWorkspaceObject.nano_emit(WorkspaceObject(ptr), type, handle);
+    this->removeWorkspaceObjectPtr.nano_emit(ptr, type, handle);
+    auto it = m_removeWorkspaceObjectPtrSignals.find(type);
+    if (it != m_removeWorkspaceObjectPtrSignals.end()) {
+      it->second.nano_emit(ptr, type, handle);
+    }
+  }
+
+  Workspace_Impl::WorkspaceObjectPtrSignal& Workspace_Impl::removeWorkspaceObjectPtrSignal(const IddObjectType& type) const {
+    return m_removeWorkspaceObjectPtrSignals[type];
+  }
+
+  Workspace_Impl::WorkspaceObjectPtrSignal& Workspace_Impl::addWorkspaceObjectPtrSignal(const IddObjectType& type) const {
+    return m_addWorkspaceObjectPtrSignals[type];
+  }
+
+  void Workspace_Impl::startNotificationBatch() {
+    ++m_notificationBatchDepth;
+  }
+
+  void Workspace_Impl::endNotificationBatch() {
+    OS_ASSERT(m_notificationBatchDepth > 0);
+    if (--m_notificationBatchDepth > 0) {
+      return;
+    }
+    if (m_notificationQueue.empty()) {
+      return;
+    }
+    std::vector<WorkspaceObjectChange> added;
+    std::vector<WorkspaceObjectChange> removed;
+    m_notificationQueue.take(added, removed);
+    // removals first, so an object removed and then re-added (e.g. by undo) ends up present
+    if (!removed.empty()) {
+      this->removeWorkspaceObjects.nano_emit(removed);
+    }
+    if (!added.empty()) {
+      this->addWorkspaceObjects.nano_emit(added);
+    }
+  }
+
+  void Workspace_Impl::startTransaction() {
+    if (m_transactionDepth == 0) {
+      startNotificationBatch();
+    }
+    ++m_transactionDepth;
+  }
+
+  bool Workspace_Impl::commitTransaction() {
+    OS_ASSERT(m_transactionDepth > 0);
+    if (m_transactionDepth > 1) {
+      --m_transactionDepth;
+      return !m_transactionFailed;
+    }
+
+    bool ok = !m_transactionFailed;
+    if (ok && (m_strictnessLevel > StrictnessLevel::None)) {
+      ValidityReport report = validityReport(m_strictnessLevel);
+      if (report.numErrors() > 0) {
+        LOG(Info,"Rolling back Workspace transaction. The validity report is: " << std::endl << report);
+        ok = false;
+      }
+    }
+
+    if (ok) {
+      // one set of name, data and relationship signals per changed object, onChange was emitted
+      // with each change; removed objects have nothing left to report
+      m_committingTransaction = true;
+      for (const std::shared_ptr<WorkspaceObject_Impl>& ptr : m_transactionObjects) {
+        if (!ptr->handle().isNull()) {
+          ptr->emitDiffSignals();
+        }
+        ptr->m_diffs.clear();
+      }
+      m_committingTransaction = false;
+    }
+    else {
+      rollbackTransactionChanges();
+    }
+
+    finishTransaction();
+    return ok;
+  }
+
+  void Workspace_Impl::rollbackTransaction() {
+    OS_ASSERT(m_transactionDepth > 0);
+    if (m_transactionDepth > 1) {
+      --m_transactionDepth;
+      m_transactionFailed = true;
+      return;
+    }
+    rollbackTransactionChanges();
+    finishTransaction();
+  }
+
+  bool Workspace_Impl::inTransaction() const {
+    return (m_transactionDepth > 0);
+  }
+
+  bool Workspace_Impl::deferChangeSignals(WorkspaceObject_Impl& object) {
+    if ((m_transactionDepth == 0) || m_committingTransaction) {
+      return false;
+    }
+    if (m_transactionObjectSet.insert(&object).second) {
+      m_transactionObjects.push_back(std::static_pointer_cast<WorkspaceObject_Impl>(object.shared_from_this()));
+    }
+    return true;
+  }
+
+  void Workspace_Impl::recordRemovalInTransaction(const std::shared_ptr<WorkspaceObject_Impl>& ptr) {
+    if (m_transactionAddedHandles.erase(ptr->handle()) > 0) {
+      // did not exist before the transaction
+      return;
+    }
+
+    // standalone copy with pointers written out as text, then undo the transaction's edits
+    IdfObject copy = WorkspaceObject(ptr).idfObject();
+    std::vector<std::string> fields;
+    std::vector<std::string> fieldComments;
+    for (unsigned i = 0, n = copy.numFields(); i < n; ++i) {
+      fields.push_back(copy.getString(i, false, true).get());
+      fieldComments.push_back(copy.fieldComment(i).get_value_or(std::string()));
+    }
+    for (auto it = ptr->m_diffs.rbegin(), itEnd = ptr->m_diffs.rend(); it != itEnd; ++it) {
+      OptionalUnsigned index = it->index();
+      if (!index) {
+        continue;
+      }
+      OptionalString oldValue = it->oldValue();
+      if (!oldValue) {
+        // field was added
+        if (*index < fields.size()) {
+          fields.resize(*index);
+          fieldComments.resize(*index);
+        }
+        continue;
+      }
+      if (*index >= fields.size()) {
+        fields.resize(*index + 1);
+        fieldComments.resize(*index + 1);
+      }
+      fields[*index] = *oldValue;
+    }
+
+    IdfObject_ImplPtr original(new IdfObject_Impl(copy.handle(), copy.comment(), copy.iddObject(), fields, fieldComments));
+    m_transactionRemovedObjects.push_back(IdfObject(original));
+  }
+
+  void Workspace_Impl::revertTransactionChanges(WorkspaceObject_Impl& object) {
+    // copy, reverting records diffs of its own
+    std::vector<IdfObjectDiff> diffs = object.m_diffs;
+    for (auto it = diffs.rbegin(), itEnd = diffs.rend(); it != itEnd; ++it) {
+      OptionalUnsigned index = it->index();
+      if (!index) {
+        // comment change, old comment not recorded
+        continue;
+      }
+      OptionalString oldValue = it->oldValue();
+      if (!oldValue) {
+        // field was added
+        if (*index < object.numFields()) {
+          object.restoreOriginalNumFields(*index);
+        }
+        continue;
+      }
+      bool ok = false;
+      if (boost::optional<WorkspaceObjectDiff> pointerDiff = it->optionalCast<WorkspaceObjectDiff>()) {
+        OptionalHandle oldHandle = pointerDiff->oldHandle();
+        if (oldHandle && (oldHandle->isNull() || getObject(*oldHandle))) {
+          ok = object.setPointer(*index, *oldHandle, false);
+        }
+      }
+      if (!ok) {
+        // data field, or target restored under a new handle: look up by name
+        ok = object.setString(*index, *oldValue, false);
+      }
+      if (!ok) {
+        LOG(Warn,"Unable to restore field " << *index << " of " << object.briefDescription()
+            << " to '" << *oldValue << "' while rolling back a Workspace transaction.");
+      }
+    }
+  }
+
+  void Workspace_Impl::rollbackTransactionChanges() {
+    std::vector<std::shared_ptr<WorkspaceObject_Impl> > touchedObjects;
+    touchedObjects.swap(m_transactionObjects);
+    m_transactionObjectSet.clear();
+    // left in place so removing these below does not record them
+    std::vector<Handle> addedHandles(m_transactionAddedHandles.begin(), m_transactionAddedHandles.end());
+    std::vector<IdfObject> removedObjects;
+    removedObjects.swap(m_transactionRemovedObjects);
+
+    // bring back removed objects first so reverted pointers have targets. IDD's with a handle
+    // field keep their handles.
+    if (!removedObjects.empty()) {
+      WorkspaceObjectVector restored = addObjects(removedObjects, false);
+      if (restored.size() != removedObjects.size()) {
+        LOG(Warn,"Unable to restore the " << removedObjects.size() << " objects removed during a "
+            << "rolled back Workspace transaction.");
+      }
+    }
+
+    for (auto it = touchedObjects.rbegin(), itEnd = touchedObjects.rend(); it != itEnd; ++it) {
+      if (!(*it)->handle().isNull()) {
+        revertTransactionChanges(**it);
+      }
+    }
+
+    HandleVector toRemove;
+    for (const Handle& handle : addedHandles) {
+      if (getObject(handle)) {
+        toRemove.push_back(handle);
+      }
+    }
+    if (!toRemove.empty()) {
+      removeObjects(toRemove);
+    }
+
+    // only onChange went out for the edits, it goes out again for their reversal so cached values
+    // are cleared, the other signals were never emitted
+    for (const std::shared_ptr<WorkspaceObject_Impl>& ptr : touchedObjects) {
+      ptr->m_diffs.clear();
+    }
+    for (const std::shared_ptr<WorkspaceObject_Impl>& ptr : m_transactionObjects) {
+      ptr->m_diffs.clear();
+    }
+    for (const std::shared_ptr<WorkspaceObject_Impl>& ptr : touchedObjects) {
+      if (!ptr->handle().isNull()) {
+        ptr->onChange.nano_emit();
+      }
+    }
+  }
+
+  void Workspace_Impl::finishTransaction() {
+    m_transactionObjects.clear();
+    m_transactionObjectSet.clear();
+    m_transactionAddedHandles.clear();
+    m_transactionRemovedObjects.clear();
+    m_transactionFailed = false;
+    m_transactionDepth = 0;
+    endNotificationBatch();
+    if (m_transactionChanged) {
+      m_transactionChanged = false;
+      this->onChange.nano_emit();
+    }
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
@@ -2377,8 +2808,8 @@ namespace detail {
     // Connect signals
     WorkspaceObject workspaceObject(savedObject.objectImplPtr);
 
-    // emit signals
-    registerAdditionOfObject(workspaceObject);
+    // emit signals; the removal was never reported to the batched signals, so neither is this
+    registerAdditionOfObject(workspaceObject, false);
   }
 
   void Workspace_Impl::restoreObjects(SavedWorkspaceObjectVector& savedObjects) {
@@ -2658,6 +3089,10 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    if (m_transactionDepth > 0) {
+      m_transactionChanged = true;
+      return;
+    }
     this->onChange.nano_emit();
   }
 
@@ -3023,6 +3458,14 @@ ValidityReport Workspace::validityReport(StrictnessLevel level) const {
   return m_impl->validityReport(level);
 }
 
+bool Workspace::parallelValidation() const {
+  return m_impl->parallelValidation();
+}
+
+void Workspace::setParallelValidation(bool parallelValidation) {
+  m_impl->setParallelValidation(parallelValidation);
+}
+
 bool Workspace::operator==(const Workspace& other) const {
   return (m_impl == other.m_impl);
 }
@@ -3061,6 +3504,10 @@ bool Workspace::save(const openstudio::path& p, bool overwrite) {
   return m_impl->save(p,overwrite);
 }
 
+bool Workspace::saveBinary(const openstudio::path& p, bool overwrite) {
+  return m_impl->toIdfFile().saveBinary(p,overwrite);
+}
+
 boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
   OptionalIdfFile oIdfFile = IdfFile::load(p);
   if (oIdfFile) {
@@ -403,6 +403,12 @@ class UTILITIES_API Workspace {
   /** Returns a ValidityReport for this Workspace containing all errors at or below level. */
   ValidityReport validityReport(StrictnessLevel level) const;
 
+  /** Returns true if validityReport checks the objects of large Workspaces in parallel. */
+  bool parallelValidation() const;
+
+  /** Turns parallel object checks in validityReport on or off. The report does not change. */
+  void setParallelValidation(bool parallelValidation);
+
   bool operator==(const Workspace& other) const;
 
   bool operator!=(const Workspace& other) const;
@@ -417,6 +423,10 @@ class UTILITIES_API Workspace {
    *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
   bool save(const openstudio::path& p, bool overwrite=false);
 
+  /** Save this Workspace to path p in the binary IdfFile format, see IdfFile::printBinary. The
+   *  path-based load methods read the result transparently. */
+  bool saveBinary(const openstudio::path& p, bool overwrite=false);
+
   /** Load a Workspace from path using the IddFactory, and choosing iddFileType based on file
    *  extension, if possible. (IddFileType::OpenStudio if extension is modelFileExtension() or
    *  componentFileExtension(), IddFileType::EnergyPlus otherwise.) */
@@ -908,51 +908,14 @@ namespace detail {
       return;
     }
 
-    bool nameChange = false;
-    bool dataChange = false;
-
-    for (const IdfObjectDiff& diff : m_diffs){
-
-      if (diff.isNull()){
-        continue;
-      }
-
-      boost::optional<unsigned> index = diff.index();
-      if (index){
-
-        OptionalIddField oIddField = iddObject().getField(*index);
-
-        if (oIddField && oIddField->isObjectListField() && diff.optionalCast<WorkspaceObjectDiff>()) {
-
-          WorkspaceObjectDiff workspaceObjectDiff = diff.cast<WorkspaceObjectDiff>();
-
-          Handle newHandle;
-          if (workspaceObjectDiff.newHandle()){
-            newHandle = workspaceObjectDiff.newHandle().get();
-          }
-
-          Handle oldHandle;
-          if (workspaceObjectDiff.oldHandle()){
-            oldHandle = workspaceObjectDiff.oldHandle().get();
-          }
-
-          this->onRelationshipChange.nano_emit(*index, newHandle, oldHandle);
-
-        } else if (oIddField && oIddField->isNameField()) {
-          nameChange = true;
-        } else {
-          dataChange = true;
-        }
-      }
+    // inside a transaction onChange goes out right away so cached values stay current, the diffs
+    // accumulate and the other signals are emitted once when the transaction commits
+    if (m_initialized && m_workspace && m_workspace->deferChangeSignals(*this)){
+      this->onChange.nano_emit();
+      return;
     }
 
-    if (nameChange){
-      this->onNameChange.nano_emit();
-    }
-
-    if (dataChange){
-      this->onDataChange.nano_emit();
-    }
+    emitDiffSignals();
 
     this->onChange.nano_emit();
 
@@ -1126,6 +1089,55 @@ namespace detail {
     return boost::none;
   }
 
+  void WorkspaceObject_Impl::emitDiffSignals()
+  {
+    bool nameChange = false;
+    bool dataChange = false;
+
+    for (const IdfObjectDiff& diff : m_diffs){
+
+      if (diff.isNull()){
+        continue;
+      }
+
+      boost::optional<unsigned> index = diff.index();
+      if (index){
+
+        OptionalIddField oIddField = iddObject().getField(*index);
+
+        if (oIddField && oIddField->isObjectListField() && diff.optionalCast<WorkspaceObjectDiff>()) {
+
+          WorkspaceObjectDiff workspaceObjectDiff = diff.cast<WorkspaceObjectDiff>();
+
+          Handle newHandle;
+          if (workspaceObjectDiff.newHandle()){
+            newHandle = workspaceObjectDiff.newHandle().get();
+          }
+
+          Handle oldHandle;
+          if (workspaceObjectDiff.oldHandle()){
+            oldHandle = workspaceObjectDiff.oldHandle().get();
+          }
+
+          this->onRelationshipChange.nano_emit(*index, newHandle, oldHandle);
+
+        } else if (oIddField && oIddField->isNameField()) {
+          nameChange = true;
+        } else {
+          dataChange = true;
+        }
+      }
+    }
+
+    if (nameChange){
+      this->onNameChange.nano_emit();
+    }
+
+    if (dataChange){
+      this->onDataChange.nano_emit();
+    }
+  }
+
   void WorkspaceObject_Impl::restoreOriginalNumFields(unsigned n) {
     bool popResult = true;
     while (popResult && (numFields() > n)) {
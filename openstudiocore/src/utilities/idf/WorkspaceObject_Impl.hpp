@@ -281,7 +281,8 @@ namespace detail {
     /** @name Signal Helpers */
     //@{
 
-    /** Emits signals after batch update and error checking is complete, clears the diffs */
+    /** Emits signals after batch update and error checking is complete, clears the diffs. Inside
+     *  a WorkspaceTransaction only onChange is emitted and the diffs are kept until commit. */
     virtual void emitChangeSignals() override;
 
     //@}
@@ -358,6 +359,9 @@ namespace detail {
 
     bool popField();
 
+    /** Emits onRelationshipChange, onNameChange and onDataChange for the current diffs. */
+    void emitDiffSignals();
+
     // configure logging
     REGISTER_LOGGER("utilities.idf.WorkspaceObject");
   };
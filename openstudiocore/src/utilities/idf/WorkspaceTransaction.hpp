@@ -0,0 +1,83 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_WORKSPACETRANSACTION_HPP
+#define UTILITIES_IDF_WORKSPACETRANSACTION_HPP
+
+#include <utilities/UtilitiesAPI.hpp>
+#include <utilities/idf/Workspace.hpp>
+
+namespace openstudio{
+
+/** WorkspaceTransaction groups a bulk edit of a Workspace. While it is open, objects hold back
+ *  onNameChange, onDataChange and onRelationshipChange, and the Workspace does not check validity
+ *  on each edit, reporting StrictnessLevel::None instead. Object onChange is still emitted with
+ *  each edit, so values cached from an object's data stay current inside the transaction. commit()
+ *  checks validity once at the Workspace's strictness level; if valid, each changed object emits
+ *  one set of the held back signals and the Workspace emits onChange once, otherwise all edits are
+ *  rolled back and the restored objects emit onChange. Signals for added and removed objects are
+ *  sent as usual, with the batched ones sent once on close.
+ *
+ *  A transaction that goes out of scope without commit() is rolled back. Transactions nest, but
+ *  only the outermost one commits or rolls back; rolling back an inner one makes the outermost
+ *  one roll back too.
+ *
+ *  Rollback restores field values recorded in the objects' diffs, removes objects added during the
+ *  transaction, and re-adds objects removed during it. Re-added objects are new objects; they keep
+ *  their handles only if their IDD has a handle field. Object comments are not restored.
+ **/
+class UTILITIES_API WorkspaceTransaction {
+
+ public:
+
+  explicit WorkspaceTransaction(const Workspace& workspace);
+
+  /// rolls back if still open
+  ~WorkspaceTransaction();
+
+  /// closes the transaction, returns false if its edits were rolled back
+  bool commit();
+
+  /// closes the transaction and discards its edits
+  void rollback();
+
+  /// true until commit or rollback is called
+  bool isOpen() const;
+
+ private:
+
+  WorkspaceTransaction(const WorkspaceTransaction& other);
+  WorkspaceTransaction& operator=(const WorkspaceTransaction& other);
+
+  Workspace m_workspace;
+  bool m_open;
+};
+
+}
+#endif
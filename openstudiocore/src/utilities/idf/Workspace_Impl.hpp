@@ -50,6 +50,7 @@
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio {
 
@@ -61,6 +62,42 @@ class URLSearchPath;
 // private namespace
 namespace detail {
 
+  /** An object added to or removed from a Workspace, as delivered by the batched signals
+   *  Workspace_Impl::addWorkspaceObjects and Workspace_Impl::removeWorkspaceObjects. The handle is
+   *  recorded separately because a removed object no longer reports it. */
+  struct UTILITIES_API WorkspaceObjectChange {
+    WorkspaceObjectChange(const std::shared_ptr<WorkspaceObject_Impl>& t_object,
+                          const IddObjectType& t_iddObjectType,
+                          const Handle& t_handle);
+
+    std::shared_ptr<WorkspaceObject_Impl> object;
+    IddObjectType iddObjectType;
+    Handle handle;
+  };
+
+  /** Accumulates added and removed objects for batched delivery. An object that is added and
+   *  then removed before the queue is taken is dropped from both lists. */
+  class UTILITIES_API WorkspaceObjectChangeQueue {
+   public:
+
+    bool empty() const;
+
+    void added(const WorkspaceObjectChange& change);
+
+    void removed(const WorkspaceObjectChange& change);
+
+    /** Moves the pending changes into added and removed, in the order they were queued, and clears
+     *  the queue. */
+    void take(std::vector<WorkspaceObjectChange>& added, std::vector<WorkspaceObjectChange>& removed);
+
+   private:
+
+    std::vector<WorkspaceObjectChange> m_added;
+    std::vector<WorkspaceObjectChange> m_removed;
+    // position in m_added of each pending addition, cancelled entries have a null object
+    std::unordered_map<Handle, size_t, boost::hash<boost::uuids::uuid> > m_addedIndices;
+  };
+
   /** Implementation of Workspace. Maintains object handles and relationships. Locks down
    *  relationship fields in its IdfObjects if possible. */
   class UTILITIES_API Workspace_Impl : public std::enable_shared_from_this<Workspace_Impl>,
@@ -425,6 +462,18 @@ namespace detail {
     /** Returns a ValidityReport for this Workspace containing all errors at or below level. */
     virtual ValidityReport validityReport(StrictnessLevel level) const;
 
+    /** Object-local part of validityReport: field, object and Idd membership errors for object,
+     *  in the order validityReport inserts them. Only reads, so it may run concurrently for
+     *  different objects while the Workspace is not being modified. */
+    std::vector<DataError> objectValidityErrors(const std::shared_ptr<WorkspaceObject_Impl>& object,
+                                                StrictnessLevel level) const;
+
+    /** If true (the default), validityReport checks large Workspaces' objects on the global thread
+     *  pool. The resulting report is the same either way. */
+    bool parallelValidation() const;
+
+    void setParallelValidation(bool parallelValidation);
+
     /** Returns an IdfObject based on the Version IddObject appropriate for this Workspace. No
      *  public interface. Used in constructing Workspaces. */
     IdfObject versionObjectToAdd() const;
@@ -447,6 +496,29 @@ namespace detail {
      const openstudio::path &t_infile, const openstudio::path &t_locationForRemoteUrls = openstudio::path());
 
     //@}
+    /** @name Transactions */
+    //@{
+
+    /** Opens a transaction, see WorkspaceTransaction. Transactions nest. While one is open,
+     *  strictnessLevel() reports StrictnessLevel::None and object change signals other than
+     *  onChange are held back. */
+    void startTransaction();
+
+    /** Closes the innermost transaction. Closing the outermost one validates the Workspace once
+     *  at its strictness level and emits the held back signals, or rolls back if the Workspace is
+     *  not valid or an inner transaction was rolled back. Returns false if rolled back. */
+    bool commitTransaction();
+
+    /** Closes the innermost transaction and discards the changes made in the outermost one. The
+     *  rollback happens when the outermost transaction closes. */
+    void rollbackTransaction();
+
+    bool inTransaction() const;
+
+    /** Called by WorkspaceObject_Impl::emitChangeSignals. Returns true if object's name, data and
+     *  relationship signals are to be held back until the transaction commits, in which case its
+     *  diffs are kept. */
+    bool deferChangeSignals(WorkspaceObject_Impl& object);
 
     //@}
     /** @name Nano Signals */
@@ -484,6 +556,34 @@ namespace detail {
     // DLM: deprecate this version
     // void addWorkspaceObjectPtr(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) const;
     mutable Nano::Signal<void(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&)> addWorkspaceObjectPtr;
+
+    /** Sends all objects removed by one call to removeObjects, or by all calls made between
+     *  startNotificationBatch and endNotificationBatch. Emitted after the objects are removed. */
+    // void removeWorkspaceObjects(const std::vector<WorkspaceObjectChange>& changes) const;
+    mutable Nano::Signal<void(const std::vector<WorkspaceObjectChange>&)> removeWorkspaceObjects;
+
+    /** Sends all objects added by one call to addObjects, insertObjects, etc., or by all calls
+     *  made between startNotificationBatch and endNotificationBatch. */
+    // void addWorkspaceObjects(const std::vector<WorkspaceObjectChange>& changes) const;
+    mutable Nano::Signal<void(const std::vector<WorkspaceObjectChange>&)> addWorkspaceObjects;
+
+    typedef Nano::Signal<void(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&)> WorkspaceObjectPtrSignal;
+
+    /** Same as removeWorkspaceObjectPtr, but only emitted for objects of type. Subscribing here
+     *  rather than filtering removeWorkspaceObjectPtr keeps other types off the subscriber. */
+    WorkspaceObjectPtrSignal& removeWorkspaceObjectPtrSignal(const IddObjectType& type) const;
+
+    /** Same as addWorkspaceObjectPtr, but only emitted for objects of type. */
+    WorkspaceObjectPtrSignal& addWorkspaceObjectPtrSignal(const IddObjectType& type) const;
+
+    /** Holds addWorkspaceObjects and removeWorkspaceObjects until the matching
+     *  endNotificationBatch, so a bulk edit is delivered as one event of each kind. Batches nest.
+     *  The per-object signals are not affected. */
+    void startNotificationBatch();
+
+    /** Ends a batch started by startNotificationBatch. Emits the pending batched signals when the
+     *  outermost batch ends. */
+    void endNotificationBatch();
     //@}
 
 
@@ -513,6 +613,28 @@ namespace detail {
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper; // IDD file to be used for validity checking
     bool m_fastNaming;
 
+    bool m_parallelValidation;
+
+    // pending changes for addWorkspaceObjects and removeWorkspaceObjects
+    unsigned m_notificationBatchDepth;
+    WorkspaceObjectChangeQueue m_notificationQueue;
+
+    // open transaction, see startTransaction
+    unsigned m_transactionDepth;
+    bool m_transactionFailed;
+    bool m_transactionChanged;
+    bool m_committingTransaction;
+    // objects whose name, data and relationship signals are held back, in order of first change
+    std::vector<std::shared_ptr<WorkspaceObject_Impl> > m_transactionObjects;
+    std::unordered_set<const WorkspaceObject_Impl*> m_transactionObjectSet;
+    std::unordered_set<Handle, boost::hash<boost::uuids::uuid> > m_transactionAddedHandles;
+    // data of objects removed during the transaction, as it was before the transaction
+    std::vector<IdfObject> m_transactionRemovedObjects;
+
+    // per type signals, created on first subscription
+    mutable std::map<IddObjectType, WorkspaceObjectPtrSignal> m_addWorkspaceObjectPtrSignals;
+    mutable std::map<IddObjectType, WorkspaceObjectPtrSignal> m_removeWorkspaceObjectPtrSignals;
+
     typedef std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, boost::hash<boost::uuids::uuid> > WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
 
@@ -602,7 +724,19 @@ namespace detail {
 
     void registerRemovalOfObjects(std::vector<SavedWorkspaceObject>& savedObjects,const std::vector<std::vector<WorkspaceObject> >& sources,const std::vector<Handle>& removedHandles);
 
-    void registerAdditionOfObject(const WorkspaceObject& object);
+    void registerAdditionOfObject(const WorkspaceObject& object, bool batchNotification = true);
+
+    void emitRemoveWorkspaceObject(const std::shared_ptr<WorkspaceObject_Impl>& ptr, const Handle& handle);
+
+    // saves the pre-transaction data of an object about to be removed during a transaction
+    void recordRemovalInTransaction(const std::shared_ptr<WorkspaceObject_Impl>& ptr);
+
+    // undoes the field changes recorded in object's diffs, without validity checks
+    void revertTransactionChanges(WorkspaceObject_Impl& object);
+
+    void rollbackTransactionChanges();
+
+    void finishTransaction();
 
     // QUERIES
 
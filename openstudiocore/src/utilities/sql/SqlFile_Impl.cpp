@@ -2132,12 +2132,7 @@ namespace openstudio{
         int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
         code = sqlite3_step(sqlStmtPtr);
-        std::stringstream s2;
-        s2 << "SQL Query:" << std::endl;
-        s2 << s.str();
-        s2 << "Return Code:" << std::endl;
-        s2 << code;
-        LOG(Debug, s2.str());
+        LOG(Debug, "SQL Query:" << std::endl << s.str() << "Return Code:" << std::endl << code);
         while (code == SQLITE_ROW)
         {
           stdValues.push_back( sqlite3_column_double(sqlStmtPtr, 0) ); // values
@@ -2459,12 +2454,7 @@ namespace openstudio{
         int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
         code = sqlite3_step(sqlStmtPtr);
-        std::stringstream s2;
-        s2 << "SQL Query:" << std::endl;
-        s2 << s.str();
-        s2 << "Return Code:" << std::endl;
-        s2 << code;
-        LOG(Debug, s2.str());
+        LOG(Debug, "SQL Query:" << std::endl << s.str() << "Return Code:" << std::endl << code);
 
         long cumulativeSeconds = 0;
 
@@ -2583,12 +2573,7 @@ namespace openstudio{
         int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
         code = sqlite3_step(sqlStmtPtr);
-        std::stringstream s2;
-        s2 << "SQL Query:" << std::endl;
-        s2 << s.str() << std::endl;
-        s2 << "Return Code:" << std::endl;
-        s2 << code;
-        LOG(Debug, s2.str());
+        LOG(Debug, "SQL Query:" << std::endl << s.str() << std::endl << "Return Code:" << std::endl << code);
         while (code == SQLITE_ROW) {
           boost::optional<unsigned> year;
           unsigned month, day, hour, minute;//, simulationDay;
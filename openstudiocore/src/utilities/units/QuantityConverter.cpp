@@ -44,6 +44,9 @@
 #include "WhUnit.hpp"
 
 #include "../core/Assert.hpp"
+#include "../data/TimeSeries.hpp"
+
+#include <mutex>
 
 namespace openstudio {
 
@@ -507,32 +510,174 @@ boost::optional<Quantity> QuantityConverterSingleton::m_convertToTargetFromSI(
   return converted;
 }
 
+namespace detail {
+
+  /** UnitFactory and QuantityConverter are not synchronized, the cached conversions below hold this
+   *  while they use them so that concurrent calls to convert do not race. */
+  std::mutex& unitSingletonsMutex()
+  {
+    static std::mutex result;
+    return result;
+  }
+
+  /** Conversion between two unit strings reduced to finalValue = factor*originalValue, with the
+   *  factor found by converting 1. Conversions with an offset (temperatures other than K and R)
+   *  keep the parsed units instead and go through QuantityConverter for each value, since
+   *  recovering the factor as convert(1) - convert(0) loses precision to the offset. */
+  struct CompiledUnitConversion {
+    double factor;
+    boost::optional<Unit> originalUnit;
+    boost::optional<Unit> finalUnit;
+
+    double convert(double original) const {
+      if (originalUnit) {
+        OS_ASSERT(finalUnit);
+        std::lock_guard<std::mutex> lock(unitSingletonsMutex());
+        boost::optional<Quantity> result = QuantityConverter::instance().convert(Quantity(original, *originalUnit), *finalUnit);
+        OS_ASSERT(result);
+        return result->value();
+      }
+      return factor * original;
+    }
+  };
+
+  typedef std::map<std::pair<std::string, std::string>, boost::optional<CompiledUnitConversion> > CompiledUnitConversionMap;
+
+  std::mutex& compiledUnitConversionsMutex()
+  {
+    static std::mutex result;
+    return result;
+  }
+
+  CompiledUnitConversionMap& compiledUnitConversions()
+  {
+    static CompiledUnitConversionMap result;
+    return result;
+  }
+
+  boost::optional<CompiledUnitConversion> compileUnitConversion(const std::string& originalUnits, const std::string& finalUnits)
+  {
+    std::lock_guard<std::mutex> lock(unitSingletonsMutex());
+
+    //create the units from the strings
+    boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
+    boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+
+    //make sure both unit strings were valid
+    if (!originalUnit || !finalUnit) {
+      return boost::none;
+    }
+
+    boost::optional<Quantity> offset = QuantityConverter::instance().convert(Quantity(0.0, *originalUnit), *finalUnit);
+    if (!offset) {
+      return boost::none;
+    }
+    boost::optional<Quantity> factor = QuantityConverter::instance().convert(Quantity(1.0, *originalUnit), *finalUnit);
+    OS_ASSERT(factor);
+
+    CompiledUnitConversion result;
+    result.factor = factor->value();
+    if (offset->value() != 0.0) {
+      result.originalUnit = originalUnit;
+      result.finalUnit = finalUnit;
+    }
+    return result;
+  }
+
+  /** Returns the cached conversion from originalUnits to finalUnits, compiling it on first use.
+   *  Unit strings that cannot be converted are cached too, so they are only parsed once. */
+  boost::optional<CompiledUnitConversion> compiledUnitConversion(const std::string& originalUnits, const std::string& finalUnits)
+  {
+    std::pair<std::string, std::string> key(originalUnits, finalUnits);
+
+    {
+      std::lock_guard<std::mutex> lock(compiledUnitConversionsMutex());
+      auto it = compiledUnitConversions().find(key);
+      if (it != compiledUnitConversions().end()) {
+        return it->second;
+      }
+    }
+
+    // compile without holding the cache lock, if another thread got there first its entry is kept
+    boost::optional<CompiledUnitConversion> result = compileUnitConversion(originalUnits, finalUnits);
+
+    std::lock_guard<std::mutex> lock(compiledUnitConversionsMutex());
+    return compiledUnitConversions().insert(std::make_pair(key, result)).first->second;
+  }
+
+} // detail
+
 boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits)
 {
   if (originalUnits == finalUnits){
     return original;
   }
 
-  //create the units from the strings
-  boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
-  boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+  boost::optional<detail::CompiledUnitConversion> conversion = detail::compiledUnitConversion(originalUnits, finalUnits);
+  if (conversion) {
+    return conversion->convert(original);
+  }
 
-  //make sure both unit strings were valid
-  if (originalUnit && finalUnit) {
+  return boost::none;
+}
+
+std::vector<double> convert(const std::vector<double>& original, const std::string& originalUnits, const std::string& finalUnits)
+{
+  if (originalUnits == finalUnits){
+    return original;
+  }
+
+  std::vector<double> result;
+  boost::optional<detail::CompiledUnitConversion> conversion = detail::compiledUnitConversion(originalUnits, finalUnits);
+  if (conversion) {
+    result.reserve(original.size());
+    for (double value : original) {
+      result.push_back(conversion->convert(value));
+    }
+  }
 
-    //make the original quantity
-    Quantity originalQuant = Quantity(original, *originalUnit);
+  return result;
+}
 
-    //convert to final units
-    boost::optional<Quantity> finalQuant = QuantityConverter::instance().convert(originalQuant, *finalUnit);
+Vector convert(const Vector& original, const std::string& originalUnits, const std::string& finalUnits)
+{
+  if (originalUnits == finalUnits){
+    return original;
+  }
 
-    //if the conversion
-    if (finalQuant) {
-      return finalQuant->value();
+  Vector result;
+  boost::optional<detail::CompiledUnitConversion> conversion = detail::compiledUnitConversion(originalUnits, finalUnits);
+  if (conversion) {
+    if (conversion->originalUnit) {
+      result.resize(original.size());
+      for (unsigned i = 0, n = original.size(); i < n; ++i) {
+        result[i] = conversion->convert(original[i]);
+      }
+    } else {
+      result = conversion->factor * original;
     }
   }
 
-  return boost::none;
+  return result;
+}
+
+TimeSeries convert(const TimeSeries& original, const std::string& finalUnits)
+{
+  Vector originalValues = original.values();
+  Vector values = convert(originalValues, original.units(), finalUnits);
+  if (values.size() != originalValues.size()) {
+    return TimeSeries();
+  }
+
+  TimeSeries result;
+  if (OptionalTime intervalLength = original.intervalLength()) {
+    result = TimeSeries(original.firstReportDateTime(), *intervalLength, values, finalUnits);
+  } else {
+    result = TimeSeries(original.firstReportDateTime(), original.secondsFromFirstReport(), values, finalUnits);
+  }
+  result.setOutOfRangeValue(original.outOfRangeValue());
+
+  return result;
 }
 
 boost::optional<Quantity> convert(const Quantity &q, UnitSystem sys) {
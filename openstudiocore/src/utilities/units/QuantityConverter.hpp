@@ -35,8 +35,10 @@
 #include "../core/Logger.hpp"
 
 #include "Unit.hpp"
+#include "../data/Vector.hpp"
 #include <string>
 #include <map>
+#include <vector>
 
 class QDomElement;
 
@@ -44,6 +46,7 @@ namespace openstudio {
 
 class Quantity;
 class OSQuantityVector;
+class TimeSeries;
 
 // JMT@20100902 - it's necessary to move the temperature conversion
 //                rule enum into a class that is *not* %ignored by swig, if we want
@@ -118,9 +121,29 @@ class UTILITIES_API QuantityConverterSingleton {
 /** \relates QuantityConverterSingleton */
 typedef openstudio::Singleton<QuantityConverterSingleton> QuantityConverter;
 
-/** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
+/** Non-member function to simplify interface for users. Each pair of unit strings is parsed once
+ *  and cached, so repeated calls only pay for a lookup and, for units without an offset, a single
+ *  multiplication. Concurrent calls to the convert overloads taking unit strings are safe, they
+ *  serialize their use of UnitFactory and QuantityConverter (conversions with an offset are
+ *  serialized for every value). Those singletons are not synchronized otherwise, so this does not
+ *  extend to using them directly from other threads at the same time. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits);
 
+/** Non-member function that converts every value in original from originalUnits to finalUnits using
+ *  a single cached conversion. Returns an empty vector if the units cannot be converted.
+ *  \relates QuantityConverterSingleton */
+UTILITIES_API std::vector<double> convert(const std::vector<double>& original, const std::string& originalUnits, const std::string& finalUnits);
+
+/** Non-member function that converts every value in original from originalUnits to finalUnits using
+ *  a single cached conversion. Returns an empty Vector if the units cannot be converted.
+ *  \relates QuantityConverterSingleton */
+UTILITIES_API Vector convert(const Vector& original, const std::string& originalUnits, const std::string& finalUnits);
+
+/** Non-member function that converts the values of original from original.units() to finalUnits,
+ *  keeping its reporting times. Returns an empty TimeSeries if the units cannot be converted.
+ *  \relates QuantityConverterSingleton \relates TimeSeries */
+UTILITIES_API TimeSeries convert(const TimeSeries& original, const std::string& finalUnits);
+
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys);
 
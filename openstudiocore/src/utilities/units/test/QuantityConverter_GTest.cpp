@@ -44,6 +44,14 @@
 #include "../SIUnit.hpp"
 #include "../Unit.hpp"
 
+#include "../../data/TimeSeries.hpp"
+#include "../../time/Date.hpp"
+#include "../../time/Time.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
 using namespace openstudio;
 
 TEST_F(UnitsFixture, QuantityConverter_IPandSIUsingSystem)
@@ -268,3 +276,134 @@ TEST_F(UnitsFixture,QuantityConverter_Profiling_QuantityVectorBaseCase) {
 TEST_F(UnitsFixture,QuantityConverter_Profiling_OSQuantityVector) {
   OSQuantityVector result = convert(testOSQuantityVector,UnitSystem(UnitSystem::Wh));
 }
+
+TEST_F(UnitsFixture,QuantityConverter_UnitStrings) {
+  // cached conversions match converting the equivalent quantities directly
+  std::vector<std::pair<std::string,std::string> > unitPairs;
+  unitPairs.push_back(std::make_pair("m","ft"));
+  unitPairs.push_back(std::make_pair("m^3/s","cfm"));
+  unitPairs.push_back(std::make_pair("W/m^2","W/ft^2"));
+  unitPairs.push_back(std::make_pair("C","F"));
+  unitPairs.push_back(std::make_pair("F","C"));
+  for (const auto& unitPair : unitPairs) {
+    Unit originalUnit = createUnit(unitPair.first).get();
+    Unit finalUnit = createUnit(unitPair.second).get();
+    for (double value : {-40.0, 0.0, 1.0, 21.5, 1000.0}) {
+      OptionalQuantity expected = convert(Quantity(value,originalUnit),finalUnit);
+      ASSERT_TRUE(expected);
+      // second call uses the cached conversion
+      for (unsigned i = 0; i < 2; ++i) {
+        boost::optional<double> result = convert(value,unitPair.first,unitPair.second);
+        ASSERT_TRUE(result);
+        EXPECT_NEAR(expected->value(),*result,1.0E-9 * std::max(1.0,std::fabs(expected->value())));
+      }
+    }
+  }
+
+  EXPECT_FALSE(convert(1.0,"m","kg"));
+  EXPECT_FALSE(convert(1.0,"m","kg"));
+  EXPECT_FALSE(convert(1.0,"not a unit","m"));
+
+  // vectors
+  std::vector<double> values;
+  values.push_back(32.0);
+  values.push_back(212.0);
+  std::vector<double> converted = convert(values,"F","C");
+  ASSERT_EQ(2u,converted.size());
+  EXPECT_NEAR(0.0,converted[0],1.0E-9);
+  EXPECT_NEAR(100.0,converted[1],1.0E-9);
+  EXPECT_TRUE(convert(values,"F","kg").empty());
+
+  Vector vectorValues = createVector(values);
+  Vector convertedVector = convert(vectorValues,"F","C");
+  ASSERT_EQ(2u,convertedVector.size());
+  EXPECT_NEAR(0.0,convertedVector[0],1.0E-9);
+  EXPECT_NEAR(100.0,convertedVector[1],1.0E-9);
+  EXPECT_EQ(0u,convert(vectorValues,"F","kg").size());
+
+  // time series keep their reporting times
+  TimeSeries timeSeries(Date(MonthOfYear(MonthOfYear::Jan),1),Time(0,1),vectorValues,"F");
+  TimeSeries convertedTimeSeries = convert(timeSeries,"C");
+  EXPECT_EQ("C",convertedTimeSeries.units());
+  ASSERT_EQ(2u,convertedTimeSeries.values().size());
+  EXPECT_NEAR(0.0,convertedTimeSeries.values(0),1.0E-9);
+  EXPECT_NEAR(100.0,convertedTimeSeries.values(1),1.0E-9);
+  EXPECT_EQ(timeSeries.firstReportDateTime(),convertedTimeSeries.firstReportDateTime());
+  ASSERT_TRUE(convertedTimeSeries.intervalLength());
+  EXPECT_EQ(Time(0,1),*convertedTimeSeries.intervalLength());
+  EXPECT_EQ(0u,convert(timeSeries,"kg").values().size());
+}
+
+TEST_F(UnitsFixture,QuantityConverter_UnitStringsTemperature) {
+  // conversions with an offset give exactly the same values as converting quantities
+  Unit kelvin = createUnit("K").get();
+  Unit fahrenheit = createUnit("F").get();
+  OptionalQuantity expected = convert(Quantity(300.0,kelvin),fahrenheit);
+  ASSERT_TRUE(expected);
+  EXPECT_DOUBLE_EQ(80.33,expected->value());
+  for (unsigned i = 0; i < 2; ++i) {
+    boost::optional<double> result = convert(300.0,"K","F");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(expected->value(),*result);
+  }
+
+  std::vector<double> values(3,300.0);
+  std::vector<double> converted = convert(values,"K","F");
+  ASSERT_EQ(3u,converted.size());
+  Vector convertedVector = convert(createVector(values),"K","F");
+  ASSERT_EQ(3u,convertedVector.size());
+  for (unsigned i = 0; i < 3; ++i) {
+    EXPECT_EQ(expected->value(),converted[i]);
+    EXPECT_EQ(expected->value(),convertedVector[i]);
+  }
+
+  Unit celsius = createUnit("C").get();
+  for (double value : {-40.0, 0.0, 21.1, 100.0}) {
+    expected = convert(Quantity(value,celsius),fahrenheit);
+    ASSERT_TRUE(expected);
+    EXPECT_EQ(expected->value(),convert(value,"C","F").get());
+  }
+}
+
+TEST_F(UnitsFixture,QuantityConverter_UnitStringsThreads) {
+  // unit pairs not used elsewhere in this file so they are compiled while the threads run
+  std::vector<double> values;
+  for (unsigned i = 0; i < 1000; ++i) {
+    values.push_back(0.1 * i);
+  }
+
+  const unsigned numThreads = 8;
+  std::vector<std::vector<double> > results(numThreads);
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < numThreads; ++t) {
+    threads.push_back(std::thread([&values, &results, t]() {
+      for (double value : values) {
+        results[t].push_back(convert(value, (t % 2 == 0) ? "C" : "m/h", (t % 2 == 0) ? "K" : "m/s").get());
+      }
+    }));
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (unsigned t = 0; t < numThreads; ++t) {
+    ASSERT_EQ(values.size(), results[t].size());
+    for (unsigned i = 0, n = values.size(); i < n; ++i) {
+      EXPECT_EQ(convert(values[i], (t % 2 == 0) ? "C" : "m/h", (t % 2 == 0) ? "K" : "m/s").get(), results[t][i]);
+    }
+  }
+}
+
+TEST_F(UnitsFixture,QuantityConverter_Profiling_UnitStrings) {
+  double total = 0.0;
+  for (unsigned i = 0; i < 100000; ++i) {
+    total += convert(static_cast<double>(i),"W","Btu/h").get();
+  }
+  EXPECT_LT(0.0,total);
+}
+
+TEST_F(UnitsFixture,QuantityConverter_Profiling_UnitStringsVector) {
+  std::vector<double> values(100000,1.0);
+  std::vector<double> result = convert(values,"W","Btu/h");
+  EXPECT_EQ(values.size(),result.size());
+}